@@ -52,6 +52,12 @@ using namespace std;
  */
 bool format_go_output(const string &file_path);
 
+/**
+ * Stands in for the id of the last field written when that is only known at
+ * run time.  It lies outside the range of real, 16 bit, field ids.
+ */
+static const int UNKNOWN_FIELD_ID = 1 << 16;
+
 /**
  * Go code generator.
  */
@@ -65,6 +71,20 @@ public:
         : t_generator(program) {
         std::map<std::string, std::string>::const_iterator iter;
         out_dir_base_ = "gen-go";
+        iter = parsed_options.find("native_containers");
+        gen_native_containers_ = (iter != parsed_options.end());
+        iter = parsed_options.find("zero_copy");
+        gen_zero_copy_ = (iter != parsed_options.end());
+        iter = parsed_options.find("binary_streams");
+        gen_binary_streams_ = (iter != parsed_options.end());
+        iter = parsed_options.find("value_lists");
+        gen_value_lists_ = (iter != parsed_options.end());
+        iter = parsed_options.find("arena");
+        gen_arena_ = (iter != parsed_options.end());
+        iter = parsed_options.find("isset_bits");
+        gen_isset_bits_ = (iter != parsed_options.end());
+        iter = parsed_options.find("pack_fields");
+        gen_pack_fields_ = (iter != parsed_options.end());
     }
 
     /**
@@ -92,10 +112,18 @@ public:
      */
 
     void generate_go_struct(t_struct* tstruct, bool is_exception);
-    void generate_go_struct_definition(std::ofstream& out, t_struct* tstruct, bool is_xception = false, bool is_result = false);
+    void generate_go_struct_definition(std::ofstream& out, t_struct* tstruct, bool is_xception = false, bool is_result = false, bool is_args = false);
+    void generate_go_struct_arena(std::ofstream& out, const string& tstruct_name);
     void generate_isset_helpers(std::ofstream& out, t_struct* tstruct, const string& tstruct_name, bool is_result = false);
+    void generate_go_struct_reset(std::ofstream& out, t_struct* tstruct, const string& tstruct_name);
+    void generate_go_struct_equality(std::ofstream& out, t_struct* tstruct, const string& tstruct_name);
+    void generate_equals_value(std::ofstream& out, t_type* ttype, const string& a, const string& b, bool by_value = false);
+    void generate_compare_value(std::ofstream& out, t_type* ttype, const string& a, const string& b, bool by_value = false);
+    void generate_hash_value(std::ofstream& out, t_type* ttype, const string& value, const string& h, bool is_key = false);
     void generate_go_struct_reader(std::ofstream& out, t_struct* tstruct, const string& tstruct_name, bool is_result = false);
     void generate_go_struct_writer(std::ofstream& out, t_struct* tstruct, const string& tstruct_name, bool is_result = false);
+    void generate_go_struct_codec(std::ofstream& out, t_struct* tstruct, const string& tstruct_name, bool is_result, const string& proto);
+    void generate_go_struct_marshal(std::ofstream& out, t_struct* tstruct, const string& tstruct_name, bool is_result, const string& proto, bool size_only);
     void generate_go_function_helpers(t_function* tfunction);
 
     /**
@@ -105,6 +133,7 @@ public:
     void generate_service_helpers   (t_service*  tservice);
     void generate_service_interface (t_service* tservice);
     void generate_service_client    (t_service* tservice);
+    void generate_service_concurrent_client(t_service* tservice);
     void generate_service_remote    (t_service* tservice);
     void generate_service_server    (t_service* tservice);
     void generate_process_function  (t_service* tservice, t_function* tfunction);
@@ -133,6 +162,12 @@ public:
                                             std::string prefix = "",
                                             std::string err = "err");
 
+    void generate_native_container_make    (std::ofstream &out,
+                                            t_type*     ttype,
+                                            const std::string& target,
+                                            const std::string& eq,
+                                            const std::string& size);
+
     void generate_deserialize_set_element  (std::ofstream &out,
                                             t_set*      tset,
                                             bool        declare,
@@ -182,6 +217,31 @@ public:
                                             std::string iter,
                                             std::string err = "err");
 
+    void generate_marshal_field            (std::ofstream &out,
+                                            const std::string& proto,
+                                            t_field*    tfield,
+                                            int&        last_id,
+                                            bool&       last_id_tracked,
+                                            bool        track_last_id,
+                                            bool        size_only);
+
+    void generate_marshal_value            (std::ofstream &out,
+                                            const std::string& proto,
+                                            t_type*     ttype,
+                                            std::string value);
+
+    void generate_size_value               (std::ofstream &out,
+                                            const std::string& proto,
+                                            t_type*     ttype,
+                                            std::string value);
+
+    void generate_unmarshal_value          (std::ofstream &out,
+                                            const std::string& proto,
+                                            t_type*     ttype,
+                                            std::string target,
+                                            bool        declare,
+                                            std::string fail);
+
     void generate_go_docstring         (std::ofstream& out,
                                         t_struct* tstruct);
 
@@ -212,7 +272,13 @@ public:
     std::string function_signature_if(t_function* tfunction, std::string prefix = "", bool addOsError = false);
     std::string argument_list(t_struct* tstruct);
     std::string type_to_enum(t_type* ttype);
+    int type_to_compact_type(t_type* ttype);
+    std::vector<int> compact_field_header(int compact_type, int id, int last_id);
+    std::string go_byte_list(const std::vector<int>& bytes);
+    int fixed_wire_size(const std::string& proto, t_type* ttype);
     std::string type_to_go_type(t_type* ttype);
+    std::string type_to_go_key_type(t_type* ttype);
+    std::string native_key(t_type* ttype, const std::string& value);
     std::string type_to_spec_args(t_type* ttype);
 
     static std::string get_real_go_module(const t_program* program) {
@@ -227,6 +293,75 @@ public:
 
 private:
 
+    /**
+     * True if we should emit map[K]V, []T and map[T]struct{} instead of
+     * thrift.TMap, thrift.TList and thrift.TSet for containers.
+     */
+    bool gen_native_containers_;
+
+    /**
+     * True if string and binary fields should be read in place from the
+     * buffer they arrive in, rather than copied out of it.
+     */
+    bool gen_zero_copy_;
+
+    /**
+     * True if each binary field of a struct should get a companion
+     * *thrift.TBinaryStream through which it can be written from an
+     * io.Reader and read into an io.Writer.
+     */
+    bool gen_binary_streams_;
+
+    /**
+     * True if native lists of structs should hold the structs themselves,
+     * []T, rather than []*T.
+     */
+    bool gen_value_lists_;
+
+    /**
+     * True if structs should be read into the thrift.TArena of the protocol
+     * reading them, and processors should give each call an arena that is
+     * released once it has been answered.
+     */
+    bool gen_arena_;
+
+    /**
+     * True if the presence of optional scalar and enum fields should be kept
+     * in a per-struct bitset rather than read from their values.
+     */
+    bool gen_isset_bits_;
+
+    /**
+     * True if struct fields should be declared widest alignment first, so
+     * that the compiler pads between them as little as it can, rather than
+     * in field id order.
+     */
+    bool gen_pack_fields_;
+
+    /**
+     * The __isset bits of the struct being generated; see isset_bits().
+     */
+    std::map<t_field*, int> struct_isset_bits_;
+
+    /**
+     * The native container fields of the struct being generated whose
+     * storage Reset() keeps in a spare for the next Read(); see __reuse.
+     */
+    std::set<std::string> struct_spares_;
+
+    /**
+     * True if struct_spares_ is not empty.
+     */
+    bool struct_reuse_;
+
+    bool is_streamed(t_field* tfield);
+    std::string bulk_list_type(t_type* ttype);
+    bool is_value_list(t_type* ttype);
+    std::map<t_field*, int> isset_bits(t_struct* tstruct);
+    std::string isset_bits_type(size_t count);
+    int go_type_alignment(t_type* ttype);
+    std::string isset_bit(const std::string& prefix, int bit, size_t count, const std::string& op);
+
     /**
      * File streams
      */
@@ -724,13 +859,16 @@ string t_go_generator::render_const_value(t_type* type, t_const_value* value, co
         vector<t_field*>::const_iterator f_iter;
         const map<t_const_value*, t_const_value*>& val = value->get_map();
         map<t_const_value*, t_const_value*>::const_iterator v_iter;
+        std::map<t_field*, int> bits = isset_bits((t_struct*)type);
 
         for (v_iter = val.begin(); v_iter != val.end(); ++v_iter) {
             t_type* field_type = NULL;
+            t_field* field = NULL;
 
             for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
                 if ((*f_iter)->get_name() == v_iter->first->get_string()) {
                     field_type = (*f_iter)->get_type();
+                    field = *f_iter;
                 }
             }
 
@@ -738,7 +876,10 @@ string t_go_generator::render_const_value(t_type* type, t_const_value* value, co
                 throw "type error: " + type->get_name() + " has no field " + v_iter->first->get_string();
             }
 
-            if (field_type->is_base_type() || field_type->is_enum()) {
+            if (bits.count(field)) {
+                out <<
+                    indent() << name << ".Set" << publicize(v_iter->first->get_string()) << "(" << render_const_value(field_type, v_iter->second, name) << ")" << endl;
+            } else if (field_type->is_base_type() || field_type->is_enum()) {
                 out <<
                     indent() << name << "." << publicize(v_iter->first->get_string()) << " = " << render_const_value(field_type, v_iter->second, name) << endl;
             } else {
@@ -750,6 +891,68 @@ string t_go_generator::render_const_value(t_type* type, t_const_value* value, co
             }
         }
 
+        indent_down();
+        out <<
+            indent() << "}";
+    } else if (type->is_map() && gen_native_containers_) {
+        t_type* ktype = ((t_map*)type)->get_key_type();
+        t_type* vtype = ((t_map*)type)->get_val_type();
+        t_type* true_ktype = get_true_type(ktype);
+        const map<t_const_value*, t_const_value*>& val = value->get_map();
+        out <<
+            type_to_go_type(type) << "{" << endl;
+        indent_up();
+        map<t_const_value*, t_const_value*>::const_iterator v_iter;
+
+        for (v_iter = val.begin(); v_iter != val.end(); ++v_iter) {
+            // binary keys are stored as strings so that they can be hashed
+            if (true_ktype->is_base_type() && ((t_base_type*)true_ktype)->is_binary()) {
+                out << indent() << '"' << get_escaped_string(v_iter->first) << '"';
+            } else {
+                out << indent() << render_const_value(ktype, v_iter->first, name);
+            }
+
+            out << ": " << render_const_value(vtype, v_iter->second, name) << "," << endl;
+        }
+
+        indent_down();
+        out <<
+            indent() << "}";
+    } else if (type->is_list() && gen_native_containers_) {
+        t_type* etype = ((t_list*)type)->get_elem_type();
+        const vector<t_const_value*>& val = value->get_list();
+        out <<
+            type_to_go_type(type) << "{" << endl;
+        indent_up();
+        vector<t_const_value*>::const_iterator v_iter;
+
+        for (v_iter = val.begin(); v_iter != val.end(); ++v_iter) {
+            out <<
+                indent() << (is_value_list(type) ? "*" : "") << render_const_value(etype, *v_iter, name) << "," << endl;
+        }
+
+        indent_down();
+        out <<
+            indent() << "}";
+    } else if (type->is_set() && gen_native_containers_) {
+        t_type* etype = ((t_set*)type)->get_elem_type();
+        t_type* true_etype = get_true_type(etype);
+        const vector<t_const_value*>& val = value->get_list();
+        out <<
+            type_to_go_type(type) << "{" << endl;
+        indent_up();
+        vector<t_const_value*>::const_iterator v_iter;
+
+        for (v_iter = val.begin(); v_iter != val.end(); ++v_iter) {
+            if (true_etype->is_base_type() && ((t_base_type*)true_etype)->is_binary()) {
+                out << indent() << '"' << get_escaped_string(*v_iter) << '"';
+            } else {
+                out << indent() << render_const_value(etype, *v_iter, name);
+            }
+
+            out << ": struct{}{}," << endl;
+        }
+
         indent_down();
         out <<
             indent() << "}";
@@ -848,19 +1051,200 @@ void t_go_generator::generate_go_struct(t_struct* tstruct,
     generate_go_struct_definition(f_types_, tstruct, is_exception);
 }
 
+/**
+ * Whether tfield is a binary field that gets a companion TBinaryStream.
+ */
+bool t_go_generator::is_streamed(t_field* tfield)
+{
+    t_type* type = get_true_type(tfield->get_type());
+    return gen_binary_streams_ && type->is_base_type() && ((t_base_type*)type)->is_binary();
+}
+
+/**
+ * The X of the thrift.ReadXList() and thrift.WriteXList() helpers through
+ * which a native list of ttype's elements is read and written whole, or ""
+ * if its elements are read and written one at a time.  Typedefs are left
+ * out, since their slices are not of the helpers' types.
+ */
+string t_go_generator::bulk_list_type(t_type* ttype)
+{
+    if (!gen_native_containers_ || !ttype->is_list()) {
+        return "";
+    }
+
+    t_type* etype = ((t_list*)ttype)->get_elem_type();
+
+    if (!etype->is_base_type()) {
+        return "";
+    }
+
+    switch (((t_base_type*)etype)->get_base()) {
+    case t_base_type::TYPE_BYTE:
+        return "Byte";
+
+    case t_base_type::TYPE_I32:
+        return "I32";
+
+    case t_base_type::TYPE_I64:
+        return "I64";
+
+    case t_base_type::TYPE_DOUBLE:
+        return "Double";
+
+    default:
+        return "";
+    }
+}
+
+/**
+ * Whether ttype is a native list that holds its struct elements by value,
+ * so that they are read and written in place in its backing array.
+ */
+bool t_go_generator::is_value_list(t_type* ttype)
+{
+    if (!gen_value_lists_ || !gen_native_containers_ || !ttype->is_list()) {
+        return false;
+    }
+
+    t_type* etype = ((t_list*)ttype)->get_elem_type();
+    return etype->is_struct() || etype->is_xception();
+}
+
+/**
+ * Numbers the fields of tstruct whose presence its __isset bitset tracks:
+ * optional scalars and enums, whose values cannot say whether they were
+ * set.  Fields that can be nil are set when they are not.
+ */
+std::map<t_field*, int> t_go_generator::isset_bits(t_struct* tstruct)
+{
+    std::map<t_field*, int> bits;
+
+    if (!gen_isset_bits_) {
+        return bits;
+    }
+
+    const vector<t_field*>& members = tstruct->get_members();
+    vector<t_field*>::const_iterator m_iter;
+
+    for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
+        t_type* type = get_true_type((*m_iter)->get_type());
+        bool scalar = type->is_enum() || (type->is_base_type() && !((t_base_type*)type)->is_binary());
+
+        if (scalar && ((*m_iter)->get_req() == t_field::T_OPTIONAL || type->is_enum())) {
+            bits.insert(std::make_pair(*m_iter, (int)bits.size()));
+        }
+    }
+
+    return bits;
+}
+
+/**
+ * The type of an __isset holding count bits: the narrowest unsigned integer
+ * that fits them, or an array of uint64s past 64.
+ */
+string t_go_generator::isset_bits_type(size_t count)
+{
+    if (count <= 8) {
+        return "uint8";
+    } else if (count <= 16) {
+        return "uint16";
+    } else if (count <= 32) {
+        return "uint32";
+    } else if (count <= 64) {
+        return "uint64";
+    }
+
+    std::ostringstream array;
+    array << "[" << (count + 63) / 64 << "]uint64";
+    return array.str();
+}
+
+/**
+ * The alignment of the Go type ttype is held as on a 64-bit platform, by
+ * which pack_fields orders the fields of a struct.
+ */
+int t_go_generator::go_type_alignment(t_type* ttype)
+{
+    ttype = get_true_type(ttype);
+
+    if (ttype->is_base_type()) {
+        switch (((t_base_type*)ttype)->get_base()) {
+        case t_base_type::TYPE_BOOL:
+        case t_base_type::TYPE_BYTE:
+            return 1;
+
+        case t_base_type::TYPE_I16:
+            return 2;
+
+        case t_base_type::TYPE_I32:
+            return 4;
+
+        default:
+            break;
+        }
+    }
+
+    return 8;
+}
+
+static bool wider_alignment(const std::pair<int, string>& a, const std::pair<int, string>& b)
+{
+    return a.first > b.first;
+}
+
+/**
+ * An expression testing, or with op "set" or "clear" a statement changing,
+ * bit of the count-bit __isset of the struct at prefix.
+ */
+string t_go_generator::isset_bit(const string& prefix, int bit, size_t count, const string& op)
+{
+    std::ostringstream expr;
+    expr << prefix << "__isset";
+
+    if (count > 64) {
+        expr << "[" << bit / 64 << "]";
+    }
+
+    if (op == "set") {
+        expr << " |= 1 << " << bit % 64;
+    } else if (op == "clear") {
+        expr << " &^= 1 << " << bit % 64;
+    } else {
+        expr << "&(1<<" << bit % 64 << ") != 0";
+    }
+
+    return expr.str();
+}
+
 /**
  * Generates a struct definition for a thrift data type.
  *
  * @param tstruct The struct definition
  */
+
 void t_go_generator::generate_go_struct_definition(ofstream& out,
         t_struct* tstruct,
         bool is_exception,
-        bool is_result)
+        bool is_result,
+        bool is_args)
 {
     const vector<t_field*>& members = tstruct->get_members();
     const vector<t_field*>& sorted_members = tstruct->get_sorted_members();
     vector<t_field*>::const_iterator m_iter;
+    // Generated code fills in args and results itself, by assignment
+    struct_isset_bits_ = (is_args || is_result) ? std::map<t_field*, int>() : isset_bits(tstruct);
+    struct_spares_.clear();
+
+    // Structs with negative field ids declare no fields of their own
+    for (m_iter = members.begin(); gen_native_containers_ && m_iter != members.end(); ++m_iter) {
+        if (get_true_type((*m_iter)->get_type())->is_container() && (*m_iter)->get_value() == NULL &&
+                (sorted_members.empty() || sorted_members[0]->get_key() >= 0)) {
+            struct_spares_.insert(publicize(variable_name_to_go_name((*m_iter)->get_name())));
+        }
+    }
+
+    struct_reuse_ = !struct_spares_.empty();
+
     generate_go_docstring(out, tstruct);
     std::string tstruct_name(publicize(tstruct->get_name()));
     out <<
@@ -892,22 +1276,57 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
     indent_up();
 
     if (sorted_members.empty() || (sorted_members[0]->get_key() >= 0)) {
-        int sorted_keys_pos = 0;
+        // Each declaration with the alignment of its type.  Gaps in the field
+        // ids take no space: nothing finds a field by its position.
+        vector<std::pair<int, string> > decls;
 
         for (m_iter = sorted_members.begin(); m_iter != sorted_members.end(); ++m_iter) {
-            for (; sorted_keys_pos != (*m_iter)->get_key(); sorted_keys_pos++) {
-                if (sorted_keys_pos != 0) {
-                    indent(out) << "_ interface{}; // nil # " << sorted_keys_pos << endl;
-                }
+            t_type* fieldType = (*m_iter)->get_type();
+            std::ostringstream decl;
+            decl << publicize(variable_name_to_go_name((*m_iter)->get_name())) << " "
+                 << type_to_go_type(fieldType) << " \"" << escape_string((*m_iter)->get_name())
+                 << "\"; // " << (*m_iter)->get_key();
+            decls.push_back(std::make_pair(go_type_alignment(fieldType), decl.str()));
+        }
+
+        for (m_iter = sorted_members.begin(); m_iter != sorted_members.end(); ++m_iter) {
+            if (is_streamed(*m_iter)) {
+                decls.push_back(std::make_pair(8, publicize(variable_name_to_go_name((*m_iter)->get_name())) + "Stream *thrift.TBinaryStream"));
             }
+        }
 
-            t_type* fieldType = (*m_iter)->get_type();
-            string goType(type_to_go_type(fieldType));
-            indent(out) << publicize(variable_name_to_go_name((*m_iter)->get_name())) << " "
-                        << goType << " \"" << escape_string((*m_iter)->get_name())
-                        << "\"; // " << sorted_keys_pos
-                        << endl;
-            sorted_keys_pos ++;
+        if (!struct_isset_bits_.empty()) {
+            size_t count = struct_isset_bits_.size();
+            decls.push_back(std::make_pair(count <= 8 ? 1 : count <= 16 ? 2 : count <= 32 ? 4 : 8,
+                                           "__isset " + isset_bits_type(count)));
+        }
+
+        for (m_iter = sorted_members.begin(); m_iter != sorted_members.end(); ++m_iter) {
+            string field_name(publicize(variable_name_to_go_name((*m_iter)->get_name())));
+
+            if (struct_spares_.count(field_name) != 0) {
+                // The emptied storage of the field, which Reset() sets to nil
+                decls.push_back(std::make_pair(go_type_alignment((*m_iter)->get_type()), "__spare" + field_name + " " + type_to_go_type((*m_iter)->get_type())));
+            }
+        }
+
+        if (struct_reuse_) {
+            // Set by Reset() until the next read, which takes the storage of
+            // its containers from their spares rather than allocating anew
+            decls.push_back(std::make_pair(1, string("__reuse bool")));
+        }
+
+        if (is_args && gen_arena_) {
+            // Set by the processor while the call it was read for is in hand
+            decls.push_back(std::make_pair(8, string("arena *thrift.TArena")));
+        }
+
+        if (gen_pack_fields_) {
+            std::stable_sort(decls.begin(), decls.end(), wider_alignment);
+        }
+
+        for (size_t i = 0; i < decls.size(); ++i) {
+            indent(out) << decls[i].second << endl;
         }
     } else {
         for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
@@ -919,12 +1338,12 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
     }
 
     indent_down();
+    // The field metadata never changes, so every instance shares one
+    // package-level descriptor rather than allocating its own.
+    string tstruct_descriptor(privatize(tstruct_name) + "TStruct");
     out <<
         indent() << "}" << endl << endl <<
-        indent() << "func New" << tstruct_name << "() *" << tstruct_name << " {" << endl <<
-        indent() << "  output := &" << tstruct_name << "{" << endl <<
-        indent() << "    TStruct:thrift.NewTStruct(\"" << escape_string(tstruct->get_name()) << "\", []thrift.TField{" << endl;
-    indent_up();
+        indent() << "var " << tstruct_descriptor << " = thrift.NewTStruct(\"" << escape_string(tstruct->get_name()) << "\", []thrift.TField{" << endl;
     indent_up();
 
     for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
@@ -933,9 +1352,13 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
             indent() << "thrift.NewTField(\"" << thrift_name << "\", " << type_to_enum((*m_iter)->get_type()) << ", " << (*m_iter)->get_key() << ")," << endl;
     }
 
-    out <<
-        indent() << "})," << endl;
     indent_down();
+    out <<
+        indent() << "})" << endl << endl <<
+        indent() << "func New" << tstruct_name << "() *" << tstruct_name << " {" << endl <<
+        indent() << "  output := &" << tstruct_name << "{" << endl <<
+        indent() << "    TStruct: " << tstruct_descriptor << "," << endl;
+    indent_up();
     out <<
         indent() << "}" << endl <<
         indent() << "{" << endl;
@@ -951,10 +1374,16 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
         const t_type* type = get_true_type((*m_iter)->get_type());
         const bool has_default_value = (*m_iter)->get_value() != NULL;
         const bool type_is_enum = type->is_enum();
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*m_iter);
 
         if (has_default_value) {
             out << indent() << full_field_name << " = " << render_field_default_value(*m_iter, base_field_name) << endl;
-        } else if (type_is_enum) {
+
+            // An enum with a default is always sent, as without the bitset
+            if (type_is_enum && bit != struct_isset_bits_.end()) {
+                out << indent() << isset_bit("output.", bit->second, struct_isset_bits_.size(), "set") << endl;
+            }
+        } else if (type_is_enum && bit == struct_isset_bits_.end()) {
             out << indent() << full_field_name << " = math.MinInt32 - 1" << endl;
         }
     }
@@ -966,9 +1395,17 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
     indent_down();
     out <<
         indent() << "}" << endl << endl;
+
+    if (gen_arena_) {
+        generate_go_struct_arena(out, tstruct_name);
+    }
+
+    generate_go_struct_reset(out, tstruct, tstruct_name);
     generate_isset_helpers(out, tstruct, tstruct_name, is_result);
     generate_go_struct_reader(out, tstruct, tstruct_name, is_result);
     generate_go_struct_writer(out, tstruct, tstruct_name, is_result);
+    generate_go_struct_codec(out, tstruct, tstruct_name, is_result, "Binary");
+    generate_go_struct_codec(out, tstruct, tstruct_name, is_result, "Compact");
     // Printing utilities so that on the command line thrift
     // structs look pretty like dictionaries
     out <<
@@ -987,17 +1424,7 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
         indent() << "  return fmt.Sprintf(\"" << escape_string(tstruct_name) << "(%+v)\", *p)" << endl <<
         indent() << "}" << endl << endl;
     // Equality and inequality methods that compare by value
-    out <<
-        indent() << "func (p *" << tstruct_name << ") CompareTo(other interface{}) (int, bool) {" << endl <<
-        indent() << "  if other == nil {" << endl <<
-        indent() << "    return 1, true" << endl <<
-        indent() << "  }" << endl <<
-        indent() << "  data, ok := other.(*" << tstruct_name << ")" << endl <<
-        indent() << "  if !ok {" << endl <<
-        indent() << "    return 0, false" << endl <<
-        indent() << "  }" << endl <<
-        indent() << "  return thrift.TType(thrift.STRUCT).Compare(p, data)" << endl <<
-        indent() << "}" << endl << endl;
+    generate_go_struct_equality(out, tstruct, tstruct_name);
     // Equality and inequality methods that compare by value
     out <<
         indent() << "func (p *" << tstruct_name << ") AttributeByFieldId(id int) interface{} {" << endl <<
@@ -1021,376 +1448,1766 @@ void t_go_generator::generate_go_struct_definition(ofstream& out,
         indent() << "}" << endl << endl;
     out <<
         indent() << "func (p *" << tstruct_name << ") TStructFields() thrift.TFieldContainer {" << endl <<
-        indent() << "  return thrift.NewTFieldContainer([]thrift.TField{" << endl;
-    indent_up();
-    indent_up();
-
-    for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
-        string thrift_name((*m_iter)->get_name());
-        out <<
-            indent() << "thrift.NewTField(\"" << escape_string(thrift_name) << "\", " << type_to_enum((*m_iter)->get_type()) << ", " << (*m_iter)->get_key() << ")," << endl;
-    }
+        indent() << "  return " << tstruct_descriptor << ".TStructFields()" << endl <<
+        indent() << "}" << endl << endl;
+}
 
+/**
+ * Generates the slab a thrift.TArena holds structs of this type in, and
+ * New<Struct>FromArena(), which takes one from it in the state New() leaves
+ * it in.  Slab chunks are kept across arena resets, and so are the native
+ * containers of the structs in them, which Reset() empties in place.
+ */
+void t_go_generator::generate_go_struct_arena(ofstream& out,
+        const string& tstruct_name)
+{
+    string slab(privatize(tstruct_name) + "Slab");
     out <<
-        indent() << "})" << endl;
-    indent_down();
-    indent_down();
-    out <<
+        indent() << "type " << slab << " struct {" << endl <<
+        indent() << "  chunks [][]" << tstruct_name << endl <<
+        indent() << "  chunk int" << endl <<
+        indent() << "  used int" << endl <<
+        indent() << "}" << endl << endl <<
+        indent() << "var " << slab << "Id = thrift.NewTArenaSlabId(func() thrift.TArenaSlab { return new(" << slab << ") })" << endl << endl <<
+        indent() << "func (s *" << slab << ") Reset() {" << endl <<
+        indent() << "  s.chunk, s.used = 0, 0" << endl <<
+        indent() << "}" << endl << endl <<
+        indent() << "func New" << tstruct_name << "FromArena(arena *thrift.TArena) *" << tstruct_name << " {" << endl <<
+        indent() << "  if arena == nil {" << endl <<
+        indent() << "    return New" << tstruct_name << "()" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  s := arena.Slab(" << slab << "Id).(*" << slab << ")" << endl <<
+        indent() << "  if s.chunk == len(s.chunks) {" << endl <<
+        indent() << "    s.chunks = append(s.chunks, make([]" << tstruct_name << ", thrift.ArenaSlabLength))" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  output := &s.chunks[s.chunk][s.used]" << endl <<
+        indent() << "  if s.used++; s.used == thrift.ArenaSlabLength {" << endl <<
+        indent() << "    s.chunk, s.used = s.chunk+1, 0" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  output.Reset()" << endl <<
+        indent() << "  return output" << endl <<
         indent() << "}" << endl << endl;
 }
 
 /**
- * Generates the IsSet helper methods for a struct
+ * Generates Reset(), which returns a struct to the state New() leaves it in
+ * so that it may be read into again.  Native containers without a default
+ * are set to nil, as New() leaves them, but their storage is emptied and
+ * kept in a spare for the next read to take.
  */
-void t_go_generator::generate_isset_helpers(ofstream& out,
+void t_go_generator::generate_go_struct_reset(ofstream& out,
         t_struct* tstruct,
-        const string& tstruct_name,
-        bool is_result)
+        const string& tstruct_name)
 {
-    const vector<t_field*>& fields = tstruct->get_members();
-    vector<t_field*>::const_iterator f_iter;
-    const string escaped_tstruct_name(escape_string(tstruct->get_name()));
+    const vector<t_field*>& members = tstruct->get_members();
+    vector<t_field*>::const_iterator m_iter;
+    vector<t_field*> kept;
+    vector<string> storage;
+    out <<
+        indent() << "func (p *" << tstruct_name << ") Reset() {" << endl;
+    indent_up();
 
-    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
-        t_type* type = get_true_type((*f_iter)->get_type());
+    for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
+        t_type* type = get_true_type((*m_iter)->get_type());
+        string field_name(publicize(variable_name_to_go_name((*m_iter)->get_name())));
 
-        if ((*f_iter)->get_req() == t_field::T_OPTIONAL || type->is_enum()) {
-            const string field_name(publicize(variable_name_to_go_name(escape_string((*f_iter)->get_name()))));
-            t_const_value* field_default_value = (*f_iter)->get_value();
+        if (struct_spares_.count(field_name) != 0) {
+            kept.push_back(*m_iter);
+            storage.push_back(tmp("storage"));
             out <<
-                indent() << "func (p *" << tstruct_name << ") IsSet" << field_name << "() bool {" << endl;
-            indent_up();
-            string s_check_value;
-            int64_t i_check_value;
-            double d_check_value;
-
-            if (type->is_base_type()) {
-                t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
-
-                switch (tbase) {
-                case t_base_type::TYPE_STRING:
-                    if (((t_base_type*)type)->is_binary()) {
-                        // ignore default value for binary
-                        out <<
-                            indent() << "return p." << field_name << " != nil" << endl;
-                    } else {
-                        s_check_value = (field_default_value == NULL) ? "\"\"" : render_const_value(type, field_default_value, tstruct_name);
-                        out <<
-                            indent() << "return p." << field_name << " != " << s_check_value << endl;
-                    }
+                indent() << storage.back() << " := p." << field_name << (type->is_list() ? "[:0]" : "") << endl <<
+                indent() << "if " << storage.back() << " == nil {" << endl <<
+                indent() << "  " << storage.back() << " = p.__spare" << field_name << endl <<
+                indent() << "}" << endl;
+        }
+    }
 
-                    break;
+    out <<
+        indent() << "*p = " << tstruct_name << "{TStruct: " << privatize(tstruct_name) << "TStruct}" << endl;
 
-                case t_base_type::TYPE_BOOL:
-                    s_check_value = (field_default_value != NULL && field_default_value->get_integer() > 0) ? "true" : "false";
-                    out <<
-                        indent() << "return p." << field_name << " != " << s_check_value << endl;
-                    break;
+    if (struct_reuse_) {
+        out <<
+            indent() << "p.__reuse = true" << endl;
+    }
 
-                case t_base_type::TYPE_BYTE:
-                case t_base_type::TYPE_I16:
-                case t_base_type::TYPE_I32:
-                case t_base_type::TYPE_I64:
-                    i_check_value = (field_default_value == NULL) ? 0 : field_default_value->get_integer();
-                    out <<
-                        indent() << "return p." << field_name << " != " << i_check_value << endl;
-                    break;
+    for (m_iter = members.begin(); m_iter != members.end(); ++m_iter) {
+        string field_name(publicize(variable_name_to_go_name(escape_string((*m_iter)->get_name()))));
+        bool is_enum = get_true_type((*m_iter)->get_type())->is_enum();
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*m_iter);
 
-                case t_base_type::TYPE_DOUBLE:
-                    d_check_value = (field_default_value == NULL) ? 0.0 : field_default_value->get_double();
-                    out <<
-                        indent() << "return p." << field_name << " != " << d_check_value << endl;
-                    break;
+        if ((*m_iter)->get_value() != NULL) {
+            out <<
+                indent() << "p." << field_name << " = " << render_field_default_value(*m_iter, (*m_iter)->get_name()) << endl;
 
-                default:
-                    throw "compiler error: no const of base type " + t_base_type::t_base_name(tbase);
-                }
-            } else if (type->is_enum()) {
-                out << indent() << "return int64(p." << field_name << ") != "
-                    << "math.MinInt32 - 1" << endl;
-            } else if (type->is_struct() || type->is_xception()) {
+            if (is_enum && bit != struct_isset_bits_.end()) {
                 out <<
-                    indent() << "return p." << field_name << " != nil" << endl;
-            } else if (type->is_list() || type->is_set()) {
-                if (field_default_value != NULL && field_default_value->get_list().size() > 0) {
-                    out <<
-                        indent() << "return p." << field_name << " != nil" << endl;
-                } else {
-                    out <<
-                        indent() << "return p." << field_name << " != nil && p." << field_name << ".Len() > 0" << endl;
-                }
-            } else if (type->is_map()) {
-                if (field_default_value != NULL && field_default_value->get_map().size() > 0) {
-                    out <<
-                        indent() << "return p." << field_name << " != nil" << endl;
-                } else {
-                    out <<
-                        indent() << "return p." << field_name << " != nil && p." << field_name << ".Len() > 0" << endl;
-                }
-            } else {
-                throw "CANNOT GENERATE ISSET HELPERS FOR TYPE: " + type->get_name();
+                    indent() << isset_bit("p.", bit->second, struct_isset_bits_.size(), "set") << endl;
             }
+        } else if (is_enum && bit == struct_isset_bits_.end()) {
+            out <<
+                indent() << "p." << field_name << " = math.MinInt32 - 1" << endl;
+        }
+    }
 
-            indent_down();
+    for (size_t i = 0; i < kept.size(); ++i) {
+        if (!get_true_type(kept[i]->get_type())->is_list()) {
+            string key(tmp("k"));
             out <<
-                indent() << "}" << endl << endl;
+                indent() << "for " << key << " := range " << storage[i] << " {" << endl <<
+                indent() << "  delete(" << storage[i] << ", " << key << ")" << endl <<
+                indent() << "}" << endl;
         }
+
+        out <<
+            indent() << "p.__spare" << publicize(variable_name_to_go_name(kept[i]->get_name())) << " = " << storage[i] << endl;
     }
+
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl;
 }
 
 /**
- * Generates the read method for a struct
+ * Generates EqualsT(), CompareTo() and Hash64(), which visit the fields of a
+ * struct in id order with code typed to each rather than through the
+ * interface{} values of thrift.TType.Compare().  Structs that are equal hash
+ * alike.  Native maps and sets have no order of their own, so CompareTo()
+ * orders two that differ by their hashes, or should those collide by the
+ * least key at which they differ.  Equals() keeps the signature of
+ * thrift.TStruct, which boxed containers of structs rely on.
  */
-void t_go_generator::generate_go_struct_reader(ofstream& out,
+void t_go_generator::generate_go_struct_equality(ofstream& out,
         t_struct* tstruct,
-        const string& tstruct_name,
-        bool is_result)
+        const string& tstruct_name)
 {
-    const vector<t_field*>& fields = tstruct->get_members();
+    const vector<t_field*>& fields = tstruct->get_sorted_members();
     vector<t_field*>::const_iterator f_iter;
-    string escaped_tstruct_name(escape_string(tstruct->get_name()));
-    out <<
-        indent() << "func (p *" << tstruct_name << ") Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
-    indent_up();
+    size_t count = struct_isset_bits_.size();
     out <<
-        indent() << "_, err = iprot.ReadStructBegin()" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err); }" << endl;
-    // Loop over reading in fields
-    indent(out) << "for {" << endl;
+        indent() << "func (p *" << tstruct_name << ") Equals(other interface{}) bool {" << endl <<
+        indent() << "  data, ok := other.(*" << tstruct_name << ")" << endl <<
+        indent() << "  return ok && p.EqualsT(data)" << endl <<
+        indent() << "}" << endl << endl <<
+        indent() << "func (p *" << tstruct_name << ") EqualsT(other *" << tstruct_name << ") bool {" << endl <<
+        indent() << "  if p == nil || other == nil {" << endl <<
+        indent() << "    return p == other" << endl <<
+        indent() << "  }" << endl;
     indent_up();
-    // Read beginning field marker
-    out <<
-        indent() << "fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()" << endl <<
-        indent() << "if fieldId < 0 {" << endl <<
-        indent() << "  fieldId = int16(p.FieldIdFromFieldName(fieldName))" << endl <<
-        indent() << "} else if fieldName == \"\" {" << endl <<
-        indent() << "  fieldName = p.FieldNameFromFieldId(int(fieldId))" << endl <<
-        indent() << "}" << endl <<
-        indent() << "if fieldTypeId == thrift.GENERIC {" << endl <<
-        indent() << "  fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()" << endl <<
-        indent() << "}" << endl <<
-        indent() << "if err != nil {" << endl <<
-        indent() << "  return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)" << endl <<
-        indent() << "}" << endl;
-    // Check for field STOP marker and break
-    out <<
-        indent() << "if fieldTypeId == thrift.STOP { break; }" << endl;
-    // Switch statement on the field we are reading
-    bool first = true;
-    string thriftFieldTypeId;
-    // Generate deserialization code for known cases
-    int32_t field_id = -1;
 
     for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
-        field_id = (*f_iter)->get_key();
+        string field_name(publicize(variable_name_to_go_name(escape_string((*f_iter)->get_name()))));
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
 
-        if (first) {
-            first = false;
-            indent(out);
-        } else {
-            indent(out) << "} else ";
-        }
-
-        out << "if fieldId == " << field_id << " || fieldName == \"" << escape_string((*f_iter)->get_name()) << "\" {" << endl;
-        indent_up();
-        thriftFieldTypeId = type_to_enum((*f_iter)->get_type());
-
-        if (thriftFieldTypeId == "thrift.BINARY") {
-            thriftFieldTypeId = "thrift.STRING";
+        if (bit == struct_isset_bits_.end()) {
+            generate_equals_value(out, (*f_iter)->get_type(), "p." + field_name, "other." + field_name);
+            continue;
         }
 
+        // The value of a tracked field only counts while it is set
+        string isset(isset_bit("p.", bit->second, count, "test"));
         out <<
-            indent() << "if fieldTypeId == " << thriftFieldTypeId << " {" << endl <<
-            indent() << "  err = p.ReadField" << field_id << "(iprot)" << endl <<
-            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl <<
-            indent() << "} else if fieldTypeId == thrift.VOID {" << endl <<
-            indent() << "  err = iprot.Skip(fieldTypeId)" << endl <<
-            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl <<
-            indent() << "} else {" << endl <<
-            indent() << "  err = p.ReadField" << field_id << "(iprot)" << endl <<
-            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl <<
-            indent() << "}" << endl;
+            indent() << "if (" << isset << ") != (" << isset_bit("other.", bit->second, count, "test") << ") {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl <<
+            indent() << "if " << isset << " {" << endl;
+        indent_up();
+        generate_equals_value(out, (*f_iter)->get_type(), "p." + field_name, "other." + field_name);
         indent_down();
-    }
-
-    // In the default case we skip the field
-    if (first) {
-        out <<
-            indent() << "err = iprot.Skip(fieldTypeId)" << endl <<
-            indent() << "if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl;
-    } else {
         out <<
-            indent() << "} else {" << endl <<
-            indent() << "  err = iprot.Skip(fieldTypeId)" << endl <<
-            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl <<
             indent() << "}" << endl;
     }
 
-    // Read field end marker
-    out <<
-        indent() << "err = iprot.ReadFieldEnd()" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl;
-    indent_down();
     out <<
-        indent() << "}" << endl <<
-        indent() << "err = iprot.ReadStructEnd()" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err); }" << endl <<
-        indent() << "return err" << endl;
+        indent() << "return true" << endl;
     indent_down();
     out <<
-        indent() << "}" << endl << endl;
+        indent() << "}" << endl << endl <<
+        indent() << "func (p *" << tstruct_name << ") CompareTo(other interface{}) (int, bool) {" << endl <<
+        indent() << "  if other == nil {" << endl <<
+        indent() << "    return 1, true" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  data, ok := other.(*" << tstruct_name << ")" << endl <<
+        indent() << "  if !ok {" << endl <<
+        indent() << "    return 0, false" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  if p == nil || data == nil {" << endl <<
+        indent() << "    if p == data {" << endl <<
+        indent() << "      return 0, true" << endl <<
+        indent() << "    }" << endl <<
+        indent() << "    if p == nil {" << endl <<
+        indent() << "      return -1, true" << endl <<
+        indent() << "    }" << endl <<
+        indent() << "    return 1, true" << endl <<
+        indent() << "  }" << endl;
+    indent_up();
 
     for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
-        string field_type_name(publicize((*f_iter)->get_type()->get_name()));
-        string field_name(publicize((*f_iter)->get_name()));
-        int32_t field_id = (*f_iter)->get_key();
+        string field_name(publicize(variable_name_to_go_name(escape_string((*f_iter)->get_name()))));
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
+
+        if (bit == struct_isset_bits_.end()) {
+            generate_compare_value(out, (*f_iter)->get_type(), "p." + field_name, "data." + field_name);
+            continue;
+        }
+
+        // An unset field comes before a set one
+        string isset(isset_bit("p.", bit->second, count, "test"));
+        string pset(tmp("pset"));
+        string dset(tmp("dset"));
         out <<
-            indent() << "func (p *" << tstruct_name << ") ReadField" << field_id << "(iprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
+            indent() << "if " << pset << ", " << dset << " := " << isset << ", " << isset_bit("data.", bit->second, count, "test") << "; " << pset << " != " << dset << " {" << endl <<
+            indent() << "  if " << dset << " {" << endl <<
+            indent() << "    return -1, true" << endl <<
+            indent() << "  }" << endl <<
+            indent() << "  return 1, true" << endl <<
+            indent() << "}" << endl <<
+            indent() << "if " << isset << " {" << endl;
         indent_up();
-        generate_deserialize_field(out, *f_iter, false, "p.");
+        generate_compare_value(out, (*f_iter)->get_type(), "p." + field_name, "data." + field_name);
         indent_down();
         out <<
-            indent() << "  return err" << endl <<
-            indent() << "}" << endl << endl <<
-            indent() << "func (p *" << tstruct_name << ") ReadField" << field_name << "(iprot thrift.TProtocol) (thrift.TProtocolException) {" << endl <<
-            indent() << "  return p.ReadField" << field_id << "(iprot)" << endl <<
-            indent() << "}" << endl << endl;
+            indent() << "}" << endl;
     }
-}
 
-void t_go_generator::generate_go_struct_writer(ofstream& out,
-        t_struct* tstruct,
-        const string& tstruct_name,
-        bool is_result)
-{
-    string name(tstruct->get_name());
-    const vector<t_field*>& fields = tstruct->get_sorted_members();
-    vector<t_field*>::const_iterator f_iter;
-    indent(out) <<
-                "func (p *" << tstruct_name << ") Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
-    indent_up();
     out <<
-        indent() << "err = oprot.WriteStructBegin(\"" << name << "\")" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteStruct(" <<
-        "p.ThriftName(), err); }" << endl;
-    string field_name;
-    string escape_field_name;
-    t_const_value* field_default_value;
-    t_field::e_req field_required;
-    bool field_can_be_nil = false;
-    int32_t fieldId = -1;
-
-    if (is_result && fields.size()) {
-        out <<
-            indent() << "switch {" << endl;
-        vector<t_field*>::const_reverse_iterator fr_iter;
+        indent() << "return 0, true" << endl;
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl <<
+        indent() << "func (p *" << tstruct_name << ") Hash64() uint64 {" << endl <<
+        indent() << "  if p == nil {" << endl <<
+        indent() << "    return 0" << endl <<
+        indent() << "  }" << endl <<
+        indent() << "  h := thrift.HashSeed" << endl;
+    indent_up();
 
-        for (fr_iter = fields.rbegin(); fr_iter != fields.rend(); ++fr_iter) {
-            field_name = (*fr_iter)->get_name();
-            fieldId = (*fr_iter)->get_key();
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        string field_name(publicize(variable_name_to_go_name(escape_string((*f_iter)->get_name()))));
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
 
-            if (can_be_nil((*fr_iter)->get_type()) && fieldId != 0) {
-                out <<
-                    indent() << "case p." << publicize(variable_name_to_go_name(field_name)) << " != nil:" << endl <<
-                    indent() << "  if err = p.WriteField" << fieldId << "(oprot); err != nil {" << endl <<
-                    indent() << "    return err" << endl <<
-                    indent() << "  }" << endl;
-            } else {
-                out <<
-                    indent() << "default:" << endl <<
-                    indent() << "  if err = p.WriteField" << fieldId << "(oprot); err != nil {" << endl <<
-                    indent() << "    return err" << endl <<
-                    indent() << "  }" << endl;
-            }
+        if (bit == struct_isset_bits_.end()) {
+            generate_hash_value(out, (*f_iter)->get_type(), "p." + field_name, "h");
+            continue;
         }
 
+        string isset(isset_bit("p.", bit->second, count, "test"));
+        out <<
+            indent() << "h = thrift.HashBool(h, " << isset << ")" << endl <<
+            indent() << "if " << isset << " {" << endl;
+        indent_up();
+        generate_hash_value(out, (*f_iter)->get_type(), "p." + field_name, "h");
+        indent_down();
         out <<
             indent() << "}" << endl;
-    } else {
-        for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
-            field_name = (*f_iter)->get_name();
-            escape_field_name = escape_string(field_name);
-            fieldId = (*f_iter)->get_key();
-            out <<
-                indent() << "err = p.WriteField" << fieldId << "(oprot)" << endl <<
-                indent() << "if err != nil { return err }" << endl;
-        }
     }
 
-    // Write the struct map
     out <<
-        indent() << "err = oprot.WriteFieldStop()" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(-1, \"STOP\", p.ThriftName(), err); }" << endl <<
-        indent() << "err = oprot.WriteStructEnd()" << endl <<
-        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteStruct(" <<
-        "p.ThriftName(), err); }" << endl <<
-        indent() << "return err" << endl;
+        indent() << "return h" << endl;
     indent_down();
     out <<
         indent() << "}" << endl << endl;
+}
+
+/**
+ * Generates the statements returning false from EqualsT() unless a and b,
+ * of type ttype, are equal.  by_value is set where a and b are elements of
+ * a value list, which hold structs rather than pointers to them.
+ */
+void t_go_generator::generate_equals_value(ofstream& out,
+        t_type* ttype,
+        const string& a,
+        const string& b,
+        bool by_value)
+{
+    t_type* type = get_true_type(ttype);
+
+    if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << "if !" << a << ".EqualsT(" << (by_value ? "&" : "") << b << ") {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl;
+    } else if (type->is_container() && !gen_native_containers_) {
+        out <<
+            indent() << "if c, ok := thrift.TType(" << type_to_enum(type) << ").Compare(" << a << ", " << b << "); c != 0 || !ok {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl;
+    } else if (type->is_container()) {
+        // A nil container is written as no field at all, and an empty one
+        // is not
+        out <<
+            indent() << "if len(" << a << ") != len(" << b << ") || (" << a << " == nil) != (" << b << " == nil) {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl;
+
+        if (type->is_list()) {
+            string i(tmp("i"));
+            out <<
+                indent() << "for " << i << " := range " << a << " {" << endl;
+            indent_up();
+            generate_equals_value(out, ((t_list*)type)->get_elem_type(), a + "[" + i + "]", b + "[" + i + "]", is_value_list(type));
+            indent_down();
+        } else if (type->is_set()) {
+            string k(tmp("k"));
+            out <<
+                indent() << "for " << k << " := range " << a << " {" << endl <<
+                indent() << "  if _, ok := " << b << "[" << k << "]; !ok {" << endl <<
+                indent() << "    return false" << endl <<
+                indent() << "  }" << endl;
+        } else {
+            string k(tmp("k"));
+            string v(tmp("v"));
+            string w(tmp("w"));
+            out <<
+                indent() << "for " << k << ", " << v << " := range " << a << " {" << endl <<
+                indent() << "  " << w << ", ok := " << b << "[" << k << "]" << endl <<
+                indent() << "  if !ok {" << endl <<
+                indent() << "    return false" << endl <<
+                indent() << "  }" << endl;
+            indent_up();
+            generate_equals_value(out, ((t_map*)type)->get_val_type(), v, w);
+            indent_down();
+        }
+
+        out <<
+            indent() << "}" << endl;
+    } else if (type->is_base_type() && ((t_base_type*)type)->is_binary()) {
+        out <<
+            indent() << "if thrift.CompareBytes(" << a << ", " << b << ") != 0 {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl;
+    } else {
+        out <<
+            indent() << "if " << a << " != " << b << " {" << endl <<
+            indent() << "  return false" << endl <<
+            indent() << "}" << endl;
+    }
+}
+
+/**
+ * Generates the statements returning from CompareTo() with the order of a
+ * and b, of type ttype, should they differ.
+ */
+void t_go_generator::generate_compare_value(ofstream& out,
+        t_type* ttype,
+        const string& a,
+        const string& b,
+        bool by_value)
+{
+    t_type* type = get_true_type(ttype);
+
+    if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << "if c, ok := " << a << ".CompareTo(" << (by_value ? "&" : "") << b << "); c != 0 || !ok {" << endl <<
+            indent() << "  return c, ok" << endl <<
+            indent() << "}" << endl;
+    } else if (type->is_container() && !gen_native_containers_) {
+        out <<
+            indent() << "if c, ok := thrift.TType(" << type_to_enum(type) << ").Compare(" << a << ", " << b << "); c != 0 || !ok {" << endl <<
+            indent() << "  return c, ok" << endl <<
+            indent() << "}" << endl;
+    } else if (type->is_container()) {
+        // A nil container comes before an empty one, as with
+        // thrift.CompareBytes()
+        out <<
+            indent() << "if (" << a << " == nil) != (" << b << " == nil) {" << endl <<
+            indent() << "  if " << a << " == nil {" << endl <<
+            indent() << "    return -1, true" << endl <<
+            indent() << "  }" << endl <<
+            indent() << "  return 1, true" << endl <<
+            indent() << "}" << endl <<
+            indent() << "if len(" << a << ") != len(" << b << ") {" << endl <<
+            indent() << "  if len(" << a << ") < len(" << b << ") {" << endl <<
+            indent() << "    return -1, true" << endl <<
+            indent() << "  }" << endl <<
+            indent() << "  return 1, true" << endl <<
+            indent() << "}" << endl;
+
+        if (type->is_list()) {
+            string i(tmp("i"));
+            out <<
+                indent() << "for " << i << " := range " << a << " {" << endl;
+            indent_up();
+            generate_compare_value(out, ((t_list*)type)->get_elem_type(), a + "[" + i + "]", b + "[" + i + "]", is_value_list(type));
+            indent_down();
+            out <<
+                indent() << "}" << endl;
+        } else {
+            string ha(tmp("ha"));
+            string hb(tmp("hb"));
+            out <<
+                indent() << ha << ", " << hb << " := thrift.HashSeed, thrift.HashSeed" << endl;
+            generate_hash_value(out, type, a, ha);
+            generate_hash_value(out, type, b, hb);
+            out <<
+                indent() << "if " << ha << " != " << hb << " {" << endl <<
+                indent() << "  if " << ha << " < " << hb << " {" << endl <<
+                indent() << "    return -1, true" << endl <<
+                indent() << "  }" << endl <<
+                indent() << "  return 1, true" << endl <<
+                indent() << "}" << endl;
+            // Should the hashes collide, the least key at which the two
+            // differ decides, the one holding it coming after
+            t_type* ktype = type->is_set() ? ((t_set*)type)->get_elem_type() : ((t_map*)type)->get_key_type();
+            bool is_bool = get_true_type(ktype)->is_base_type() && ((t_base_type*)get_true_type(ktype))->get_base() == t_base_type::TYPE_BOOL;
+            string least(tmp("least"));
+            string found(tmp("found"));
+            string k(tmp("k"));
+            string v(tmp("v"));
+            string w(tmp("w"));
+            string skip("if " + found + " && !(" + (is_bool ? "!" + k + " && " + least : k + " < " + least) + ") {");
+            out <<
+                indent() << "var " << least << " " << type_to_go_key_type(ktype) << endl <<
+                indent() << found << " := false" << endl;
+
+            if (type->is_set()) {
+                out <<
+                    indent() << "for " << k << " := range " << a << " {" << endl <<
+                    indent() << "  " << skip << endl <<
+                    indent() << "    continue" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "  if _, ok := " << b << "[" << k << "]; !ok {" << endl <<
+                    indent() << "    " << least << ", " << found << " = " << k << ", true" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "}" << endl;
+            } else {
+                out <<
+                    indent() << "for " << k << ", " << v << " := range " << a << " {" << endl <<
+                    indent() << "  " << skip << endl <<
+                    indent() << "    continue" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "  if " << w << ", ok := " << b << "[" << k << "]; ok {" << endl <<
+                    indent() << "    if c, _ := func() (int, bool) {" << endl;
+                indent_up();
+                indent_up();
+                indent_up();
+                generate_compare_value(out, ((t_map*)type)->get_val_type(), v, w);
+                out <<
+                    indent() << "return 0, true" << endl;
+                indent_down();
+                indent_down();
+                indent_down();
+                out <<
+                    indent() << "    }(); c == 0 {" << endl <<
+                    indent() << "      continue" << endl <<
+                    indent() << "    }" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "  " << least << ", " << found << " = " << k << ", true" << endl <<
+                    indent() << "}" << endl;
+            }
+
+            out <<
+                indent() << "for " << k << " := range " << b << " {" << endl <<
+                indent() << "  " << skip << endl <<
+                indent() << "    continue" << endl <<
+                indent() << "  }" << endl <<
+                indent() << "  if _, ok := " << a << "[" << k << "]; !ok {" << endl <<
+                indent() << "    " << least << ", " << found << " = " << k << ", true" << endl <<
+                indent() << "  }" << endl <<
+                indent() << "}" << endl <<
+                indent() << "if " << found << " {" << endl;
+
+            if (type->is_set()) {
+                out <<
+                    indent() << "  if _, ok := " << a << "[" << least << "]; ok {" << endl <<
+                    indent() << "    return 1, true" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "  return -1, true" << endl;
+            } else {
+                out <<
+                    indent() << "  " << v << ", inA := " << a << "[" << least << "]" << endl <<
+                    indent() << "  " << w << ", inB := " << b << "[" << least << "]" << endl <<
+                    indent() << "  if !inB {" << endl <<
+                    indent() << "    return 1, true" << endl <<
+                    indent() << "  }" << endl <<
+                    indent() << "  if !inA {" << endl <<
+                    indent() << "    return -1, true" << endl <<
+                    indent() << "  }" << endl;
+                indent_up();
+                generate_compare_value(out, ((t_map*)type)->get_val_type(), v, w);
+                indent_down();
+            }
+
+            out <<
+                indent() << "}" << endl;
+        }
+    } else if (type->is_base_type() && ((t_base_type*)type)->is_binary()) {
+        out <<
+            indent() << "if c := thrift.CompareBytes(" << a << ", " << b << "); c != 0 {" << endl <<
+            indent() << "  return c, true" << endl <<
+            indent() << "}" << endl;
+    } else {
+        bool is_bool = type->is_base_type() && ((t_base_type*)type)->get_base() == t_base_type::TYPE_BOOL;
+        out <<
+            indent() << "if " << a << " != " << b << " {" << endl <<
+            indent() << "  if " << (is_bool ? b : a + " < " + b) << " {" << endl <<
+            indent() << "    return -1, true" << endl <<
+            indent() << "  }" << endl <<
+            indent() << "  return 1, true" << endl <<
+            indent() << "}" << endl;
+    }
+}
+
+/**
+ * Generates the statements folding value, of type ttype, into the hash h.
+ * is_key is set for the keys of native maps and elements of native sets,
+ * which hold binary values as strings.  The entries of those are hashed
+ * apart and summed, so that the order they are visited in does not matter.
+ */
+void t_go_generator::generate_hash_value(ofstream& out,
+        t_type* ttype,
+        const string& value,
+        const string& h,
+        bool is_key)
+{
+    t_type* type = get_true_type(ttype);
+
+    if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << h << " = thrift.HashUint64(" << h << ", " << value << ".Hash64())" << endl;
+    } else if (type->is_container() && !gen_native_containers_) {
+        // Equal boxed containers share no more than their length
+        out <<
+            indent() << "if " << value << " != nil {" << endl <<
+            indent() << "  " << h << " = thrift.HashInt64(" << h << ", int64(" << value << ".Len()))" << endl <<
+            indent() << "}" << endl;
+    } else if (type->is_container()) {
+        // As EqualsT() tells a nil container from an empty one
+        out <<
+            indent() << "if " << value << " != nil {" << endl <<
+            indent() << "  " << h << " = thrift.HashInt64(" << h << ", int64(len(" << value << ")))" << endl <<
+            indent() << "}" << endl;
+
+        if (type->is_list()) {
+            string i(tmp("i"));
+            out <<
+                indent() << "for " << i << " := range " << value << " {" << endl;
+            indent_up();
+            generate_hash_value(out, ((t_list*)type)->get_elem_type(), value + "[" + i + "]", h);
+            indent_down();
+            out <<
+                indent() << "}" << endl;
+        } else {
+            string sum(tmp("sum"));
+            string e(tmp("e"));
+            string k(tmp("k"));
+            string v(tmp("v"));
+            out <<
+                indent() << sum << " := uint64(0)" << endl;
+
+            if (type->is_set()) {
+                out <<
+                    indent() << "for " << k << " := range " << value << " {" << endl;
+            } else {
+                out <<
+                    indent() << "for " << k << ", " << v << " := range " << value << " {" << endl;
+            }
+
+            indent_up();
+            out <<
+                indent() << e << " := thrift.HashSeed" << endl;
+
+            if (type->is_set()) {
+                generate_hash_value(out, ((t_set*)type)->get_elem_type(), k, e, true);
+            } else {
+                generate_hash_value(out, ((t_map*)type)->get_key_type(), k, e, true);
+                generate_hash_value(out, ((t_map*)type)->get_val_type(), v, e);
+            }
+
+            out <<
+                indent() << sum << " += " << e << endl;
+            indent_down();
+            out <<
+                indent() << "}" << endl <<
+                indent() << h << " = thrift.HashUint64(" << h << ", " << sum << ")" << endl;
+        }
+    } else if (type->is_enum()) {
+        out <<
+            indent() << h << " = thrift.HashInt64(" << h << ", int64(" << value << "))" << endl;
+    } else {
+        t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+        string hash;
+
+        switch (tbase) {
+        case t_base_type::TYPE_STRING:
+            hash = ((t_base_type*)type)->is_binary() && !is_key ? "HashBytes(" : "HashString(";
+            break;
+
+        case t_base_type::TYPE_BOOL:
+            hash = "HashBool(";
+            break;
+
+        case t_base_type::TYPE_DOUBLE:
+            hash = "HashDouble(";
+            break;
+
+        default:
+            hash = "HashInt64(";
+            break;
+        }
+
+        out <<
+            indent() << h << " = thrift." << hash << h << ", " << (hash == "HashInt64(" ? "int64(" + value + ")" : value) << ")" << endl;
+    }
+}
+
+/**
+ * Generates the IsSet helper methods for a struct
+ */
+void t_go_generator::generate_isset_helpers(ofstream& out,
+        t_struct* tstruct,
+        const string& tstruct_name,
+        bool is_result)
+{
+    const vector<t_field*>& fields = tstruct->get_members();
+    vector<t_field*>::const_iterator f_iter;
+    const string escaped_tstruct_name(escape_string(tstruct->get_name()));
+
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        t_type* type = get_true_type((*f_iter)->get_type());
+
+        if ((*f_iter)->get_req() == t_field::T_OPTIONAL || type->is_enum()) {
+            const string field_name(publicize(variable_name_to_go_name(escape_string((*f_iter)->get_name()))));
+            t_const_value* field_default_value = (*f_iter)->get_value();
+            std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
+
+            if (bit != struct_isset_bits_.end()) {
+                size_t count = struct_isset_bits_.size();
+                out <<
+                    indent() << "func (p *" << tstruct_name << ") IsSet" << field_name << "() bool {" << endl <<
+                    indent() << "  return " << isset_bit("p.", bit->second, count, "test") << endl <<
+                    indent() << "}" << endl << endl <<
+                    indent() << "func (p *" << tstruct_name << ") Set" << field_name << "(value " << type_to_go_type((*f_iter)->get_type()) << ") {" << endl <<
+                    indent() << "  p." << field_name << " = value" << endl <<
+                    indent() << "  " << isset_bit("p.", bit->second, count, "set") << endl <<
+                    indent() << "}" << endl << endl <<
+                    indent() << "func (p *" << tstruct_name << ") Unset" << field_name << "() {" << endl <<
+                    indent() << "  " << isset_bit("p.", bit->second, count, "clear") << endl <<
+                    indent() << "}" << endl << endl;
+                continue;
+            }
+
+            out <<
+                indent() << "func (p *" << tstruct_name << ") IsSet" << field_name << "() bool {" << endl;
+            indent_up();
+            string s_check_value;
+            int64_t i_check_value;
+            double d_check_value;
+
+            if (type->is_base_type()) {
+                t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+
+                switch (tbase) {
+                case t_base_type::TYPE_STRING:
+                    if (((t_base_type*)type)->is_binary()) {
+                        // ignore default value for binary
+                        out <<
+                            indent() << "return p." << field_name << " != nil";
+
+                        if (is_streamed(*f_iter)) {
+                            out << " || p." << field_name << "Stream.IsSet()";
+                        }
+
+                        out << endl;
+                    } else {
+                        s_check_value = (field_default_value == NULL) ? "\"\"" : render_const_value(type, field_default_value, tstruct_name);
+                        out <<
+                            indent() << "return p." << field_name << " != " << s_check_value << endl;
+                    }
+
+                    break;
+
+                case t_base_type::TYPE_BOOL:
+                    s_check_value = (field_default_value != NULL && field_default_value->get_integer() > 0) ? "true" : "false";
+                    out <<
+                        indent() << "return p." << field_name << " != " << s_check_value << endl;
+                    break;
+
+                case t_base_type::TYPE_BYTE:
+                case t_base_type::TYPE_I16:
+                case t_base_type::TYPE_I32:
+                case t_base_type::TYPE_I64:
+                    i_check_value = (field_default_value == NULL) ? 0 : field_default_value->get_integer();
+                    out <<
+                        indent() << "return p." << field_name << " != " << i_check_value << endl;
+                    break;
+
+                case t_base_type::TYPE_DOUBLE:
+                    d_check_value = (field_default_value == NULL) ? 0.0 : field_default_value->get_double();
+                    out <<
+                        indent() << "return p." << field_name << " != " << d_check_value << endl;
+                    break;
+
+                default:
+                    throw "compiler error: no const of base type " + t_base_type::t_base_name(tbase);
+                }
+            } else if (type->is_enum()) {
+                out << indent() << "return int64(p." << field_name << ") != "
+                    << "math.MinInt32 - 1" << endl;
+            } else if (type->is_struct() || type->is_xception()) {
+                out <<
+                    indent() << "return p." << field_name << " != nil" << endl;
+            } else if (type->is_list() || type->is_set()) {
+                if (field_default_value != NULL && field_default_value->get_list().size() > 0) {
+                    out <<
+                        indent() << "return p." << field_name << " != nil" << endl;
+                } else if (gen_native_containers_) {
+                    out <<
+                        indent() << "return len(p." << field_name << ") > 0" << endl;
+                } else {
+                    out <<
+                        indent() << "return p." << field_name << " != nil && p." << field_name << ".Len() > 0" << endl;
+                }
+            } else if (type->is_map()) {
+                if (field_default_value != NULL && field_default_value->get_map().size() > 0) {
+                    out <<
+                        indent() << "return p." << field_name << " != nil" << endl;
+                } else if (gen_native_containers_) {
+                    out <<
+                        indent() << "return len(p." << field_name << ") > 0" << endl;
+                } else {
+                    out <<
+                        indent() << "return p." << field_name << " != nil && p." << field_name << ".Len() > 0" << endl;
+                }
+            } else {
+                throw "CANNOT GENERATE ISSET HELPERS FOR TYPE: " + type->get_name();
+            }
+
+            indent_down();
+            out <<
+                indent() << "}" << endl << endl;
+        }
+    }
+}
+
+/**
+ * Generates the read method for a struct
+ */
+void t_go_generator::generate_go_struct_reader(ofstream& out,
+        t_struct* tstruct,
+        const string& tstruct_name,
+        bool is_result)
+{
+    const vector<t_field*>& fields = tstruct->get_members();
+    vector<t_field*>::const_iterator f_iter;
+    string escaped_tstruct_name(escape_string(tstruct->get_name()));
+    out <<
+        indent() << "func (p *" << tstruct_name << ") Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
+    indent_up();
+    out <<
+        indent() << "_, err = iprot.ReadStructBegin()" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err); }" << endl;
+    // Loop over reading in fields
+    indent(out) << "for {" << endl;
+    indent_up();
+    // Read beginning field marker.  Only the JSON protocols hand back names
+    // instead of ids, so names are resolved just for them.
+    out <<
+        indent() << "fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()" << endl <<
+        indent() << "if fieldId < 0 {" << endl <<
+        indent() << "  fieldId = int16(p.FieldIdFromFieldName(fieldName))" << endl <<
+        indent() << "}" << endl <<
+        indent() << "if fieldTypeId == thrift.GENERIC {" << endl <<
+        indent() << "  fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()" << endl <<
+        indent() << "}" << endl <<
+        indent() << "if err != nil {" << endl <<
+        indent() << "  return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)" << endl <<
+        indent() << "}" << endl;
+    // Check for field STOP marker and break
+    out <<
+        indent() << "if fieldTypeId == thrift.STOP { break; }" << endl;
+    // Switch statement on the field we are reading
+    indent(out) << "switch fieldId {" << endl;
+
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        int32_t field_id = (*f_iter)->get_key();
+        indent(out) << "case " << field_id << ":" << endl;
+        indent_up();
+        out <<
+            indent() << "if fieldTypeId == thrift.VOID {" << endl <<
+            indent() << "  err = iprot.Skip(fieldTypeId)" << endl <<
+            indent() << "} else {" << endl <<
+            indent() << "  err = p.ReadField" << field_id << "(iprot)" << endl <<
+            indent() << "}" << endl <<
+            indent() << "if err != nil { return thrift.NewTProtocolExceptionReadField(" << field_id << ", \"" << escape_string((*f_iter)->get_name()) << "\", p.ThriftName(), err); }" << endl;
+        indent_down();
+    }
+
+    // In the default case we skip the field
+    out <<
+        indent() << "default:" << endl <<
+        indent() << "  err = iprot.Skip(fieldTypeId)" << endl <<
+        indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl <<
+        indent() << "}" << endl;
+
+    // Read field end marker
+    out <<
+        indent() << "err = iprot.ReadFieldEnd()" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err); }" << endl;
+    indent_down();
+    out <<
+        indent() << "}" << endl <<
+        indent() << "err = iprot.ReadStructEnd()" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err); }" << endl;
+
+    if (struct_reuse_) {
+        out <<
+            indent() << "p.__reuse = false" << endl;
+    }
+
+    out <<
+        indent() << "return err" << endl;
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl;
+
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        string field_type_name(publicize((*f_iter)->get_type()->get_name()));
+        string field_name(publicize((*f_iter)->get_name()));
+        int32_t field_id = (*f_iter)->get_key();
+        out <<
+            indent() << "func (p *" << tstruct_name << ") ReadField" << field_id << "(iprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
+        indent_up();
+        generate_deserialize_field(out, *f_iter, false, "p.");
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
+
+        if (bit != struct_isset_bits_.end()) {
+            out <<
+                indent() << isset_bit("p.", bit->second, struct_isset_bits_.size(), "set") << endl;
+        }
+
+        indent_down();
+        out <<
+            indent() << "  return err" << endl <<
+            indent() << "}" << endl << endl <<
+            indent() << "func (p *" << tstruct_name << ") ReadField" << field_name << "(iprot thrift.TProtocol) (thrift.TProtocolException) {" << endl <<
+            indent() << "  return p.ReadField" << field_id << "(iprot)" << endl <<
+            indent() << "}" << endl << endl;
+    }
+}
+
+void t_go_generator::generate_go_struct_writer(ofstream& out,
+        t_struct* tstruct,
+        const string& tstruct_name,
+        bool is_result)
+{
+    string name(tstruct->get_name());
+    const vector<t_field*>& fields = tstruct->get_sorted_members();
+    vector<t_field*>::const_iterator f_iter;
+    indent(out) <<
+                "func (p *" << tstruct_name << ") Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
+    indent_up();
+    out <<
+        indent() << "err = oprot.WriteStructBegin(\"" << name << "\")" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteStruct(" <<
+        "p.ThriftName(), err); }" << endl;
+    string field_name;
+    string escape_field_name;
+    t_const_value* field_default_value;
+    t_field::e_req field_required;
+    bool field_can_be_nil = false;
+    int32_t fieldId = -1;
+
+    if (is_result && fields.size()) {
+        out <<
+            indent() << "switch {" << endl;
+        vector<t_field*>::const_reverse_iterator fr_iter;
+
+        for (fr_iter = fields.rbegin(); fr_iter != fields.rend(); ++fr_iter) {
+            field_name = (*fr_iter)->get_name();
+            fieldId = (*fr_iter)->get_key();
+
+            if (can_be_nil((*fr_iter)->get_type()) && fieldId != 0) {
+                out <<
+                    indent() << "case p." << publicize(variable_name_to_go_name(field_name)) << " != nil:" << endl <<
+                    indent() << "  if err = p.WriteField" << fieldId << "(oprot); err != nil {" << endl <<
+                    indent() << "    return err" << endl <<
+                    indent() << "  }" << endl;
+            } else {
+                out <<
+                    indent() << "default:" << endl <<
+                    indent() << "  if err = p.WriteField" << fieldId << "(oprot); err != nil {" << endl <<
+                    indent() << "    return err" << endl <<
+                    indent() << "  }" << endl;
+            }
+        }
+
+        out <<
+            indent() << "}" << endl;
+    } else {
+        for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+            field_name = (*f_iter)->get_name();
+            escape_field_name = escape_string(field_name);
+            fieldId = (*f_iter)->get_key();
+            out <<
+                indent() << "err = p.WriteField" << fieldId << "(oprot)" << endl <<
+                indent() << "if err != nil { return err }" << endl;
+        }
+    }
+
+    // Write the struct map
+    out <<
+        indent() << "err = oprot.WriteFieldStop()" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(-1, \"STOP\", p.ThriftName(), err); }" << endl <<
+        indent() << "err = oprot.WriteStructEnd()" << endl <<
+        indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteStruct(" <<
+        "p.ThriftName(), err); }" << endl <<
+        indent() << "return err" << endl;
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl;
+
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        fieldId = (*f_iter)->get_key();
+        field_name = (*f_iter)->get_name();
+        escape_field_name = escape_string(field_name);
+        field_default_value = (*f_iter)->get_value();
+        field_required = (*f_iter)->get_req();
+        field_can_be_nil = can_be_nil((*f_iter)->get_type());
+        out <<
+            indent() << "func (p *" << tstruct_name << ") WriteField" << fieldId << "(oprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
+        indent_up();
 
-    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
-        fieldId = (*f_iter)->get_key();
-        field_name = (*f_iter)->get_name();
-        escape_field_name = escape_string(field_name);
-        field_default_value = (*f_iter)->get_value();
-        field_required = (*f_iter)->get_req();
-        field_can_be_nil = can_be_nil((*f_iter)->get_type());
-        out <<
-            indent() << "func (p *" << tstruct_name << ") WriteField" << fieldId << "(oprot thrift.TProtocol) (err thrift.TProtocolException) {" << endl;
-        indent_up();
-
         // Write field header
+        if (field_can_be_nil && is_streamed(*f_iter)) {
+            out <<
+                indent() << "if p." << publicize(variable_name_to_go_name(field_name)) << " != nil || p." <<
+                publicize(variable_name_to_go_name(field_name)) << "Stream.IsSet() {" << endl;
+            indent_up();
+        } else if (field_can_be_nil) {
+            out <<
+                indent() << "if p." << publicize(variable_name_to_go_name(field_name)) << " != nil {" << endl;
+            indent_up();
+        }
+
+        if (field_required == t_field::T_OPTIONAL || (*f_iter)->get_type()->is_enum()) {
+            out <<
+                indent() << "if p.IsSet" << publicize(variable_name_to_go_name(field_name)) << "() {" << endl;
+            indent_up();
+        }
+
+        out <<
+            indent() << "err = oprot.WriteFieldBegin(\"" <<
+            escape_field_name << "\", " <<
+            type_to_enum((*f_iter)->get_type()) << ", " <<
+            fieldId << ")" << endl <<
+            indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(" <<
+            fieldId << ", \"" <<
+            escape_field_name << "\", " <<
+            "p.ThriftName(), err); }" << endl;
+        // Write field contents
+        generate_serialize_field(out, *f_iter, "p.");
+        // Write field closer
+        out <<
+            indent() << "err = oprot.WriteFieldEnd()" << endl <<
+            indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(" <<
+            fieldId << ", \"" <<
+            escape_field_name << "\", " <<
+            "p.ThriftName(), err); }" << endl;
+
+        if (field_required == t_field::T_OPTIONAL || (*f_iter)->get_type()->is_enum()) {
+            indent_down();
+            out <<
+                indent() << "}" << endl;
+        }
+
         if (field_can_be_nil) {
+            indent_down();
+            out <<
+                indent() << "}" << endl;
+        }
+
+        indent_down();
+        out <<
+            indent() << "  return err" << endl <<
+            indent() << "}" << endl << endl <<
+            indent() << "func (p *" << tstruct_name << ") WriteField" << publicize(field_name) << "(oprot thrift.TProtocol) (thrift.TProtocolException) {" << endl <<
+            indent() << "  return p.WriteField" << fieldId << "(oprot)" << endl <<
+            indent() << "}" << endl << endl;
+    }
+}
+
+/**
+ * Generates Marshal<proto>Thrift(), Unmarshal<proto>Thrift(),
+ * Decode<proto>Thrift() and <proto>Size() for a struct, where proto is
+ * "Binary" or "Compact".  These produce, consume and measure the same bytes
+ * as Write() and Read() over a TBinaryProtocol or TCompactProtocol, but work
+ * on a byte slice directly instead of calling through TProtocol for every
+ * value.
+ */
+void t_go_generator::generate_go_struct_codec(ofstream& out,
+        t_struct* tstruct,
+        const string& tstruct_name,
+        bool is_result,
+        const string& proto)
+{
+    const vector<t_field*>& fields = tstruct->get_sorted_members();
+    vector<t_field*>::const_iterator f_iter;
+    bool compact = proto == "Compact";
+    generate_go_struct_marshal(out, tstruct, tstruct_name, is_result, proto, true);
+    generate_go_struct_marshal(out, tstruct, tstruct_name, is_result, proto, false);
+    out <<
+        indent() << "func (p *" << tstruct_name << ") Unmarshal" << proto << "Thrift(data []byte) error {" << endl <<
+        indent() << "  return p.Decode" << proto << "Thrift(thrift.NewT" << proto << "Decoder(data))" << endl <<
+        indent() << "}" << endl << endl <<
+        indent() << "func (p *" << tstruct_name << ") Decode" << proto << "Thrift(d *thrift.T" << proto << "Decoder) thrift.TProtocolException {" << endl;
+    indent_up();
+
+
+    if (compact) {
+        out <<
+            indent() << "for fieldId := int16(0); ; {" << endl <<
+            indent() << "  fieldTypeId, id, err := d.ReadFieldBegin(fieldId)" << endl <<
+            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(id), \"\", p.ThriftName(), err) }" << endl <<
+            indent() << "  if fieldTypeId == thrift.STOP { break }" << endl <<
+            indent() << "  fieldId = id" << endl;
+    } else {
+        out <<
+            indent() << "for {" << endl <<
+            indent() << "  fieldTypeId, fieldId, err := d.ReadFieldBegin()" << endl <<
+            indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), \"\", p.ThriftName(), err) }" << endl <<
+            indent() << "  if fieldTypeId == thrift.STOP { break }" << endl;
+    }
+
+    out <<
+        indent() << "  switch {" << endl;
+    indent_up();
+
+    for (f_iter = fields.begin(); f_iter != fields.end(); ++f_iter) {
+        int32_t field_id = (*f_iter)->get_key();
+        string field_name(publicize(variable_name_to_go_name((*f_iter)->get_name())));
+        string wire_type(type_to_enum((*f_iter)->get_type()));
+
+        if (wire_type == "thrift.BINARY") {
+            wire_type = "thrift.STRING";
+        }
+
+        std::ostringstream fail;
+        fail << "return thrift.NewTProtocolExceptionReadField(" << field_id << ", \"" << escape_string((*f_iter)->get_name()) << "\", p.ThriftName(), err)";
+        out <<
+            indent() << "case fieldId == " << field_id << " && fieldTypeId == " << wire_type << ":" << endl;
+        indent_up();
+        generate_unmarshal_value(out, proto, (*f_iter)->get_type(), "p." + field_name, false, fail.str());
+        std::map<t_field*, int>::const_iterator bit = struct_isset_bits_.find(*f_iter);
+
+        if (bit != struct_isset_bits_.end()) {
+            out <<
+                indent() << isset_bit("p.", bit->second, struct_isset_bits_.size(), "set") << endl;
+        }
+
+        indent_down();
+    }
+
+    out <<
+        indent() << "default:" << endl <<
+        indent() << "  err = d.Skip(fieldTypeId)" << endl <<
+        indent() << "  if err != nil { return thrift.NewTProtocolExceptionReadField(int(fieldId), \"\", p.ThriftName(), err) }" << endl;
+    indent_down();
+    out <<
+        indent() << "  }" << endl <<
+        indent() << "}" << endl;
+
+    if (struct_reuse_) {
+        out <<
+            indent() << "p.__reuse = false" << endl;
+    }
+
+    out <<
+        indent() << "return nil" << endl;
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl;
+}
+
+/**
+ * Generates Marshal<proto>Thrift(), or <proto>Size() when size_only is set,
+ * which adds up the bytes the former appends without writing them.
+ */
+void t_go_generator::generate_go_struct_marshal(ofstream& out,
+        t_struct* tstruct,
+        const string& tstruct_name,
+        bool is_result,
+        const string& proto,
+        bool size_only)
+{
+    const vector<t_field*>& fields = tstruct->get_sorted_members();
+    bool compact = proto == "Compact";
+    int last_id = 0;
+    bool last_id_tracked = true;
+
+    if (size_only) {
+        out <<
+            indent() << "func (p *" << tstruct_name << ") " << proto << "Size() int {" << endl <<
+            indent() << "  n := 0" << endl;
+    } else {
+        out <<
+            indent() << "func (p *" << tstruct_name << ") Marshal" << proto << "Thrift(buf []byte) []byte {" << endl;
+    }
+
+    indent_up();
+
+    if (is_result && fields.size()) {
+        // Only the first set field of a result is written, as in Write()
+        out <<
+            indent() << "switch {" << endl;
+        vector<t_field*>::const_reverse_iterator fr_iter;
+
+        for (fr_iter = fields.rbegin(); fr_iter != fields.rend(); ++fr_iter) {
+            if (can_be_nil((*fr_iter)->get_type()) && (*fr_iter)->get_key() != 0) {
+                out <<
+                    indent() << "case p." << publicize(variable_name_to_go_name((*fr_iter)->get_name())) << " != nil:" << endl;
+            } else {
+                out <<
+                    indent() << "default:" << endl;
+            }
+
+            indent_up();
+            last_id = 0;
+            generate_marshal_field(out, proto, *fr_iter, last_id, last_id_tracked, false, size_only);
+            indent_down();
+        }
+
+        out <<
+            indent() << "}" << endl;
+    } else {
+        // The compact protocol writes each field id as a delta from the id
+        // of the field written before it.  That is known here unless an
+        // earlier field is only written when set, in which case the last
+        // id written is tracked at run time, up to the last field that
+        // needs it.
+        size_t tracked_fields = 0;
+
+        for (size_t i = 0; compact && i < fields.size(); ++i) {
+            if (last_id == UNKNOWN_FIELD_ID) {
+                tracked_fields = i;
+            }
+
+            if (can_be_nil(fields[i]->get_type()) || fields[i]->get_req() == t_field::T_OPTIONAL || fields[i]->get_type()->is_enum()) {
+                last_id = UNKNOWN_FIELD_ID;
+            } else {
+                last_id = fields[i]->get_key();
+            }
+        }
+
+        last_id = 0;
+
+        if (tracked_fields > 0) {
+            out <<
+                indent() << "var lastFieldId int16" << endl;
+        }
+
+        for (size_t i = 0; i < fields.size(); ++i) {
+            generate_marshal_field(out, proto, fields[i], last_id, last_id_tracked, i < tracked_fields, size_only);
+        }
+    }
+
+    if (size_only) {
+        out <<
+            indent() << "return n + 1" << endl;
+    } else {
+        out <<
+            indent() << "return thrift.Append" << proto << "FieldStop(buf)" << endl;
+    }
+
+    indent_down();
+    out <<
+        indent() << "}" << endl << endl;
+}
+
+/**
+ * Appends a field header and value to buf, under the same conditions that
+ * WriteFieldN() writes the field.  For the compact protocol last_id is the
+ * id of the field written before this one, or UNKNOWN_FIELD_ID when that is
+ * only known at run time, in lastFieldId.  last_id_tracked says whether lastFieldId
+ * already holds last_id, and track_last_id whether a later field reads it.
+ * With size_only the encoded size is added to n instead.
+ */
+void t_go_generator::generate_marshal_field(ofstream &out,
+        const string& proto,
+        t_field* tfield,
+        int& last_id,
+        bool& last_id_tracked,
+        bool track_last_id,
+        bool size_only)
+{
+    string field_name(publicize(variable_name_to_go_name(tfield->get_name())));
+    bool field_can_be_nil = can_be_nil(tfield->get_type());
+    bool field_is_guarded = tfield->get_req() == t_field::T_OPTIONAL || tfield->get_type()->is_enum();
+    t_type* field_type = get_true_type(tfield->get_type());
+    bool field_is_bool = field_type->is_base_type() && ((t_base_type*)field_type)->get_base() == t_base_type::TYPE_BOOL;
+    bool compact = proto == "Compact";
+    int field_id = tfield->get_key();
+
+    if (compact && track_last_id && (field_can_be_nil || field_is_guarded) && last_id != UNKNOWN_FIELD_ID && !last_id_tracked) {
+        out <<
+            indent() << "lastFieldId = " << last_id << endl;
+    }
+
+    if (field_can_be_nil) {
+        out <<
+            indent() << "if p." << field_name << " != nil {" << endl;
+        indent_up();
+    }
+
+    if (field_is_guarded) {
+        out <<
+            indent() << "if p.IsSet" << field_name << "() {" << endl;
+        indent_up();
+    }
+
+    if (size_only) {
+        if (!compact) {
+            out <<
+                indent() << "n += 3" << endl;
+        } else if (last_id == UNKNOWN_FIELD_ID) {
+            out <<
+                indent() << "n += thrift.CompactFieldBeginSize(" << field_id << ", lastFieldId)" << endl;
+        } else {
+            out <<
+                indent() << "n += " << compact_field_header(0, field_id, last_id).size() << endl;
+        }
+
+        if (!compact || !field_is_bool) {
+            generate_size_value(out, proto, tfield->get_type(), "p." + field_name);
+        }
+    } else if (!compact) {
+        out <<
+            indent() << "buf = thrift.AppendBinaryFieldBegin(buf, " << type_to_enum(tfield->get_type()) << ", " << field_id << ")" << endl;
+        generate_marshal_value(out, proto, tfield->get_type(), "p." + field_name);
+    } else if (last_id == UNKNOWN_FIELD_ID && field_is_bool) {
+        out <<
+            indent() << "buf = thrift.AppendCompactBoolField(buf, " << field_id << ", lastFieldId, bool(p." << field_name << "))" << endl;
+    } else if (last_id == UNKNOWN_FIELD_ID) {
+        out <<
+            indent() << "buf = thrift.AppendCompactFieldBegin(buf, " << type_to_enum(tfield->get_type()) << ", " << field_id << ", lastFieldId)" << endl;
+        generate_marshal_value(out, proto, tfield->get_type(), "p." + field_name);
+    } else if (field_is_bool) {
+        // Bool fields carry their value in the header
+        out <<
+            indent() << "if p." << field_name << " {" << endl <<
+            indent() << "  buf = append(buf, " << go_byte_list(compact_field_header(1, field_id, last_id)) << ")" << endl <<
+            indent() << "} else {" << endl <<
+            indent() << "  buf = append(buf, " << go_byte_list(compact_field_header(2, field_id, last_id)) << ")" << endl <<
+            indent() << "}" << endl;
+    } else {
+        out <<
+            indent() << "buf = append(buf, " << go_byte_list(compact_field_header(type_to_compact_type(tfield->get_type()), field_id, last_id)) << ")" << endl;
+        generate_marshal_value(out, proto, tfield->get_type(), "p." + field_name);
+    }
+
+    if (compact && track_last_id && (field_can_be_nil || field_is_guarded)) {
+        out <<
+            indent() << "lastFieldId = " << field_id << endl;
+    }
+
+    if (field_is_guarded) {
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    }
+
+    if (field_can_be_nil) {
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    }
+
+    if (field_can_be_nil || field_is_guarded) {
+        last_id = UNKNOWN_FIELD_ID;
+    } else {
+        last_id = field_id;
+        last_id_tracked = false;
+    }
+}
+
+/**
+ * Appends the encoding of value, of type ttype, to buf.
+ */
+void t_go_generator::generate_marshal_value(ofstream &out,
+        const string& proto,
+        t_type* ttype,
+        string value)
+{
+    t_type* type = get_true_type(ttype);
+    string append("thrift.Append" + proto);
+
+    if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << "buf = " << value << ".Marshal" << proto << "Thrift(buf)" << endl;
+    } else if (type->is_enum()) {
+        out <<
+            indent() << "buf = " << append << "I32(buf, int32(" << value << "))" << endl;
+    } else if (type->is_base_type()) {
+        t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+        indent(out) << "buf = " << append;
+
+        switch (tbase) {
+        case t_base_type::TYPE_STRING:
+            if (((t_base_type*)type)->is_binary()) {
+                out << "Binary(buf, " << value << ")";
+            } else {
+                out << "String(buf, string(" << value << "))";
+            }
+
+            break;
+
+        case t_base_type::TYPE_BOOL:
+            out << "Bool(buf, bool(" << value << "))";
+            break;
+
+        case t_base_type::TYPE_BYTE:
+            out << "Byte(buf, byte(" << value << "))";
+            break;
+
+        case t_base_type::TYPE_I16:
+            out << "I16(buf, int16(" << value << "))";
+            break;
+
+        case t_base_type::TYPE_I32:
+            out << "I32(buf, int32(" << value << "))";
+            break;
+
+        case t_base_type::TYPE_I64:
+            out << "I64(buf, int64(" << value << "))";
+            break;
+
+        case t_base_type::TYPE_DOUBLE:
+            out << "Double(buf, float64(" << value << "))";
+            break;
+
+        default:
+            throw "compiler error: no Go name for base type " + t_base_type::t_base_name(tbase);
+        }
+
+        out << endl;
+    } else if (type->is_map()) {
+        t_map* tmap = (t_map*)type;
+        t_type* ktype = get_true_type(tmap->get_key_type());
+        string kiter = tmp("Kiter");
+        string viter = tmp("Viter");
+        string len(gen_native_containers_ ? "len(" + value + ")" : value + ".Len()");
+        out <<
+            indent() << "buf = " << append << "MapBegin(buf, " << type_to_enum(tmap->get_key_type()) << ", " << type_to_enum(tmap->get_val_type()) << ", " << len << ")" << endl;
+
+        if (gen_native_containers_) {
+            if (ktype->is_base_type() && ((t_base_type*)ktype)->is_binary()) {
+                string miter = tmp("Miter");
+                out <<
+                    indent() << "for " << miter << ", " << viter << " := range " << value << " {" << endl <<
+                    indent() << "  " << kiter << " := []byte(" << miter << ")" << endl;
+            } else {
+                out <<
+                    indent() << "for " << kiter << ", " << viter << " := range " << value << " {" << endl;
+            }
+
+            indent_up();
+            generate_marshal_value(out, proto, tmap->get_key_type(), kiter);
+            generate_marshal_value(out, proto, tmap->get_val_type(), viter);
+            indent_down();
             out <<
-                indent() << "if p." << publicize(variable_name_to_go_name(field_name)) << " != nil {" << endl;
+                indent() << "}" << endl;
+        } else {
+            string miter = tmp("Miter");
+            string mval = tmp("Miter");
+            out <<
+                indent() << value << ".ForEach(func(" << miter << ", " << mval << " interface{}) error {" << endl <<
+                indent() << "  " << kiter << ", " << viter << " := " << miter << ".(" << type_to_go_type(tmap->get_key_type()) << "), " << mval << ".(" << type_to_go_type(tmap->get_val_type()) << ")" << endl;
+            indent_up();
+            generate_marshal_value(out, proto, tmap->get_key_type(), kiter);
+            generate_marshal_value(out, proto, tmap->get_val_type(), viter);
+            out <<
+                indent() << "return nil" << endl;
+            indent_down();
+            out <<
+                indent() << "})" << endl;
+        }
+    } else if (type->is_set()) {
+        t_set* tset = (t_set*)type;
+        t_type* etype = get_true_type(tset->get_elem_type());
+        string iter = tmp("Iter");
+        string iter2 = tmp("Iter");
+        string len(gen_native_containers_ ? "len(" + value + ")" : value + ".Len()");
+        out <<
+            indent() << "buf = " << append << "SetBegin(buf, " << type_to_enum(tset->get_elem_type()) << ", " << len << ")" << endl;
+
+        if (gen_native_containers_ && etype->is_base_type() && ((t_base_type*)etype)->is_binary()) {
+            out <<
+                indent() << "for " << iter << " := range " << value << " {" << endl <<
+                indent() << "  " << iter2 << " := []byte(" << iter << ")" << endl;
+        } else if (gen_native_containers_) {
+            out <<
+                indent() << "for " << iter2 << " := range " << value << " {" << endl;
+        } else {
+            out <<
+                indent() << "for " << iter << " := " << value << ".Front(); " << iter << " != nil; " << iter << " = " << iter << ".Next() {" << endl <<
+                indent() << "  " << iter2 << " := " << iter << ".Value.(" << type_to_go_type(tset->get_elem_type()) << ")" << endl;
+        }
+
+        indent_up();
+        generate_marshal_value(out, proto, tset->get_elem_type(), iter2);
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    } else if (type->is_list()) {
+        t_list* tlist = (t_list*)type;
+        string iter = tmp("Iter");
+        string iter2 = tmp("Iter");
+        string len(gen_native_containers_ ? "len(" + value + ")" : value + ".Len()");
+        out <<
+            indent() << "buf = " << append << "ListBegin(buf, " << type_to_enum(tlist->get_elem_type()) << ", " << len << ")" << endl;
+
+        if (is_value_list(type)) {
+            out <<
+                indent() << "for " << iter << " := range " << value << " {" << endl <<
+                indent() << "  " << iter2 << " := &" << value << "[" << iter << "]" << endl;
+        } else if (gen_native_containers_) {
+            out <<
+                indent() << "for _, " << iter2 << " := range " << value << " {" << endl;
+        } else {
+            out <<
+                indent() << "for " << iter << " := 0; " << iter << " < " << len << "; " << iter << "++ {" << endl <<
+                indent() << "  " << iter2 << " := " << value << ".At(" << iter << ").(" << type_to_go_type(tlist->get_elem_type()) << ")" << endl;
+        }
+
+        indent_up();
+        generate_marshal_value(out, proto, tlist->get_elem_type(), iter2);
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    } else {
+        throw "INVALID TYPE IN generate_marshal_value '" + type->get_name() + "' for value '" + value + "'";
+    }
+}
+
+/**
+ * Adds the encoded size of value, of type ttype, to n.
+ */
+void t_go_generator::generate_size_value(ofstream &out,
+        const string& proto,
+        t_type* ttype,
+        string value)
+{
+    t_type* type = get_true_type(ttype);
+    bool compact = proto == "Compact";
+    int fixed = fixed_wire_size(proto, type);
+
+    if (fixed) {
+        out <<
+            indent() << "n += " << fixed << endl;
+    } else if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << "n += " << value << "." << proto << "Size()" << endl;
+    } else if (type->is_enum()) {
+        out <<
+            indent() << "n += thrift.CompactI32Size(int32(" << value << "))" << endl;
+    } else if (type->is_base_type()) {
+        t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+
+        switch (tbase) {
+        case t_base_type::TYPE_STRING:
+            if (compact) {
+                out <<
+                    indent() << "n += thrift.CompactStringSize(len(" << value << "))" << endl;
+            } else {
+                out <<
+                    indent() << "n += 4 + len(" << value << ")" << endl;
+            }
+
+            break;
+
+        case t_base_type::TYPE_I16:
+        case t_base_type::TYPE_I32:
+            out <<
+                indent() << "n += thrift.CompactI32Size(int32(" << value << "))" << endl;
+            break;
+
+        case t_base_type::TYPE_I64:
+            out <<
+                indent() << "n += thrift.CompactI64Size(int64(" << value << "))" << endl;
+            break;
+
+        default:
+            throw "compiler error: no Go name for base type " + t_base_type::t_base_name(tbase);
+        }
+    } else if (type->is_map()) {
+        t_map* tmap = (t_map*)type;
+        int kfixed = fixed_wire_size(proto, tmap->get_key_type());
+        int vfixed = fixed_wire_size(proto, tmap->get_val_type());
+        string len(gen_native_containers_ ? "len(" + value + ")" : value + ".Len()");
+
+        if (compact) {
+            out <<
+                indent() << "n += thrift.CompactMapBeginSize(" << len << ")" << endl;
+        } else {
+            out <<
+                indent() << "n += 6" << endl;
+        }
+
+        if (kfixed + vfixed) {
+            out <<
+                indent() << "n += " << len << " * " << kfixed + vfixed << endl;
+        }
+
+        if (kfixed && vfixed) {
+            return;
+        }
+
+        string kiter = kfixed ? "_" : tmp("Kiter");
+        string viter = vfixed ? "_" : tmp("Viter");
+
+        if (gen_native_containers_ && vfixed) {
+            out <<
+                indent() << "for " << kiter << " := range " << value << " {" << endl;
+            indent_up();
+        } else if (gen_native_containers_) {
+            out <<
+                indent() << "for " << kiter << ", " << viter << " := range " << value << " {" << endl;
             indent_up();
+        } else {
+            string miter = tmp("Miter");
+            string mval = tmp("Miter");
+            out <<
+                indent() << value << ".ForEach(func(" << miter << ", " << mval << " interface{}) error {" << endl;
+            indent_up();
+
+            if (!kfixed) {
+                out <<
+                    indent() << kiter << " := " << miter << ".(" << type_to_go_type(tmap->get_key_type()) << ")" << endl;
+            }
+
+            if (!vfixed) {
+                out <<
+                    indent() << viter << " := " << mval << ".(" << type_to_go_type(tmap->get_val_type()) << ")" << endl;
+            }
+        }
+
+        if (!kfixed) {
+            generate_size_value(out, proto, tmap->get_key_type(), kiter);
+        }
+
+        if (!vfixed) {
+            generate_size_value(out, proto, tmap->get_val_type(), viter);
+        }
+
+        if (!gen_native_containers_) {
+            out <<
+                indent() << "return nil" << endl;
+        }
+
+        indent_down();
+        out <<
+            indent() << (gen_native_containers_ ? "}" : "})") << endl;
+    } else if (type->is_set() || type->is_list()) {
+        t_type* etype = type->is_set() ? ((t_set*)type)->get_elem_type() : ((t_list*)type)->get_elem_type();
+        int efixed = fixed_wire_size(proto, etype);
+        string len(gen_native_containers_ ? "len(" + value + ")" : value + ".Len()");
+
+        if (compact) {
+            out <<
+                indent() << "n += thrift.CompactListBeginSize(" << len << ")" << endl;
+        } else {
+            out <<
+                indent() << "n += 5" << endl;
+        }
+
+        if (efixed) {
+            out <<
+                indent() << "n += " << len << " * " << efixed << endl;
+            return;
+        }
+
+        string iter = tmp("Iter");
+        string iter2 = tmp("Iter");
+
+        if (gen_native_containers_ && type->is_set()) {
+            out <<
+                indent() << "for " << iter2 << " := range " << value << " {" << endl;
+        } else if (is_value_list(type)) {
+            out <<
+                indent() << "for " << iter << " := range " << value << " {" << endl <<
+                indent() << "  " << iter2 << " := &" << value << "[" << iter << "]" << endl;
+        } else if (gen_native_containers_) {
+            out <<
+                indent() << "for _, " << iter2 << " := range " << value << " {" << endl;
+        } else if (type->is_set()) {
+            out <<
+                indent() << "for " << iter << " := " << value << ".Front(); " << iter << " != nil; " << iter << " = " << iter << ".Next() {" << endl <<
+                indent() << "  " << iter2 << " := " << iter << ".Value.(" << type_to_go_type(etype) << ")" << endl;
+        } else {
+            out <<
+                indent() << "for " << iter << " := 0; " << iter << " < " << len << "; " << iter << "++ {" << endl <<
+                indent() << "  " << iter2 << " := " << value << ".At(" << iter << ").(" << type_to_go_type(etype) << ")" << endl;
+        }
+
+        indent_up();
+        generate_size_value(out, proto, etype, iter2);
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    } else {
+        throw "INVALID TYPE IN generate_size_value '" + type->get_name() + "' for value '" + value + "'";
+    }
+}
+
+/**
+ * Decodes a value of type ttype from d into target, declaring target when
+ * asked to.  fail is the statement run when decoding returns err.
+ */
+void t_go_generator::generate_unmarshal_value(ofstream &out,
+        const string& proto,
+        t_type* ttype,
+        string target,
+        bool declare,
+        string fail)
+{
+    t_type* type = get_true_type(ttype);
+    string eq(declare ? " := " : " = ");
+
+    if (type->is_struct() || type->is_xception()) {
+        out <<
+            indent() << target << eq << "New" << publicize(type_name(type)) << "()" << endl <<
+            indent() << "if err := " << target << ".Decode" << proto << "Thrift(d); err != nil { " << fail << " }" << endl;
+    } else if (type->is_base_type() || type->is_enum()) {
+        string v = tmp("v");
+        indent(out) << v << ", err := d.";
+
+        if (type->is_enum()) {
+            out << "ReadI32()";
+        } else {
+            t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+
+            switch (tbase) {
+            case t_base_type::TYPE_STRING:
+                if (((t_base_type*)type)->is_binary()) {
+                    out << (gen_zero_copy_ ? "ReadBinaryBorrowed()" : "ReadBinary()");
+                } else {
+                    out << (gen_zero_copy_ ? "ReadStringBorrowed()" : "ReadString()");
+                }
+
+                break;
+
+            case t_base_type::TYPE_BOOL:
+                out << "ReadBool()";
+                break;
+
+            case t_base_type::TYPE_BYTE:
+                out << "ReadByte()";
+                break;
+
+            case t_base_type::TYPE_I16:
+                out << "ReadI16()";
+                break;
+
+            case t_base_type::TYPE_I32:
+                out << "ReadI32()";
+                break;
+
+            case t_base_type::TYPE_I64:
+                out << "ReadI64()";
+                break;
+
+            case t_base_type::TYPE_DOUBLE:
+                out << "ReadDouble()";
+                break;
+
+            default:
+                throw "compiler error: no Go name for base type " + t_base_type::t_base_name(tbase);
+            }
+        }
+
+        out << endl <<
+            indent() << "if err != nil { " << fail << " }" << endl;
+
+        if (type->is_enum() || ttype->is_typedef()) {
+            indent(out) << target << eq << publicize(ttype->get_name()) << "(" << v << ")" << endl;
+        } else {
+            indent(out) << target << eq << v << endl;
         }
+    } else if (type->is_container()) {
+        string size = tmp("_size");
+        string i = tmp("_i");
+
+        if (type->is_map()) {
+            t_map* tmap = (t_map*)type;
+            out <<
+                indent() << "_, _, " << size << ", err := d.ReadMapBegin()" << endl <<
+                indent() << "if err != nil { " << fail << " }" << endl;
 
-        if (field_required == t_field::T_OPTIONAL || (*f_iter)->get_type()->is_enum()) {
+            if (gen_native_containers_) {
+                generate_native_container_make(out, type, target, eq, size);
+            } else {
+                indent(out) << target << eq << "thrift.NewTMap(" << type_to_enum(tmap->get_key_type()) << ", " << type_to_enum(tmap->get_val_type()) << ", " << size << ")" << endl;
+            }
+
+            string key = tmp("_key");
+            string val = tmp("_val");
             out <<
-                indent() << "if p.IsSet" << publicize(variable_name_to_go_name(field_name)) << "() {" << endl;
+                indent() << "for " << i << " := 0; " << i << " < " << size << "; " << i << "++ {" << endl;
             indent_up();
-        }
+            generate_unmarshal_value(out, proto, tmap->get_key_type(), key, true, fail);
+            generate_unmarshal_value(out, proto, tmap->get_val_type(), val, true, fail);
 
-        out <<
-            indent() << "err = oprot.WriteFieldBegin(\"" <<
-            escape_field_name << "\", " <<
-            type_to_enum((*f_iter)->get_type()) << ", " <<
-            fieldId << ")" << endl <<
-            indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(" <<
-            fieldId << ", \"" <<
-            escape_field_name << "\", " <<
-            "p.ThriftName(), err); }" << endl;
-        // Write field contents
-        generate_serialize_field(out, *f_iter, "p.");
-        // Write field closer
-        out <<
-            indent() << "err = oprot.WriteFieldEnd()" << endl <<
-            indent() << "if err != nil { return thrift.NewTProtocolExceptionWriteField(" <<
-            fieldId << ", \"" <<
-            escape_field_name << "\", " <<
-            "p.ThriftName(), err); }" << endl;
+            if (gen_native_containers_) {
+                indent(out) << target << "[" << native_key(tmap->get_key_type(), key) << "] = " << val << endl;
+            } else {
+                indent(out) << target << ".Set(" << key << ", " << val << ")" << endl;
+            }
 
-        if (field_required == t_field::T_OPTIONAL || (*f_iter)->get_type()->is_enum()) {
             indent_down();
             out <<
                 indent() << "}" << endl;
-        }
+        } else {
+            t_type* etype = type->is_set() ? ((t_set*)type)->get_elem_type() : ((t_list*)type)->get_elem_type();
+            out <<
+                indent() << "_, " << size << ", err := d." << (type->is_set() ? "ReadSetBegin()" : "ReadListBegin()") << endl <<
+                indent() << "if err != nil { " << fail << " }" << endl;
+
+            if (gen_native_containers_) {
+                generate_native_container_make(out, type, target, eq, size);
+            } else if (type->is_set()) {
+                indent(out) << target << eq << "thrift.NewTSet(" << type_to_enum(etype) << ", " << size << ")" << endl;
+            } else {
+                indent(out) << target << eq << "thrift.NewTList(" << type_to_enum(etype) << ", " << size << ")" << endl;
+            }
+
+            string elem = tmp("_elem");
+            out <<
+                indent() << "for " << i << " := 0; " << i << " < " << size << "; " << i << "++ {" << endl;
+            indent_up();
+
+            if (is_value_list(type)) {
+                out <<
+                    indent() << "if len(" << target << ") < cap(" << target << ") {" << endl <<
+                    indent() << "  " << target << " = " << target << "[:len(" << target << ")+1]" << endl <<
+                    indent() << "} else {" << endl <<
+                    indent() << "  " << target << " = append(" << target << ", " << type_to_go_type(type).substr(2) << "{})" << endl <<
+                    indent() << "}" << endl <<
+                    indent() << elem << " := &" << target << "[len(" << target << ")-1]" << endl <<
+                    indent() << elem << ".Reset()" << endl <<
+                    indent() << "if err := " << elem << ".Decode" << proto << "Thrift(d); err != nil { " << fail << " }" << endl;
+                indent_down();
+                out <<
+                    indent() << "}" << endl;
+                return;
+            }
+
+            generate_unmarshal_value(out, proto, etype, elem, true, fail);
+
+            if (gen_native_containers_ && type->is_set()) {
+                indent(out) << target << "[" << native_key(etype, elem) << "] = struct{}{}" << endl;
+            } else if (gen_native_containers_) {
+                indent(out) << target << " = append(" << target << ", " << elem << ")" << endl;
+            } else if (type->is_set()) {
+                indent(out) << target << ".Add(" << elem << ")" << endl;
+            } else {
+                indent(out) << target << ".Push(" << elem << ")" << endl;
+            }
 
-        if (field_can_be_nil) {
             indent_down();
             out <<
                 indent() << "}" << endl;
         }
-
-        indent_down();
-        out <<
-            indent() << "  return err" << endl <<
-            indent() << "}" << endl << endl <<
-            indent() << "func (p *" << tstruct_name << ") WriteField" << publicize(field_name) << "(oprot thrift.TProtocol) (thrift.TProtocolException) {" << endl <<
-            indent() << "  return p.WriteField" << fieldId << "(oprot)" << endl <<
-            indent() << "}" << endl << endl;
+    } else {
+        throw "INVALID TYPE IN generate_unmarshal_value '" + type->get_name() + "' for target '" + target + "'";
     }
 }
 
@@ -1405,14 +3222,16 @@ void t_go_generator::generate_service(t_service* tservice)
     f_service_.open(f_service_name.c_str());
     f_service_ <<
                go_autogen_comment() <<
-               go_package() <<
-               go_imports();
+               go_package();
 
-    if (tservice->get_extends() != NULL) {
+    if (tservice->get_extends() != NULL && tservice->get_extends()->get_program() != program_) {
         f_service_ <<
-                   "import \"" << get_real_go_module(tservice->get_extends()->get_program()) << "\"" << endl;
+                   "import \"" << get_real_go_module(tservice->get_extends()->get_program()) << "\"" << endl << endl;
     }
 
+    f_service_ <<
+               go_imports();
+
     f_service_ <<
                //             "import (" << endl <<
                // indent() << "        \"os\"" << endl <<
@@ -1421,6 +3240,7 @@ void t_go_generator::generate_service(t_service* tservice)
     f_service_ << endl;
     generate_service_interface(tservice);
     generate_service_client(tservice);
+    generate_service_concurrent_client(tservice);
     generate_service_server(tservice);
     generate_service_helpers(tservice);
     generate_service_remote(tservice);
@@ -1444,7 +3264,7 @@ void t_go_generator::generate_service_helpers(t_service* tservice)
 
     for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
         t_struct* ts = (*f_iter)->get_arglist();
-        generate_go_struct_definition(f_service_, ts, false);
+        generate_go_struct_definition(f_service_, ts, false, false, true);
         generate_go_function_helpers(*f_iter);
     }
 }
@@ -1692,6 +3512,7 @@ void t_go_generator::generate_service_client(t_service* tservice)
 
         // Write to the stream
         f_service_ <<
+                   indent() << "thrift.GrowForWrite(oprot, " << args << ")" << endl <<
                    indent() << "err = " << args << ".Write(oprot)" << endl <<
                    indent() << "oprot.WriteMessageEnd()" << endl <<
                    indent() << "oprot.Transport().Flush()" << endl <<
@@ -1788,6 +3609,120 @@ void t_go_generator::generate_service_client(t_service* tservice)
                endl;
 }
 
+/**
+ * Generates a client that many goroutines may share, with their calls
+ * pipelined over one transport by an embedded thrift.TConcurrentClient.
+ *
+ * @param tservice The service to generate a client for.
+ */
+void t_go_generator::generate_service_concurrent_client(t_service* tservice)
+{
+    string serviceName(publicize(tservice->get_name()));
+    string clientName(serviceName + "ConcurrentClient");
+    string extends_client = "";
+    string extends_client_new = "";
+
+    if (tservice->get_extends() != NULL) {
+        string extends = type_name(tservice->get_extends());
+        size_t index = extends.rfind(".");
+
+        if (index != string::npos) {
+            extends_client = extends.substr(0, index + 1) + publicize(extends.substr(index + 1)) + "ConcurrentClient";
+            extends_client_new = extends.substr(0, index + 1) + "New" + publicize(extends.substr(index + 1)) + "ConcurrentClient";
+        } else {
+            extends_client = publicize(extends) + "ConcurrentClient";
+            extends_client_new = "New" + extends_client;
+        }
+    }
+
+    f_service_ <<
+               indent() << "/**" << endl <<
+               indent() << " * Shares one transport between any number of goroutines, which may each" << endl <<
+               indent() << " * have a call to " << serviceName << " outstanding at once.  maxInFlight, if" << endl <<
+               indent() << " * greater than zero, bounds how many." << endl <<
+               indent() << " */" << endl <<
+               indent() << "type " << clientName << " struct {" << endl;
+    indent_up();
+
+    if (!extends_client.empty()) {
+        f_service_ <<
+                   indent() << "*" << extends_client << endl;
+    } else {
+        f_service_ <<
+                   indent() << "*thrift.TConcurrentClient" << endl;
+    }
+
+    indent_down();
+    f_service_ <<
+               indent() << "}" << endl << endl <<
+               indent() << "func New" << clientName << "(t thrift.TTransport, f thrift.TProtocolFactory, maxInFlight int) *" << clientName << " {" << endl;
+    indent_up();
+
+    if (!extends_client.empty()) {
+        f_service_ <<
+                   indent() << "return &" << clientName << "{" << extends_client_new << "(t, f, maxInFlight)}" << endl;
+    } else {
+        f_service_ <<
+                   indent() << "return &" << clientName << "{thrift.NewTConcurrentClient(t, f, maxInFlight)}" << endl;
+    }
+
+    indent_down();
+    f_service_ <<
+               indent() << "}" << endl << endl;
+    vector<t_function*> functions = tservice->get_functions();
+    vector<t_function*>::const_iterator f_iter;
+
+    for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
+        const vector<t_field*>& fields = (*f_iter)->get_arglist()->get_members();
+        const vector<t_field*>& xceptions = (*f_iter)->get_xceptions()->get_members();
+        vector<t_field*>::const_iterator fld_iter;
+        string args(tmp("args"));
+        string result(tmp("result"));
+        generate_go_docstring(f_service_, (*f_iter));
+        f_service_ <<
+                   indent() << "func (p *" << clientName << ") " << function_signature_if(*f_iter, "", true) << " {" << endl;
+        indent_up();
+        f_service_ <<
+                   indent() << args << " := New" << publicize(privatize((*f_iter)->get_name()) + "Args") << "()" << endl;
+
+        for (fld_iter = fields.begin(); fld_iter != fields.end(); ++fld_iter) {
+            f_service_ <<
+                       indent() << args << "." << publicize(variable_name_to_go_name((*fld_iter)->get_name())) << " = " << variable_name_to_go_name((*fld_iter)->get_name()) << endl;
+        }
+
+        if ((*f_iter)->is_oneway()) {
+            f_service_ <<
+                       indent() << "err = p.Call(\"" << (*f_iter)->get_name() << "\", " << args << ", nil)" << endl <<
+                       indent() << "return" << endl;
+        } else if ((*f_iter)->get_returntype()->is_void() && xceptions.empty()) {
+            f_service_ <<
+                       indent() << "err = p.Call(\"" << (*f_iter)->get_name() << "\", " << args << ", New" << publicize(privatize((*f_iter)->get_name()) + "Result") << "())" << endl <<
+                       indent() << "return" << endl;
+        } else {
+            f_service_ <<
+                       indent() << result << " := New" << publicize(privatize((*f_iter)->get_name()) + "Result") << "()" << endl <<
+                       indent() << "if err = p.Call(\"" << (*f_iter)->get_name() << "\", " << args << ", " << result << "); err != nil {" << endl <<
+                       indent() << "  return" << endl <<
+                       indent() << "}" << endl <<
+                       indent() << "return ";
+
+            if (!(*f_iter)->get_returntype()->is_void()) {
+                f_service_ << result << ".Success, ";
+            }
+
+            for (fld_iter = xceptions.begin(); fld_iter != xceptions.end(); ++fld_iter) {
+                f_service_ << result << "." << publicize((*fld_iter)->get_name()) << ", ";
+            }
+
+            f_service_ << "nil" << endl;
+        }
+
+        indent_down();
+        f_service_ <<
+                   indent() << "}" << endl << endl;
+    }
+}
+
 /**
  * Generates a command line tool for making remote requests
  *
@@ -1848,6 +3783,7 @@ void t_go_generator::generate_service_remote(t_service* tservice)
              indent() << "var protocol string" << endl <<
              indent() << "var urlString string" << endl <<
              indent() << "var framed bool" << endl <<
+             indent() << "var buffered bool" << endl <<
              indent() << "var useHttp bool" << endl <<
              indent() << "var help bool" << endl <<
              indent() << "var parsedUrl url.URL" << endl <<
@@ -1858,6 +3794,7 @@ void t_go_generator::generate_service_remote(t_service* tservice)
              indent() << "flag.StringVar(&protocol, \"P\", \"binary\", \"Specify the protocol (binary, compact, simplejson, json)\")" << endl <<
              indent() << "flag.StringVar(&urlString, \"u\", \"\", \"Specify the url\")" << endl <<
              indent() << "flag.BoolVar(&framed, \"framed\", false, \"Use framed transport\")" << endl <<
+             indent() << "flag.BoolVar(&buffered, \"buffered\", true, \"Buffer reads and writes to the socket\")" << endl <<
              indent() << "flag.BoolVar(&useHttp, \"http\", false, \"Use http\")" << endl <<
              indent() << "flag.BoolVar(&help, \"help\", false, \"See usage string\")" << endl <<
              indent() << "flag.Parse()" << endl <<
@@ -1894,6 +3831,9 @@ void t_go_generator::generate_service_remote(t_service* tservice)
              indent() << "    os.Exit(1)" << endl <<
              indent() << "  }" << endl <<
              indent() << "  trans, err = thrift.NewTNonblockingSocketAddr(addr)" << endl <<
+             indent() << "  if buffered {" << endl <<
+             indent() << "    trans = thrift.NewTBufferedTransport(trans, 0, 0)" << endl <<
+             indent() << "  }" << endl <<
              indent() << "  if framed {" << endl <<
              indent() << "    trans = thrift.NewTFramedTransport(trans)" << endl <<
              indent() << "  }" << endl <<
@@ -2204,91 +4144,106 @@ void t_go_generator::generate_service_server(t_service* tservice)
     }
 
     string pServiceName(privatize(serviceName));
+    // Every method of the service and of those it extends, which the
+    // processor dispatches through a switch rather than the map.
+    vector<string> method_names;
+    set<string> seen_names;
+
+    for (t_service* s = tservice; s != NULL; s = s->get_extends()) {
+        vector<t_function*> s_functions = s->get_functions();
+
+        for (f_iter = s_functions.begin(); f_iter != s_functions.end(); ++f_iter) {
+            if (seen_names.insert((*f_iter)->get_name()).second) {
+                method_names.push_back((*f_iter)->get_name());
+            }
+        }
+    }
+
     // Generate the header portion
     string self(tmp("self"));
+    string pool(tmp("pool"));
+    f_service_ <<
+               indent() << "type " << serviceName << "Processor struct {" << endl <<
+               indent() << "  handler I" << serviceName << endl <<
+               indent() << "  processorMap map[string]thrift.TProcessorFunction" << endl <<
+               indent() << "  functions [" << method_names.size() << "]thrift.TProcessorFunction" << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << serviceName << "Processor) Handler() I" << serviceName << " {" << endl <<
+               indent() << "  return p.handler" << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << serviceName << "Processor) AddToProcessorMap(key string, processor thrift.TProcessorFunction) {" << endl <<
+               indent() << "  p.processorMap[key] = processor" << endl <<
+               indent() << "  if i := p.functionIndex(key); i >= 0 {" << endl <<
+               indent() << "    p.functions[i] = processor" << endl <<
+               indent() << "  }" << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << serviceName << "Processor) GetProcessorFunction(key string) (processor thrift.TProcessorFunction, exists bool) {" << endl <<
+               indent() << "  processor, exists = p.processorMap[key]" << endl <<
+               indent() << "  return processor, exists" << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << serviceName << "Processor) ProcessorMap() map[string]thrift.TProcessorFunction {" << endl <<
+               indent() << "  return p.processorMap" << endl <<
+               indent() << "}" << endl << endl;
+    // The index into functions of each method, inherited ones included
+    f_service_ <<
+               indent() << "func (p *" << serviceName << "Processor) functionIndex(name string) int {" << endl <<
+               indent() << "  switch name {" << endl;
 
-    if (extends_processor.empty()) {
+    for (size_t i = 0; i < method_names.size(); ++i) {
         f_service_ <<
-                   indent() << "type " << serviceName << "Processor struct {" << endl <<
-                   indent() << "  handler I" << serviceName << endl <<
-                   indent() << "  processorMap map[string]thrift.TProcessorFunction" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) Handler() I" << serviceName << " {" << endl <<
-                   indent() << "  return p.handler" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) AddToProcessorMap(key string, processor thrift.TProcessorFunction) {" << endl <<
-                   indent() << "  p.processorMap[key] = processor" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) GetProcessorFunction(key string) (processor thrift.TProcessorFunction, exists bool) {" << endl <<
-                   indent() << "  processor, exists = p.processorMap[key]" << endl <<
-                   indent() << "  return processor, exists" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) ProcessorMap() map[string]thrift.TProcessorFunction {" << endl <<
-                   indent() << "  return p.processorMap" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func New" << serviceName << "Processor(handler I" << serviceName << ") *" << serviceName << "Processor {" << endl << endl <<
-                   indent() << "  " << self << " := &" << serviceName << "Processor{handler:handler, processorMap:make(map[string]thrift.TProcessorFunction)}" << endl;
+                   indent() << "  case \"" << escape_string(method_names[i]) << "\":" << endl <<
+                   indent() << "    return " << i << endl;
+    }
 
-        for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
-            string escapedFuncName(escape_string((*f_iter)->get_name()));
-            f_service_ <<
-                       indent() << "  " << self << ".processorMap[\"" << escapedFuncName << "\"] = &" << pServiceName << "Processor" << publicize((*f_iter)->get_name()) << "{handler:handler}" << endl;
-        }
+    f_service_ <<
+               indent() << "  }" << endl <<
+               indent() << "  return -1" << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func New" << serviceName << "Processor(handler I" << serviceName << ") *" << serviceName << "Processor {" << endl << endl <<
+               indent() << "  " << self << " := &" << serviceName << "Processor{handler:handler, processorMap:make(map[string]thrift.TProcessorFunction)}" << endl <<
+               indent() << "  " << pool << " := thrift.PoolsArgs(handler)" << endl;
 
-        string x(tmp("x"));
-        f_service_ <<
-                   indent() << "return " << self << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) Process(iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {" << endl <<
-                   indent() << "  name, _, seqId, err := iprot.ReadMessageBegin()" << endl <<
-                   indent() << "  if err != nil { return }" << endl <<
-                   indent() << "  process, nameFound := p.GetProcessorFunction(name)" << endl <<
-                   indent() << "  if !nameFound || process == nil {" << endl <<
-                   indent() << "    iprot.Skip(thrift.STRUCT)" << endl <<
-                   indent() << "    iprot.ReadMessageEnd()" << endl <<
-                   indent() << "    " << x << " := thrift.NewTApplicationException(thrift.UNKNOWN_METHOD, \"Unknown function \" + name)" << endl <<
-                   indent() << "    oprot.WriteMessageBegin(name, thrift.EXCEPTION, seqId)" << endl <<
-                   indent() << "    " << x << ".Write(oprot)" << endl <<
-                   indent() << "    oprot.WriteMessageEnd()" << endl <<
-                   indent() << "    oprot.Transport().Flush()" << endl <<
-                   indent() << "    return false, " << x << endl <<
-                   indent() << "  }" << endl <<
-                   indent() << "  return process.Process(seqId, iprot, oprot)" << endl <<
-                   indent() << "}" << endl << endl;
-    } else {
+    if (!extends_processor.empty()) {
+        string key(tmp("key"));
+        string processor(tmp("processor"));
         f_service_ <<
-                   indent() << "type " << serviceName << "Processor struct {" << endl <<
-                   indent() << "  super *" << extends_processor << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) Handler() I" << serviceName << " {" << endl <<
-                   indent() << "  return p.super.Handler().(I" << serviceName << ")" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) AddToProcessorMap(key string, processor thrift.TProcessorFunction) {" << endl <<
-                   indent() << "  p.super.AddToProcessorMap(key, processor)" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) GetProcessorFunction(key string) (processor thrift.TProcessorFunction, exists bool) {" << endl <<
-                   indent() << "  return p.super.GetProcessorFunction(key)" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) ProcessorMap() map[string]thrift.TProcessorFunction {" << endl <<
-                   indent() << "  return p.super.ProcessorMap()" << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func New" << serviceName << "Processor(handler I" << serviceName << ") *" << serviceName << "Processor {" << endl <<
-                   indent() << "  " << self << " := &" << serviceName << "Processor{super: " << extends_processor_new << "(handler)}" << endl;
-
-        for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
-            string escapedFuncName(escape_string((*f_iter)->get_name()));
-            f_service_ <<
-                       indent() << "  " << self << ".AddToProcessorMap(\"" << escapedFuncName << "\", &" << pServiceName << "Processor" << publicize((*f_iter)->get_name()) << "{handler:handler})" << endl;
-        }
+                   indent() << "  for " << key << ", " << processor << " := range " << extends_processor_new << "(handler).ProcessorMap() {" << endl <<
+                   indent() << "    " << self << ".AddToProcessorMap(" << key << ", " << processor << ")" << endl <<
+                   indent() << "  }" << endl;
+    }
 
+    for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
+        string escapedFuncName(escape_string((*f_iter)->get_name()));
         f_service_ <<
-                   indent() << "  return " << self << endl <<
-                   indent() << "}" << endl << endl <<
-                   indent() << "func (p *" << serviceName << "Processor) Process(iprot, oprot thrift.TProtocol) (bool, thrift.TException) {" << endl <<
-                   indent() << "  return p.super.Process(iprot, oprot)" << endl <<
-                   indent() << "}" << endl << endl;
+                   indent() << "  " << self << ".AddToProcessorMap(\"" << escapedFuncName << "\", &" << pServiceName << "Processor" << publicize((*f_iter)->get_name()) << "{handler:handler, pool:" << pool << "})" << endl;
     }
 
+    string name(tmp("name"));
+    string x(tmp("x"));
+    f_service_ <<
+               indent() << "return " << self << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << serviceName << "Processor) Process(iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {" << endl <<
+               indent() << "  " << name << ", _, seqId, err := thrift.ReadMessageBeginBytes(iprot)" << endl <<
+               indent() << "  if err != nil { return }" << endl <<
+               indent() << "  if i := p.functionIndex(string(" << name << ")); i >= 0 && p.functions[i] != nil {" << endl <<
+               indent() << "    return p.functions[i].Process(seqId, iprot, oprot)" << endl <<
+               indent() << "  }" << endl <<
+               indent() << "  process, nameFound := p.processorMap[string(" << name << ")]" << endl <<
+               indent() << "  if !nameFound || process == nil {" << endl <<
+               indent() << "    name := string(" << name << ")" << endl <<
+               indent() << "    iprot.Skip(thrift.STRUCT)" << endl <<
+               indent() << "    iprot.ReadMessageEnd()" << endl <<
+               indent() << "    " << x << " := thrift.NewTApplicationException(thrift.UNKNOWN_METHOD, \"Unknown function \" + name)" << endl <<
+               indent() << "    oprot.WriteMessageBegin(name, thrift.EXCEPTION, seqId)" << endl <<
+               indent() << "    " << x << ".Write(oprot)" << endl <<
+               indent() << "    oprot.WriteMessageEnd()" << endl <<
+               indent() << "    oprot.Transport().Flush()" << endl <<
+               indent() << "    return false, " << x << endl <<
+               indent() << "  }" << endl <<
+               indent() << "  return process.Process(seqId, iprot, oprot)" << endl <<
+               indent() << "}" << endl << endl;
+
     // Generate the process subfunctions
     for (f_iter = functions.begin(); f_iter != functions.end(); ++f_iter) {
         generate_process_function(tservice, *f_iter);
@@ -2312,16 +4267,28 @@ void t_go_generator::generate_process_function(t_service* tservice,
     //t_struct* xs = tfunction->get_xceptions();
     //const std::vector<t_field*>& xceptions = xs->get_members();
     vector<t_field*>::const_iterator x_iter;
+    // The Args and Result structs of finished calls, reused unless the
+    // handler keeps references to its arguments
+    string argspool = privatize(argsname) + "Pool";
+    string resultpool = privatize(resultname) + "Pool";
     f_service_ <<
+               indent() << "var " << argspool << " = thrift.NewTStructPool(func() interface{} { return New" << argsname << "() })" << endl;
+
+    if (!tfunction->is_oneway()) {
+        f_service_ <<
+                   indent() << "var " << resultpool << " = thrift.NewTStructPool(func() interface{} { return New" << resultname << "() })" << endl;
+    }
+
+    f_service_ << endl <<
                indent() << "type " << processorName << " struct {" << endl <<
                indent() << "  handler I" << publicize(tservice->get_name()) << endl <<
+               indent() << "  pool bool" << endl <<
                indent() << "}" << endl << endl <<
                indent() << "func (p *" << processorName << ") Process(seqId int32, iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {" << endl;
     indent_up();
     f_service_ <<
-               indent() << "args := New" << argsname << "()" << endl <<
-               indent() << "if err = args.Read(iprot); err != nil {" << endl <<
-               indent() << "  iprot.ReadMessageEnd()" << endl <<
+               indent() << "args, err := p.ReadArgs(iprot)" << endl <<
+               indent() << "if err != nil {" << endl <<
                indent() << "  x := thrift.NewTApplicationException(thrift.PROTOCOL_ERROR, err.Error())" << endl <<
                indent() << "  oprot.WriteMessageBegin(\"" << escape_string(tfunction->get_name()) << "\", thrift.EXCEPTION, seqId)" << endl <<
                indent() << "  x.Write(oprot)" << endl <<
@@ -2329,8 +4296,116 @@ void t_go_generator::generate_process_function(t_service* tservice,
                indent() << "  oprot.Transport().Flush()" << endl <<
                indent() << "  return" << endl <<
                indent() << "}" << endl <<
+               indent() << "return p.ProcessArgs(seqId, args, oprot)" << endl;
+    indent_down();
+    f_service_ <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << processorName << ") IsOneway() bool {" << endl <<
+               indent() << "  return " << (tfunction->is_oneway() ? "true" : "false") << endl <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << processorName << ") ReadArgs(iprot thrift.TProtocol) (interface{}, thrift.TProtocolException) {" << endl;
+    indent_up();
+    f_service_ <<
+               indent() << "var args *" << argsname << endl <<
+               indent() << "if p.pool {" << endl <<
+               indent() << "  args = " << argspool << ".Get().(*" << argsname << ")" << endl;
+
+    if (gen_arena_) {
+        // The arena lives as long as the pooled args, and goes back to its
+        // own pool with them once the reply has been written
+        f_service_ <<
+                   indent() << "  args.arena = thrift.AttachTArena(iprot)" << endl;
+    }
+
+    f_service_ <<
+               indent() << "} else {" << endl <<
+               indent() << "  args = New" << argsname << "()" << endl <<
+               indent() << "}" << endl;
+
+    if (gen_arena_) {
+        f_service_ <<
+                   indent() << "err := args.Read(iprot)" << endl <<
+                   indent() << "thrift.DetachTArena(iprot, args.arena)" << endl <<
+                   indent() << "if err != nil {" << endl <<
+                   indent() << "  thrift.ReleaseTArena(args.arena)" << endl;
+    } else {
+        f_service_ <<
+                   indent() << "if err := args.Read(iprot); err != nil {" << endl;
+    }
+
+    f_service_ <<
+               indent() << "  iprot.ReadMessageEnd()" << endl <<
+               indent() << "  return nil, err" << endl <<
+               indent() << "}" << endl <<
                indent() << "iprot.ReadMessageEnd()" << endl <<
-               indent() << "result := New" << resultname << "()" << endl <<
+               indent() << "return args, nil" << endl;
+    indent_down();
+    f_service_ <<
+               indent() << "}" << endl << endl <<
+               indent() << "func (p *" << processorName << ") ProcessArgs(seqId int32, a interface{}, oprot thrift.TProtocol) (success bool, err thrift.TException) {" << endl;
+    indent_up();
+    t_struct* arg_struct = tfunction->get_arglist();
+    const std::vector<t_field*>& fields = arg_struct->get_members();
+    vector<t_field*>::const_iterator f_iter;
+
+    f_service_ <<
+               indent() << "args := a.(*" << argsname << ")" << endl;
+
+    if (tfunction->is_oneway()) {
+        f_service_ <<
+                   indent() << "if p.pool {" << endl <<
+                   indent() << "  defer func() {" << endl;
+
+        if (gen_arena_) {
+            f_service_ <<
+                       indent() << "    arena := args.arena" << endl;
+        }
+
+        f_service_ <<
+                   indent() << "    args.Reset()" << endl <<
+                   indent() << "    " << argspool << ".Put(args)" << endl;
+
+        if (gen_arena_) {
+            f_service_ <<
+                       indent() << "    thrift.ReleaseTArena(arena)" << endl;
+        }
+
+        f_service_ <<
+                   indent() << "  }()" << endl <<
+                   indent() << "}" << endl;
+    } else {
+        // The handler owns what it returned, so the result keeps none of it
+        f_service_ <<
+                   indent() << "var result *" << resultname << endl <<
+                   indent() << "if p.pool {" << endl <<
+                   indent() << "  result = " << resultpool << ".Get().(*" << resultname << ")" << endl <<
+                   indent() << "  defer func() {" << endl;
+
+        if (gen_arena_) {
+            f_service_ <<
+                       indent() << "    arena := args.arena" << endl;
+        }
+
+        f_service_ <<
+                   indent() << "    args.Reset()" << endl <<
+                   indent() << "    " << argspool << ".Put(args)" << endl <<
+                   indent() << "    *result = " << resultname << "{TStruct: " << privatize(resultname) << "TStruct}" << endl <<
+                   indent() << "    " << resultpool << ".Put(result)" << endl;
+
+        if (gen_arena_) {
+            // Only now is nothing read into the arena still in use
+            f_service_ <<
+                       indent() << "    thrift.ReleaseTArena(arena)" << endl;
+        }
+
+        f_service_ <<
+                   indent() << "  }()" << endl <<
+                   indent() << "} else {" << endl <<
+                   indent() << "  result = New" << resultname << "()" << endl <<
+                   indent() << "}" << endl;
+    }
+
+    f_service_ <<
                indent() << "if ";
 
     if (!tfunction->is_oneway()) {
@@ -2348,9 +4423,6 @@ void t_go_generator::generate_process_function(t_service* tservice,
     }
 
     // Generate the function call
-    t_struct* arg_struct = tfunction->get_arglist();
-    const std::vector<t_field*>& fields = arg_struct->get_members();
-    vector<t_field*>::const_iterator f_iter;
     f_service_ <<
                "err = p.handler." << publicize(tfunction->get_name()) << "(";
     bool first = true;
@@ -2365,7 +4437,21 @@ void t_go_generator::generate_process_function(t_service* tservice,
         f_service_ << "args." << publicize(variable_name_to_go_name((*f_iter)->get_name()));
     }
 
-    f_service_ << "); err != nil {" << endl <<
+    f_service_ << "); err != nil {" << endl;
+
+    // A oneway call is never answered, not even with an exception.
+    if (tfunction->is_oneway()) {
+        f_service_ <<
+                   indent() << "  return" << endl <<
+                   indent() << "}" << endl <<
+                   indent() << "return true, nil" << endl;
+        indent_down();
+        f_service_ <<
+                   indent() << "}" << endl << endl;
+        return;
+    }
+
+    f_service_ <<
                indent() << "  x := thrift.NewTApplicationException(thrift.INTERNAL_ERROR, \"Internal error processing " << escape_string(tfunction->get_name()) << ": \" + err.Error())" << endl <<
                indent() << "  oprot.WriteMessageBegin(\"" << escape_string(tfunction->get_name()) << "\", thrift.EXCEPTION, seqId)" << endl <<
                indent() << "  x.Write(oprot)" << endl <<
@@ -2376,6 +4462,7 @@ void t_go_generator::generate_process_function(t_service* tservice,
                indent() << "if err2 := oprot.WriteMessageBegin(\"" << escape_string(tfunction->get_name()) << "\", thrift.REPLY, seqId); err2 != nil {" << endl <<
                indent() << "  err = err2" << endl <<
                indent() << "}" << endl <<
+               indent() << "thrift.GrowForWrite(oprot, result)" << endl <<
                indent() << "if err2 := result.Write(oprot); err == nil && err2 != nil {" << endl <<
                indent() << "  err = err2" << endl <<
                indent() << "}" << endl <<
@@ -2477,7 +4564,7 @@ void t_go_generator::generate_deserialize_field(ofstream &out,
         generate_deserialize_container(out, type, declare, name, err);
     } else if (type->is_base_type() || type->is_enum()) {
         indent(out) <<
-                    v << ", " << err2 << " := iprot.";
+                    v << ", " << err2 << " := ";
 
         if (type->is_base_type()) {
             t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
@@ -2489,43 +4576,45 @@ void t_go_generator::generate_deserialize_field(ofstream &out,
                 break;
 
             case t_base_type::TYPE_STRING:
-                if (((t_base_type*)type)->is_binary()) {
-                    out << "ReadBinary()";
+                if (prefix == "p." && is_streamed(tfield)) {
+                    out << name << "Stream." << (gen_zero_copy_ ? "ReadBinaryBorrowed(iprot)" : "ReadBinary(iprot)");
+                } else if (((t_base_type*)type)->is_binary()) {
+                    out << (gen_zero_copy_ ? "thrift.ReadBinaryBorrowed(iprot)" : "iprot.ReadBinary()");
                 } else {
-                    out << "ReadString()";
+                    out << (gen_zero_copy_ ? "thrift.ReadStringBorrowed(iprot)" : "iprot.ReadString()");
                 }
 
                 break;
 
             case t_base_type::TYPE_BOOL:
-                out << "ReadBool()";
+                out << "iprot.ReadBool()";
                 break;
 
             case t_base_type::TYPE_BYTE:
-                out << "ReadByte()";
+                out << "iprot.ReadByte()";
                 break;
 
             case t_base_type::TYPE_I16:
-                out << "ReadI16()";
+                out << "iprot.ReadI16()";
                 break;
 
             case t_base_type::TYPE_I32:
-                out << "ReadI32()";
+                out << "iprot.ReadI32()";
                 break;
 
             case t_base_type::TYPE_I64:
-                out << "ReadI64()";
+                out << "iprot.ReadI64()";
                 break;
 
             case t_base_type::TYPE_DOUBLE:
-                out << "ReadDouble()";
+                out << "iprot.ReadDouble()";
                 break;
 
             default:
                 throw "compiler error: no Go name for base type " + t_base_type::t_base_name(tbase);
             }
         } else if (type->is_enum()) {
-            out << "ReadI32()";
+            out << "iprot.ReadI32()";
         }
 
         string structName("\"\"");
@@ -2576,8 +4665,15 @@ void t_go_generator::generate_deserialize_struct(ofstream &out,
         eq = " = ";
     }
 
+    if (gen_arena_) {
+        out <<
+            indent() << prefix << eq << "New" << publicize(type_name(tstruct)) << "FromArena(thrift.ArenaOf(iprot))" << endl;
+    } else {
+        out <<
+            indent() << prefix << eq << "New" << publicize(type_name(tstruct)) << "()" << endl;
+    }
+
     out <<
-        indent() << prefix << eq << "New" << publicize(type_name(tstruct)) << "()" << endl <<
         indent() << err2 << " := " << prefix << ".Read(iprot)" << endl <<
         indent() << "if " << err2 << " != nil { return thrift.NewTProtocolExceptionReadStruct(\"" <<
         escape_string(prefix + tstruct->get_name()) << "\", " <<
@@ -2609,7 +4705,37 @@ void t_go_generator::generate_deserialize_container(ofstream &out,
     }
 
     // Declare variables, read header
-    if (ttype->is_map()) {
+    if (ttype->is_map() && gen_native_containers_) {
+        out <<
+            indent() << "_, _, " << size << ", " << err << " := iprot.ReadMapBegin()" << endl <<
+            indent() << "if " << err << " != nil {" << endl <<
+            indent() << "  return thrift.NewTProtocolExceptionReadField(" <<
+            -1 << ", \"" <<
+            escape_string(prefix) << "\", \"\", " <<
+            err << ")" << endl <<
+            indent() << "}" << endl;
+        generate_native_container_make(out, ttype, prefix, eq, size);
+    } else if (ttype->is_set() && gen_native_containers_) {
+        out <<
+            indent() << "_, " << size << ", " << err << " := iprot.ReadSetBegin()" << endl <<
+            indent() << "if " << err << " != nil {" << endl <<
+            indent() << "  return thrift.NewTProtocolExceptionReadField(" <<
+            -1 << ", \"" <<
+            escape_string(prefix) << "\", \"\", " <<
+            err << ")" << endl <<
+            indent() << "}" << endl;
+        generate_native_container_make(out, ttype, prefix, eq, size);
+    } else if (ttype->is_list() && gen_native_containers_) {
+        out <<
+            indent() << "_, " << size << ", " << err << " := iprot.ReadListBegin()" << endl <<
+            indent() << "if " << err << " != nil {" << endl <<
+            indent() << "  return thrift.NewTProtocolExceptionReadField(" <<
+            -1 << ", \"" <<
+            escape_string(prefix) << "\", \"\", " <<
+            err << ")" << endl <<
+            indent() << "}" << endl;
+        generate_native_container_make(out, ttype, prefix, eq, size);
+    } else if (ttype->is_map()) {
         out <<
             indent() << ktype << ", " << vtype << ", " << size << ", " << err << " := iprot.ReadMapBegin()" << endl <<
             indent() << "if " << err << " != nil {" << endl <<
@@ -2643,23 +4769,37 @@ void t_go_generator::generate_deserialize_container(ofstream &out,
         throw "INVALID TYPE IN generate_deserialize_container '" + ttype->get_name() + "' for prefix '" + prefix + "'";
     }
 
-    // For loop iterates over elements
-    string i = tmp("_i");
-    out <<
-        indent() << "for " << i << ":= 0; " << i << " < " << size << "; " << i << "++ {" << endl;
-    indent_up();
+    string bulk = bulk_list_type(ttype);
 
-    if (ttype->is_map()) {
-        generate_deserialize_map_element(out, (t_map*)ttype, declare, prefix);
-    } else if (ttype->is_set()) {
-        generate_deserialize_set_element(out, (t_set*)ttype, declare, prefix);
-    } else if (ttype->is_list()) {
-        generate_deserialize_list_element(out, (t_list*)ttype, declare, prefix);
-    }
+    if (!bulk.empty()) {
+        // Lists of fixed width numbers are read whole
+        out <<
+            indent() << prefix << ", " << err << " = thrift.Read" << bulk << "List(iprot, " << prefix << ", " << size << ")" << endl <<
+            indent() << "if " << err << " != nil {" << endl <<
+            indent() << "  return thrift.NewTProtocolExceptionReadField(" <<
+            -1 << ", \"" <<
+            escape_string(prefix) << "\", \"\", " <<
+            err << ")" << endl <<
+            indent() << "}" << endl;
+    } else {
+        // For loop iterates over elements
+        string i = tmp("_i");
+        out <<
+            indent() << "for " << i << ":= 0; " << i << " < " << size << "; " << i << "++ {" << endl;
+        indent_up();
 
-    indent_down();
-    out <<
-        indent() << "}" << endl;
+        if (ttype->is_map()) {
+            generate_deserialize_map_element(out, (t_map*)ttype, declare, prefix);
+        } else if (ttype->is_set()) {
+            generate_deserialize_set_element(out, (t_set*)ttype, declare, prefix);
+        } else if (ttype->is_list()) {
+            generate_deserialize_list_element(out, (t_list*)ttype, declare, prefix);
+        }
+
+        indent_down();
+        out <<
+            indent() << "}" << endl;
+    }
 
     // Read container end
     if (ttype->is_map()) {
@@ -2702,8 +4842,14 @@ void t_go_generator::generate_deserialize_map_element(ofstream &out,
     t_field fval(tmap->get_val_type(), val);
     generate_deserialize_field(out, &fkey, true);
     generate_deserialize_field(out, &fval, true);
-    indent(out) <<
-                prefix << ".Set(" << key << ", " << val << ")" << endl;
+
+    if (gen_native_containers_) {
+        indent(out) <<
+                    prefix << "[" << native_key(tmap->get_key_type(), key) << "] = " << val << endl;
+    } else {
+        indent(out) <<
+                    prefix << ".Set(" << key << ", " << val << ")" << endl;
+    }
 }
 
 /**
@@ -2718,8 +4864,14 @@ void t_go_generator::generate_deserialize_set_element(ofstream &out,
     string elem = tmp("_elem");
     t_field felem(tset->get_elem_type(), elem);
     generate_deserialize_field(out, &felem, true, "", err);
-    indent(out) <<
-                prefix << ".Add(" << elem << ")" << endl;
+
+    if (gen_native_containers_) {
+        indent(out) <<
+                    prefix << "[" << native_key(tset->get_elem_type(), elem) << "] = struct{}{}" << endl;
+    } else {
+        indent(out) <<
+                    prefix << ".Add(" << elem << ")" << endl;
+    }
 }
 
 /**
@@ -2732,13 +4884,67 @@ void t_go_generator::generate_deserialize_list_element(ofstream &out,
         string err)
 {
     string elem = tmp("_elem");
+
+    if (is_value_list(tlist)) {
+        // Read into the next element of the backing array, reusing it if
+        // the list has been truncated to make room for this read
+        string err2(tmp("err"));
+        out <<
+            indent() << "if len(" << prefix << ") < cap(" << prefix << ") {" << endl <<
+            indent() << "  " << prefix << " = " << prefix << "[:len(" << prefix << ")+1]" << endl <<
+            indent() << "} else {" << endl <<
+            indent() << "  " << prefix << " = append(" << prefix << ", " << type_to_go_type(tlist).substr(2) << "{})" << endl <<
+            indent() << "}" << endl <<
+            indent() << elem << " := &" << prefix << "[len(" << prefix << ")-1]" << endl <<
+            indent() << elem << ".Reset()" << endl <<
+            indent() << err2 << " := " << elem << ".Read(iprot)" << endl <<
+            indent() << "if " << err2 << " != nil { return thrift.NewTProtocolExceptionReadStruct(\"" <<
+            escape_string(elem + tlist->get_elem_type()->get_name()) << "\", " <<
+            err2 << "); }\n";
+        return;
+    }
+
     t_field felem(tlist->get_elem_type(), elem);
     generate_deserialize_field(out, &felem, true, "", err);
-    indent(out) <<
-                prefix << ".Push(" << elem << ")" << endl;
+
+    if (gen_native_containers_) {
+        indent(out) <<
+                    prefix << " = append(" << prefix << ", " << elem << ")" << endl;
+    } else {
+        indent(out) <<
+                    prefix << ".Push(" << elem << ")" << endl;
+    }
 }
 
 
+/**
+ * Gives a native container being read its storage.  A field of a struct
+ * read after Reset() takes the emptied storage Reset() left in its spare, so
+ * that a pooled struct reads without reallocating; any other read allocates
+ * afresh, leaving what an earlier read returned untouched.
+ */
+void t_go_generator::generate_native_container_make(ofstream &out,
+        t_type* ttype,
+        const string& target,
+        const string& eq,
+        const string& size)
+{
+    string hint("thrift.ContainerCapacityHint(" + size + ")");
+    string make("make(" + type_to_go_type(ttype) + (ttype->is_list() ? ", 0, " : ", ") + hint + ")");
+
+    if (eq != " = " || target.compare(0, 2, "p.") != 0 || struct_spares_.count(target.substr(2)) == 0) {
+        indent(out) << target << eq << make << endl;
+    } else {
+        string spare("p.__spare" + target.substr(2));
+        out <<
+            indent() << "if p.__reuse && " << (ttype->is_list() ? "cap(" + spare + ") >= " + hint : spare + " != nil") << " {" << endl <<
+            indent() << "  " << target << ", " << spare << " = " << spare << ", nil" << endl <<
+            indent() << "} else {" << endl <<
+            indent() << "  " << target << " = " << make << endl <<
+            indent() << "}" << endl;
+    }
+}
+
 /**
  * Serializes a field of any type.
  *
@@ -2770,7 +4976,7 @@ void t_go_generator::generate_serialize_field(ofstream &out,
                                      err);
     } else if (type->is_base_type() || type->is_enum()) {
         indent(out) <<
-                    err << " = oprot.";
+                    err << " = ";
 
         if (type->is_base_type()) {
             t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
@@ -2782,43 +4988,45 @@ void t_go_generator::generate_serialize_field(ofstream &out,
                 break;
 
             case t_base_type::TYPE_STRING:
-                if (((t_base_type*)type)->is_binary()) {
-                    out << "WriteBinary(" << name << ")";
+                if (prefix == "p." && is_streamed(tfield)) {
+                    out << name << "Stream.WriteBinary(oprot, " << name << ")";
+                } else if (((t_base_type*)type)->is_binary()) {
+                    out << "oprot.WriteBinary(" << name << ")";
                 } else {
-                    out << "WriteString(string(" << name << "))";
+                    out << "oprot.WriteString(string(" << name << "))";
                 }
 
                 break;
 
             case t_base_type::TYPE_BOOL:
-                out << "WriteBool(bool(" << name << "))";
+                out << "oprot.WriteBool(bool(" << name << "))";
                 break;
 
             case t_base_type::TYPE_BYTE:
-                out << "WriteByte(byte(" << name << "))";
+                out << "oprot.WriteByte(byte(" << name << "))";
                 break;
 
             case t_base_type::TYPE_I16:
-                out << "WriteI16(int16(" << name << "))";
+                out << "oprot.WriteI16(int16(" << name << "))";
                 break;
 
             case t_base_type::TYPE_I32:
-                out << "WriteI32(int32(" << name << "))";
+                out << "oprot.WriteI32(int32(" << name << "))";
                 break;
 
             case t_base_type::TYPE_I64:
-                out << "WriteI64(int64(" << name << "))";
+                out << "oprot.WriteI64(int64(" << name << "))";
                 break;
 
             case t_base_type::TYPE_DOUBLE:
-                out << "WriteDouble(float64(" << name << "))";
+                out << "oprot.WriteDouble(float64(" << name << "))";
                 break;
 
             default:
                 throw "compiler error: no Go name for base type " + t_base_type::t_base_name(tbase);
             }
         } else if (type->is_enum()) {
-            out << "WriteI32(int32(" << name << "))";
+            out << "oprot.WriteI32(int32(" << name << "))";
         }
 
         string structName = (prefix.size()) ? prefix + "ThriftName()" : "\"\"";
@@ -2854,12 +5062,18 @@ void t_go_generator::generate_serialize_container(ofstream &out,
         string prefix,
         string err)
 {
+    string len(prefix + ".Len()");
+
+    if (gen_native_containers_) {
+        len = "len(" + prefix + ")";
+    }
+
     if (ttype->is_map()) {
         out <<
             indent() << err << " = oprot.WriteMapBegin(" <<
             type_to_enum(((t_map*)ttype)->get_key_type()) << ", " <<
             type_to_enum(((t_map*)ttype)->get_val_type()) << ", " <<
-            prefix << ".Len())" << endl <<
+            len << ")" << endl <<
             indent() << "if " << err << " != nil { return thrift.NewTProtocolExceptionWriteField("
             << -1
             << ", \"" << escape_string(ttype->get_name())
@@ -2868,7 +5082,7 @@ void t_go_generator::generate_serialize_container(ofstream &out,
         out <<
             indent() << err << " = oprot.WriteSetBegin(" <<
             type_to_enum(((t_set*)ttype)->get_elem_type()) << ", " <<
-            prefix << ".Len())" << endl <<
+            len << ")" << endl <<
             indent() << "if " << err << " != nil { return thrift.NewTProtocolExceptionWriteField("
             << -1
             << ", \"" << escape_string(ttype->get_name())
@@ -2877,7 +5091,7 @@ void t_go_generator::generate_serialize_container(ofstream &out,
         out <<
             indent() << err << " = oprot.WriteListBegin(" <<
             type_to_enum(((t_list*)ttype)->get_elem_type()) << ", " <<
-            prefix << ".Len())" << endl <<
+            len << ")" << endl <<
             indent() << "if " << err << " != nil { return thrift.NewTProtocolExceptionWriteField("
             << -1
             << ", \"" << escape_string(ttype->get_name())
@@ -2886,18 +5100,86 @@ void t_go_generator::generate_serialize_container(ofstream &out,
         throw "INVALID TYPE IN generate_serialize_container '" + ttype->get_name() + "' for prefix '" + prefix + "'";
     }
 
-    if (ttype->is_map()) {
+    if (ttype->is_map() && gen_native_containers_) {
         string miter = tmp("Miter");
         string kiter = tmp("Kiter");
         string viter = tmp("Viter");
         t_map* tmap = (t_map*)ttype;
-        out <<
-            indent() << "for " << miter << " := range " << prefix << ".Iter() {" << endl <<
-            indent() << "  " << kiter << ", " << viter << " := " << miter << ".Key().(" << type_to_go_type(tmap->get_key_type()) << "), " << miter << ".Value().(" << type_to_go_type(tmap->get_val_type()) << ")" << endl;
+        t_type* ktype = get_true_type(tmap->get_key_type());
+
+        if (ktype->is_base_type() && ((t_base_type*)ktype)->is_binary()) {
+            out <<
+                indent() << "for " << miter << ", " << viter << " := range " << prefix << " {" << endl <<
+                indent() << "  " << kiter << " := []byte(" << miter << ")" << endl;
+        } else {
+            out <<
+                indent() << "for " << kiter << ", " << viter << " := range " << prefix << " {" << endl;
+        }
+
         indent_up();
         generate_serialize_map_element(out, tmap, kiter, viter);
         indent_down();
         indent(out) << "}" << endl;
+    } else if (ttype->is_set() && gen_native_containers_) {
+        t_set* tset = (t_set*)ttype;
+        t_type* etype = get_true_type(tset->get_elem_type());
+        string iter = tmp("Iter");
+        string iter2 = tmp("Iter");
+
+        if (etype->is_base_type() && ((t_base_type*)etype)->is_binary()) {
+            out <<
+                indent() << "for " << iter << " := range " << prefix << " {" << endl <<
+                indent() << "  " << iter2 << " := []byte(" << iter << ")" << endl;
+        } else {
+            out <<
+                indent() << "for " << iter2 << " := range " << prefix << " {" << endl;
+        }
+
+        indent_up();
+        generate_serialize_set_element(out, tset, iter2);
+        indent_down();
+        indent(out) << "}" << endl;
+    } else if (!bulk_list_type(ttype).empty()) {
+        out <<
+            indent() << err << " = thrift.Write" << bulk_list_type(ttype) << "List(oprot, " << prefix << ")" << endl <<
+            indent() << "if " << err << " != nil { return thrift.NewTProtocolExceptionWriteField("
+            << -1
+            << ", \"" << escape_string(prefix)
+            << "\", " << "\"list\", " << err << "); }" << endl;
+    } else if (ttype->is_list() && gen_native_containers_) {
+        t_list* tlist = (t_list*)ttype;
+        string iter = tmp("Iter");
+
+        if (is_value_list(ttype)) {
+            string idx = tmp("Idx");
+            out <<
+                indent() << "for " << idx << " := range " << prefix << " {" << endl <<
+                indent() << "  " << iter << " := &" << prefix << "[" << idx << "]" << endl;
+        } else {
+            out <<
+                indent() << "for _, " << iter << " := range " << prefix << " {" << endl;
+        }
+
+        indent_up();
+        generate_serialize_list_element(out, tlist, iter);
+        indent_down();
+        indent(out) << "}" << endl;
+    } else if (ttype->is_map()) {
+        string miter = tmp("Miter");
+        string mval = tmp("Miter");
+        string kiter = tmp("Kiter");
+        string viter = tmp("Viter");
+        t_map* tmap = (t_map*)ttype;
+        out <<
+            indent() << err << " = thrift.NewTProtocolExceptionFromOsError(" << prefix << ".ForEach(func(" << miter << ", " << mval << " interface{}) error {" << endl <<
+            indent() << "  " << kiter << ", " << viter << " := " << miter << ".(" << type_to_go_type(tmap->get_key_type()) << "), " << mval << ".(" << type_to_go_type(tmap->get_val_type()) << ")" << endl;
+        indent_up();
+        generate_serialize_map_element(out, tmap, kiter, viter);
+        indent(out) << "return nil" << endl;
+        indent_down();
+        out <<
+            indent() << "}))" << endl <<
+            indent() << "if " << err << " != nil { return " << err << " }" << endl;
     } else if (ttype->is_set()) {
         t_set* tset = (t_set*)ttype;
         string iter = tmp("Iter");
@@ -2914,8 +5196,8 @@ void t_go_generator::generate_serialize_container(ofstream &out,
         string iter = tmp("Iter");
         string iter2 = tmp("Iter");
         out <<
-            indent() << "for " << iter << " := range " << prefix << ".Iter() {" << endl <<
-            indent() << "  " << iter2 << " := " << iter << ".(" << type_to_go_type(tlist->get_elem_type()) << ")" << endl;
+            indent() << "for " << iter << " := 0; " << iter << " < " << len << "; " << iter << "++ {" << endl <<
+            indent() << "  " << iter2 << " := " << prefix << ".At(" << iter << ").(" << type_to_go_type(tlist->get_elem_type()) << ")" << endl;
         indent_up();
         generate_serialize_list_element(out, tlist, iter2);
         indent_down();
@@ -3186,7 +5468,7 @@ string t_go_generator::type_name(t_type* ttype)
 {
     t_program* program = ttype->get_program();
 
-    if (ttype->is_service()) {
+    if (ttype->is_service() && program != NULL && program != program_) {
         return get_real_go_module(program) + "." + ttype->get_name();
     }
 
@@ -3197,6 +5479,139 @@ string t_go_generator::type_name(t_type* ttype)
     return ttype->get_name();
 }
 
+/**
+ * Returns the TCompactProtocol type nibble for a field or element type.
+ */
+int t_go_generator::type_to_compact_type(t_type* type)
+{
+    type = get_true_type(type);
+
+    if (type->is_base_type()) {
+        t_base_type::t_base tbase = ((t_base_type*)type)->get_base();
+
+        switch (tbase) {
+        case t_base_type::TYPE_STRING:
+            return 0x08;
+
+        case t_base_type::TYPE_BOOL:
+            return 0x01;
+
+        case t_base_type::TYPE_BYTE:
+            return 0x03;
+
+        case t_base_type::TYPE_I16:
+            return 0x04;
+
+        case t_base_type::TYPE_I32:
+            return 0x05;
+
+        case t_base_type::TYPE_I64:
+            return 0x06;
+
+        case t_base_type::TYPE_DOUBLE:
+            return 0x07;
+
+        default:
+            throw "compiler error: unhandled type";
+        }
+    } else if (type->is_enum()) {
+        return 0x05;
+    } else if (type->is_struct() || type->is_xception()) {
+        return 0x0C;
+    } else if (type->is_map()) {
+        return 0x0B;
+    } else if (type->is_set()) {
+        return 0x0A;
+    } else if (type->is_list()) {
+        return 0x09;
+    }
+
+    throw "INVALID TYPE IN type_to_compact_type: " + type->get_name();
+}
+
+/**
+ * Returns the bytes of a TCompactProtocol field header for field id
+ * following field last_id.
+ */
+vector<int> t_go_generator::compact_field_header(int compact_type, int id, int last_id)
+{
+    vector<int> bytes;
+
+    if (id > last_id && id - last_id <= 15) {
+        bytes.push_back(((id - last_id) << 4) | compact_type);
+    } else {
+        // The type is followed by the id as a zigzag varint
+        uint32_t zigzag = ((uint32_t)id << 1) ^ (uint32_t)(id >> 31);
+        bytes.push_back(compact_type);
+
+        for (; zigzag >= 0x80; zigzag >>= 7) {
+            bytes.push_back((zigzag & 0x7f) | 0x80);
+        }
+
+        bytes.push_back(zigzag);
+    }
+
+    return bytes;
+}
+
+/**
+ * Renders bytes as a list of Go byte literals.
+ */
+string t_go_generator::go_byte_list(const vector<int>& bytes)
+{
+    static const char* digits = "0123456789abcdef";
+    string result;
+
+    for (vector<int>::const_iterator b_iter = bytes.begin(); b_iter != bytes.end(); ++b_iter) {
+        if (b_iter != bytes.begin()) {
+            result += ", ";
+        }
+
+        result += "0x";
+        result += digits[(*b_iter >> 4) & 0x0f];
+        result += digits[*b_iter & 0x0f];
+    }
+
+    return result;
+}
+
+/**
+ * Returns the encoded size of every value of type ttype under proto, or 0
+ * when that depends on the value.
+ */
+int t_go_generator::fixed_wire_size(const string& proto, t_type* ttype)
+{
+    t_type* type = get_true_type(ttype);
+    bool compact = proto == "Compact";
+
+    if (type->is_enum()) {
+        return compact ? 0 : 4;
+    } else if (!type->is_base_type()) {
+        return 0;
+    }
+
+    switch (((t_base_type*)type)->get_base()) {
+    case t_base_type::TYPE_BOOL:
+    case t_base_type::TYPE_BYTE:
+        return 1;
+
+    case t_base_type::TYPE_I16:
+        return compact ? 0 : 2;
+
+    case t_base_type::TYPE_I32:
+        return compact ? 0 : 4;
+
+    case t_base_type::TYPE_I64:
+        return compact ? 0 : 8;
+
+    case t_base_type::TYPE_DOUBLE:
+        return 8;
+
+    default:
+        return 0;
+    }
+}
+
 /**
  * Converts the parse type to a go tyoe
  */
@@ -3294,21 +5709,36 @@ string t_go_generator::type_to_go_type(t_type* type)
     } else if (type->is_struct() || type->is_xception()) {
         return string("*") + publicize(type->get_name());
     } else if (type->is_map()) {
+        if (gen_native_containers_) {
+            t_map* t = (t_map*)type;
+            string keyType = type_to_go_key_type(t->get_key_type());
+            string valueType = type_to_go_type(t->get_val_type());
+            return string("map[") + keyType + "]" + valueType;
+        }
+
         return "thrift.TMap";
-        //t_map* t = (t_map*)type;
-        //string keyType = type_to_go_type(t->get_key_type());
-        //string valueType = type_to_go_type(t->get_val_type());
-        //return string("map[") + keyType + "]" + valueType;
     } else if (type->is_set()) {
+        if (gen_native_containers_) {
+            t_set* t = (t_set*)type;
+            string elemType = type_to_go_key_type(t->get_elem_type());
+            return string("map[") + elemType + "]struct{}";
+        }
+
         return "thrift.TSet";
-        //t_set* t = (t_set*)type;
-        //string elemType = type_to_go_type(t->get_elem_type());
-        //return string("[]") + elemType;
     } else if (type->is_list()) {
+        if (gen_native_containers_) {
+            t_list* t = (t_list*)type;
+            string elemType = type_to_go_type(t->get_elem_type());
+
+            if (is_value_list(type)) {
+                // Drop the * of the struct pointer
+                return string("[]") + elemType.substr(1);
+            }
+
+            return string("[]") + elemType;
+        }
+
         return "thrift.TList";
-        //t_list* t = (t_list*)type;
-        //string elemType = type_to_go_type(t->get_elem_type());
-        //return string("[]") + elemType;
     } else if (type->is_typedef()) {
         return publicize(((t_typedef*)type)->get_symbolic());
     }
@@ -3317,6 +5747,46 @@ string t_go_generator::type_to_go_type(t_type* type)
 }
 
 
+/**
+ * Converts the parse type to a go type usable as a native map key or set
+ * element.  Binary is keyed by its string form, since []byte is not
+ * comparable in Go.
+ */
+string t_go_generator::type_to_go_key_type(t_type* type)
+{
+    t_type* ttype = get_true_type(type);
+
+    if (ttype->is_container()) {
+        throw "compiler error: native_containers cannot use a container as a map key or set element: " + type->get_name();
+    }
+
+    // A *Foo would key the map by the identity of the struct, not its value
+    if (ttype->is_struct() || ttype->is_xception()) {
+        throw "compiler error: native_containers cannot use a struct as a map key or set element: " + type->get_name();
+    }
+
+    if (ttype->is_base_type() && ((t_base_type*)ttype)->is_binary()) {
+        return "string";
+    }
+
+    return type_to_go_type(type);
+}
+
+/**
+ * Renders the expression used to index a native map or set with the given
+ * deserialized value.
+ */
+string t_go_generator::native_key(t_type* type, const string& value)
+{
+    t_type* ttype = get_true_type(type);
+
+    if (ttype->is_base_type() && ((t_base_type*)ttype)->is_binary()) {
+        return "string(" + value + ")";
+    }
+
+    return value;
+}
+
 /**
  * Converts the parse type to a go tyoe
  */
@@ -3405,4 +5875,22 @@ bool format_go_output(const string &file_path)
 }
 
 
-THRIFT_REGISTER_GENERATOR(go, "Go", "");
+THRIFT_REGISTER_GENERATOR(go, "Go",
+                          "    native_containers:\n"
+                          "                     Use Go maps, slices and map[T]struct{} sets in place of\n"
+                          "                     thrift.TMap, thrift.TList and thrift.TSet.\n"
+                          "    zero_copy:       Read string and binary fields in place from the frame or\n"
+                          "                     buffer they arrive in, so that they are only valid for\n"
+                          "                     as long as it is.\n"
+                          "    binary_streams:  Give each binary field Foo a FooStream through which Write()\n"
+                          "                     and Read() can take it from an io.Reader and copy it into an\n"
+                          "                     io.Writer.\n"
+                          "    value_lists:     With native_containers, hold list<Foo> of structs as []Foo,\n"
+                          "                     read and written in place, rather than []*Foo.\n"
+                          "    arena:           Read structs, strings and binary values into the protocol's\n"
+                          "                     thrift.TArena, which processors release after each reply.\n"
+                          "    isset_bits:      Keep whether optional scalar and enum fields are set in a\n"
+                          "                     bitset, maintained by SetFoo() and UnsetFoo(), so that\n"
+                          "                     they may be set to any value.\n"
+                          "    pack_fields:     Declare struct fields widest alignment first, to leave the\n"
+                          "                     least padding between them, rather than in field id order.\n");
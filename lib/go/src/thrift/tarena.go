@@ -0,0 +1,203 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"sync"
+)
+
+/**
+ * The size of the chunks a TArena hands out bytes from.  Byte values longer
+ * than a quarter of it are allocated on their own.
+ */
+const ArenaChunkSize = 64 << 10
+
+/**
+ * The number of structs of one type that generated code allocates at once
+ * for a TArena.
+ */
+const ArenaSlabLength = 64
+
+/**
+ * Request-scoped storage that reads take their structs and byte values
+ * from, in place of allocating each on its own.  Everything in it is
+ * released in one shot by Reset(), after which it is handed out again: so
+ * nothing read with an arena may be used after its Reset(), and a handler
+ * that keeps what it is passed must implement TArgsRetainer to have its
+ * processor read without one.  A TArena is not safe for concurrent use.
+ */
+type TArena struct {
+	chunks [][]byte
+	chunk  int
+	used   int
+	slabs  []TArenaSlab
+}
+
+/**
+ * A TArena's store of structs of one type, which generated code registers
+ * with NewTArenaSlabId() and reaches through TArena.Slab().  Reset() makes
+ * all of them free to be handed out again.
+ */
+type TArenaSlab interface {
+	Reset()
+}
+
+/**
+ * Implemented by protocols that can read into a TArena; see SetArena().
+ */
+type TArenaUser interface {
+	SetArena(arena *TArena)
+	Arena() *TArena
+}
+
+var (
+	arenaSlabsLock sync.Mutex
+	arenaSlabs     []func() TArenaSlab
+	arenaPool      = sync.Pool{New: func() interface{} { return NewTArena() }}
+)
+
+func NewTArena() *TArena {
+	return &TArena{}
+}
+
+/**
+ * Registers a type of slab, made by newSlab for each TArena that needs one,
+ * returning the id through which it is found with TArena.Slab().
+ */
+func NewTArenaSlabId(newSlab func() TArenaSlab) int {
+	arenaSlabsLock.Lock()
+	defer arenaSlabsLock.Unlock()
+	arenaSlabs = append(arenaSlabs, newSlab)
+	return len(arenaSlabs) - 1
+}
+
+/**
+ * The arena's slab for the type registered as id.
+ */
+func (a *TArena) Slab(id int) TArenaSlab {
+	if id >= len(a.slabs) {
+		slabs := make([]TArenaSlab, id+1)
+		copy(slabs, a.slabs)
+		a.slabs = slabs
+	}
+	if a.slabs[id] == nil {
+		arenaSlabsLock.Lock()
+		a.slabs[id] = arenaSlabs[id]()
+		arenaSlabsLock.Unlock()
+	}
+	return a.slabs[id]
+}
+
+/**
+ * n bytes of the arena, whose contents are left as the last request that
+ * used them wrote them.  Appending to them reallocates rather than writing
+ * over what follows.
+ */
+func (a *TArena) Bytes(n int) []byte {
+	if n > ArenaChunkSize/4 {
+		return make([]byte, n)
+	}
+	if a.chunk == len(a.chunks) || a.used+n > ArenaChunkSize {
+		if a.chunk < len(a.chunks) {
+			a.chunk++
+		}
+		if a.chunk == len(a.chunks) {
+			a.chunks = append(a.chunks, make([]byte, ArenaChunkSize))
+		}
+		a.used = 0
+	}
+	buf := a.chunks[a.chunk][a.used : a.used+n : a.used+n]
+	a.used += n
+	return buf
+}
+
+/**
+ * Releases everything taken from the arena, which keeps its chunks and
+ * slabs to hand out again.
+ */
+func (a *TArena) Reset() {
+	a.chunk = 0
+	a.used = 0
+	for _, slab := range a.slabs {
+		if slab != nil {
+			slab.Reset()
+		}
+	}
+}
+
+/**
+ * Has prot read into arena from now on, or allocate afresh again if arena
+ * is nil, returning false if prot is not a TArenaUser.  Code generated with
+ * "--gen go:arena" takes structs from the arena of the protocol they are
+ * read with.
+ */
+func SetArena(prot TProtocol, arena *TArena) bool {
+	if user, ok := prot.(TArenaUser); ok {
+		user.SetArena(arena)
+		return true
+	}
+	return false
+}
+
+/**
+ * The arena prot reads into, or nil.
+ */
+func ArenaOf(prot TProtocol) *TArena {
+	if user, ok := prot.(TArenaUser); ok {
+		return user.Arena()
+	}
+	return nil
+}
+
+/**
+ * Gives prot an arena for the request about to be read with it, drawn from
+ * a pool shared by all processors, and returns it; or returns nil if prot
+ * cannot take an arena or already has one.  Generated processors call it
+ * before reading a call's arguments, DetachTArena() once they are read, and
+ * ReleaseTArena() once the reply has been written.
+ */
+func AttachTArena(prot TProtocol) *TArena {
+	user, ok := prot.(TArenaUser)
+	if !ok || user.Arena() != nil {
+		return nil
+	}
+	arena := arenaPool.Get().(*TArena)
+	user.SetArena(arena)
+	return arena
+}
+
+/**
+ * Takes arena, if not nil, from prot again; see AttachTArena().
+ */
+func DetachTArena(prot TProtocol, arena *TArena) {
+	if arena != nil {
+		SetArena(prot, nil)
+	}
+}
+
+/**
+ * Resets arena, if not nil, and returns it to the pool; see AttachTArena().
+ */
+func ReleaseTArena(arena *TArena) {
+	if arena != nil {
+		arena.Reset()
+		arenaPool.Put(arena)
+	}
+}
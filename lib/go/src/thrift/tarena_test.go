@@ -0,0 +1,136 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"testing"
+)
+
+type arenaTestSlab struct {
+	resets int
+}
+
+func (s *arenaTestSlab) Reset() {
+	s.resets++
+}
+
+var arenaTestSlabId = NewTArenaSlabId(func() TArenaSlab { return new(arenaTestSlab) })
+
+func TestArenaBytesReusedAfterReset(t *testing.T) {
+	arena := NewTArena()
+	first := arena.Bytes(100)
+	second := arena.Bytes(ArenaChunkSize / 4)
+	if &first[0] != &arena.chunks[0][0] || &second[0] != &arena.chunks[0][100] {
+		t.Fatalf("arena.Bytes() did not carve consecutive values from one chunk")
+	}
+	if cap(first) != len(first) {
+		t.Errorf("arena.Bytes(100) has capacity %d, so appending to it would overwrite what follows", cap(first))
+	}
+	third := arena.Bytes(ArenaChunkSize / 2)
+	if len(arena.chunks) != 1 {
+		t.Errorf("a value larger than a quarter chunk was taken from a chunk")
+	}
+	for i := 0; i < 4; i++ {
+		arena.Bytes(ArenaChunkSize / 4)
+	}
+	if len(arena.chunks) != 2 {
+		t.Fatalf("filling a chunk left the arena with %d chunks, not 2", len(arena.chunks))
+	}
+	arena.Reset()
+	if again := arena.Bytes(100); &again[0] != &first[0] {
+		t.Errorf("arena.Bytes() did not reuse its first chunk after Reset()")
+	}
+	if len(third) != ArenaChunkSize/2 {
+		t.Errorf("arena.Bytes(%d) has length %d", ArenaChunkSize/2, len(third))
+	}
+	if empty := NewTArena().Bytes(0); empty == nil {
+		t.Errorf("arena.Bytes(0) is nil rather than empty")
+	}
+}
+
+func TestArenaSlabs(t *testing.T) {
+	arena := NewTArena()
+	slab := arena.Slab(arenaTestSlabId).(*arenaTestSlab)
+	if arena.Slab(arenaTestSlabId) != slab {
+		t.Fatalf("arena.Slab() made a second slab for the same id")
+	}
+	arena.Reset()
+	arena.Reset()
+	if slab.resets != 2 {
+		t.Errorf("slab was reset %d times by two arena.Reset()s", slab.resets)
+	}
+}
+
+func testArenaProtocolRead(t *testing.T, protocolFactory TProtocolFactory) {
+	buffer := NewTMemoryBuffer()
+	protocol := protocolFactory.GetProtocol(buffer)
+	protocol.WriteBinary([]byte("binary value"))
+	protocol.WriteString("string value")
+	protocol.Flush()
+	arena := NewTArena()
+	if !SetArena(protocol, arena) || ArenaOf(protocol) != arena {
+		t.Fatalf("%T does not take an arena", protocol)
+	}
+	binary, err := protocol.ReadBinary()
+	if err != nil || string(binary) != "binary value" {
+		t.Fatalf("ReadBinary() with an arena read %q, %v", binary, err)
+	}
+	str, err := protocol.ReadString()
+	if err != nil || str != "string value" {
+		t.Fatalf("ReadString() with an arena read %q, %v", str, err)
+	}
+	if &binary[0] != &arena.chunks[0][0] {
+		t.Errorf("%T did not read a binary value into its arena", protocol)
+	}
+	arena.Reset()
+	copy(arena.Bytes(len(binary)+len(str)), "overwritten by the next request")
+	if str == "string value" {
+		t.Errorf("%T did not read a string into its arena", protocol)
+	}
+}
+
+func TestBinaryProtocolReadArena(t *testing.T) {
+	testArenaProtocolRead(t, NewTBinaryProtocolFactoryDefault())
+}
+
+func TestCompactProtocolReadArena(t *testing.T) {
+	testArenaProtocolRead(t, NewTCompactProtocolFactory())
+}
+
+func TestAttachTArena(t *testing.T) {
+	protocol := NewTBinaryProtocolTransport(NewTMemoryBuffer())
+	arena := AttachTArena(protocol)
+	if arena == nil || ArenaOf(protocol) != arena {
+		t.Fatalf("AttachTArena() did not give the protocol an arena")
+	}
+	if AttachTArena(protocol) != nil {
+		t.Errorf("AttachTArena() replaced an arena the protocol already had")
+	}
+	DetachTArena(protocol, arena)
+	if ArenaOf(protocol) != nil {
+		t.Errorf("DetachTArena() left the protocol its arena")
+	}
+	ReleaseTArena(arena)
+	ReleaseTArena(nil)
+	json := NewTJSONProtocol(NewTMemoryBuffer())
+	if AttachTArena(json) != nil || SetArena(json, NewTArena()) {
+		t.Errorf("the JSON protocol took an arena it cannot use")
+	}
+}
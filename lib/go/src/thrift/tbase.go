@@ -64,3 +64,38 @@ type TBase interface {
 
 	DeepCopy() TBase
 }
+
+/**
+ * Implemented by generated structs, which know exactly how many bytes they
+ * take up when written with a TBinaryProtocol or a TCompactProtocol.
+ */
+type TSizer interface {
+	BinarySize() int
+	CompactSize() int
+}
+
+/**
+ * Implemented by transports that buffer what is written to them, and can
+ * make room for a known amount of it up front.
+ */
+type TGrower interface {
+	Grow(n int)
+}
+
+/**
+ * Makes room in oprot's transport for s as oprot will write it, so that the
+ * write buffer is grown once rather than repeatedly as s is written.  Does
+ * nothing unless both the size and the transport's buffer are known.
+ */
+func GrowForWrite(oprot TProtocol, s TSizer) {
+	grower, ok := oprot.Transport().(TGrower)
+	if !ok {
+		return
+	}
+	switch oprot.(type) {
+	case *TBinaryProtocol:
+		grower.Grow(s.BinarySize())
+	case *TCompactProtocol:
+		grower.Grow(s.CompactSize())
+	}
+}
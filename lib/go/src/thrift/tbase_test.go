@@ -0,0 +1,60 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"testing"
+)
+
+type fixedSizer struct {
+	binary, compact int
+}
+
+func (p fixedSizer) BinarySize() int  { return p.binary }
+func (p fixedSizer) CompactSize() int { return p.compact }
+
+func TestGrowForWrite(t *testing.T) {
+	sizer := fixedSizer{binary: 1 << 20, compact: 1 << 18}
+	var protocols = []struct {
+		name     string
+		builder  func(TTransport) TProtocol
+		expected int
+	}{
+		{"TBinaryProtocol", func(trans TTransport) TProtocol { return NewTBinaryProtocolTransport(trans) }, sizer.binary},
+		{"TCompactProtocol", func(trans TTransport) TProtocol { return NewTCompactProtocol(trans) }, sizer.compact},
+		{"TJSONProtocol", func(trans TTransport) TProtocol { return NewTJSONProtocol(trans) }, 0},
+	}
+
+	for _, definition := range protocols {
+		memory := NewTMemoryBuffer()
+		GrowForWrite(definition.builder(memory), sizer)
+
+		if capacity := memory.buf.Cap(); capacity < definition.expected || (definition.expected == 0 && capacity != 0) {
+			t.Errorf("%s: TMemoryBuffer capacity %d after growing for %d bytes", definition.name, capacity, definition.expected)
+		}
+
+		framed := NewTFramedTransport(NewTMemoryBuffer())
+		GrowForWrite(definition.builder(framed), sizer)
+
+		if capacity := framed.writeBuffer.Cap(); capacity < definition.expected {
+			t.Errorf("%s: TFramedTransport capacity %d after growing for %d bytes", definition.name, capacity, definition.expected)
+		}
+	}
+}
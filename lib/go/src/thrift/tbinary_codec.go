@@ -0,0 +1,366 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"encoding/binary"
+	"math"
+)
+
+/**
+ * Byte slice codec for the TBinaryProtocol wire format.
+ *
+ * The Append* functions add the encoding of a single value to the end of a
+ * slice and return the extended slice, in the manner of the strconv Append
+ * functions.  TBinaryDecoder reads values back out of a slice.  Neither goes
+ * through a TProtocol or TTransport, and both produce and accept exactly the
+ * bytes TBinaryProtocol does, so generated MarshalBinaryThrift() and
+ * UnmarshalBinaryThrift() methods built on them interoperate with it.
+ */
+
+func AppendBinaryBool(buf []byte, value bool) []byte {
+	if value {
+		return append(buf, 1)
+	}
+	return append(buf, 0)
+}
+
+func AppendBinaryByte(buf []byte, value byte) []byte {
+	return append(buf, value)
+}
+
+func AppendBinaryI16(buf []byte, value int16) []byte {
+	return append(buf, byte(value>>8), byte(value))
+}
+
+func AppendBinaryI32(buf []byte, value int32) []byte {
+	return append(buf, byte(value>>24), byte(value>>16), byte(value>>8), byte(value))
+}
+
+func AppendBinaryI64(buf []byte, value int64) []byte {
+	return append(buf, byte(value>>56), byte(value>>48), byte(value>>40), byte(value>>32),
+		byte(value>>24), byte(value>>16), byte(value>>8), byte(value))
+}
+
+func AppendBinaryDouble(buf []byte, value float64) []byte {
+	return AppendBinaryI64(buf, int64(math.Float64bits(value)))
+}
+
+func AppendBinaryString(buf []byte, value string) []byte {
+	return append(AppendBinaryI32(buf, int32(len(value))), value...)
+}
+
+func AppendBinaryBinary(buf []byte, value []byte) []byte {
+	return append(AppendBinaryI32(buf, int32(len(value))), value...)
+}
+
+func AppendBinaryFieldBegin(buf []byte, typeId TType, id int16) []byte {
+	return append(buf, typeId.ThriftTypeId(), byte(id>>8), byte(id))
+}
+
+func AppendBinaryFieldStop(buf []byte) []byte {
+	return append(buf, STOP)
+}
+
+func AppendBinaryMapBegin(buf []byte, keyType TType, valueType TType, size int) []byte {
+	return AppendBinaryI32(append(buf, keyType.ThriftTypeId(), valueType.ThriftTypeId()), int32(size))
+}
+
+func AppendBinaryListBegin(buf []byte, elemType TType, size int) []byte {
+	return AppendBinaryI32(append(buf, elemType.ThriftTypeId()), int32(size))
+}
+
+func AppendBinarySetBegin(buf []byte, elemType TType, size int) []byte {
+	return AppendBinaryI32(append(buf, elemType.ThriftTypeId()), int32(size))
+}
+
+/**
+ * Reads TBinaryProtocol encoded values from a byte slice.  Strings and binary
+ * values are copied out, so the slice may be reused once decoding is done.
+ */
+type TBinaryDecoder struct {
+	buf []byte
+	pos int
+}
+
+func NewTBinaryDecoder(buf []byte) *TBinaryDecoder {
+	return &TBinaryDecoder{buf: buf}
+}
+
+/**
+ * Returns the bytes that have not been read yet.
+ */
+func (p *TBinaryDecoder) Remaining() []byte {
+	return p.buf[p.pos:]
+}
+
+func (p *TBinaryDecoder) next(n int) ([]byte, TProtocolException) {
+	if n < 0 {
+		return nil, NewTProtocolException(NEGATIVE_SIZE, "Negative length in binary data")
+	}
+	if len(p.buf)-p.pos < n {
+		return nil, NewTProtocolException(INVALID_DATA, "Unexpected end of binary data")
+	}
+	b := p.buf[p.pos : p.pos+n]
+	p.pos += n
+	return b, nil
+}
+
+func (p *TBinaryDecoder) ReadBool() (bool, TProtocolException) {
+	b, err := p.ReadByte()
+	return b == 1, err
+}
+
+func (p *TBinaryDecoder) ReadByte() (byte, TProtocolException) {
+	if p.pos >= len(p.buf) {
+		return 0, NewTProtocolException(INVALID_DATA, "Unexpected end of binary data")
+	}
+	b := p.buf[p.pos]
+	p.pos++
+	return b, nil
+}
+
+func (p *TBinaryDecoder) ReadI16() (int16, TProtocolException) {
+	b, err := p.next(2)
+	if err != nil {
+		return 0, err
+	}
+	return int16(binary.BigEndian.Uint16(b)), nil
+}
+
+func (p *TBinaryDecoder) ReadI32() (int32, TProtocolException) {
+	b, err := p.next(4)
+	if err != nil {
+		return 0, err
+	}
+	return int32(binary.BigEndian.Uint32(b)), nil
+}
+
+func (p *TBinaryDecoder) ReadI64() (int64, TProtocolException) {
+	b, err := p.next(8)
+	if err != nil {
+		return 0, err
+	}
+	return int64(binary.BigEndian.Uint64(b)), nil
+}
+
+func (p *TBinaryDecoder) ReadDouble() (float64, TProtocolException) {
+	b, err := p.next(8)
+	if err != nil {
+		return 0, err
+	}
+	return math.Float64frombits(binary.BigEndian.Uint64(b)), nil
+}
+
+func (p *TBinaryDecoder) ReadString() (string, TProtocolException) {
+	size, err := p.ReadI32()
+	if err != nil {
+		return "", err
+	}
+	b, err := p.next(int(size))
+	if err != nil {
+		return "", err
+	}
+	return string(b), nil
+}
+
+func (p *TBinaryDecoder) ReadBinary() ([]byte, TProtocolException) {
+	size, err := p.ReadI32()
+	if err != nil {
+		return nil, err
+	}
+	b, err := p.next(int(size))
+	if err != nil {
+		return nil, err
+	}
+	value := make([]byte, len(b))
+	copy(value, b)
+	return value, nil
+}
+
+/**
+ * Returns a binary value as a subslice of the decoder's buffer rather than
+ * a copy; see TBorrowingReader.
+ */
+func (p *TBinaryDecoder) ReadBinaryBorrowed() ([]byte, TProtocolException) {
+	size, err := p.ReadI32()
+	if err != nil {
+		return nil, err
+	}
+	return p.next(int(size))
+}
+
+/**
+ * Returns a string sharing the decoder's buffer rather than a copy; see
+ * TBorrowingReader.
+ */
+func (p *TBinaryDecoder) ReadStringBorrowed() (string, TProtocolException) {
+	size, err := p.ReadI32()
+	if err != nil {
+		return "", err
+	}
+	b, err := p.next(int(size))
+	if err != nil {
+		return "", err
+	}
+	return borrowString(b), nil
+}
+
+/**
+ * Reads a field header.  The id is zero when typeId is STOP.
+ */
+func (p *TBinaryDecoder) ReadFieldBegin() (typeId TType, id int16, err TProtocolException) {
+	t, err := p.ReadByte()
+	if err != nil || t == STOP {
+		return TType(t), 0, err
+	}
+	id, err = p.ReadI16()
+	return TType(t), id, err
+}
+
+/**
+ * Whether a container may hold elements of type t.  Skip() reads nothing
+ * for a STOP, so a container of them would have it loop without end.
+ */
+func isBinaryElementType(t TType) bool {
+	switch t {
+	case BOOL, BYTE, I16, I32, I64, DOUBLE, STRING, BINARY, STRUCT, MAP, SET, LIST:
+		return true
+	}
+	return false
+}
+
+/**
+ * Reads a map header.  Every key and value takes at least a byte, so a size
+ * the bytes left cannot hold is refused, as are the types of a map that is
+ * not empty unless values may have them.
+ */
+func (p *TBinaryDecoder) ReadMapBegin() (keyType TType, valueType TType, size int, err TProtocolException) {
+	b, err := p.next(6)
+	if err != nil {
+		return STOP, STOP, 0, err
+	}
+	size = int(int32(binary.BigEndian.Uint32(b[2:])))
+	if size < 0 {
+		return STOP, STOP, 0, NewTProtocolException(NEGATIVE_SIZE, "Negative map size in binary data")
+	}
+	if size > (len(p.buf)-p.pos)/2 {
+		return STOP, STOP, 0, NewTProtocolException(INVALID_DATA, "Map size exceeds the binary data left")
+	}
+	if size > 0 && (!isBinaryElementType(TType(b[0])) || !isBinaryElementType(TType(b[1]))) {
+		return STOP, STOP, 0, NewTProtocolException(INVALID_DATA, "Invalid map key or value type in binary data")
+	}
+	return TType(b[0]), TType(b[1]), size, nil
+}
+
+/**
+ * Reads a list or set header, refusing it as ReadMapBegin() does a map's.
+ */
+func (p *TBinaryDecoder) ReadListBegin() (elemType TType, size int, err TProtocolException) {
+	b, err := p.next(5)
+	if err != nil {
+		return STOP, 0, err
+	}
+	size = int(int32(binary.BigEndian.Uint32(b[1:])))
+	if size < 0 {
+		return STOP, 0, NewTProtocolException(NEGATIVE_SIZE, "Negative list size in binary data")
+	}
+	if size > len(p.buf)-p.pos {
+		return STOP, 0, NewTProtocolException(INVALID_DATA, "List size exceeds the binary data left")
+	}
+	if size > 0 && !isBinaryElementType(TType(b[0])) {
+		return STOP, 0, NewTProtocolException(INVALID_DATA, "Invalid list element type in binary data")
+	}
+	return TType(b[0]), size, nil
+}
+
+func (p *TBinaryDecoder) ReadSetBegin() (elemType TType, size int, err TProtocolException) {
+	return p.ReadListBegin()
+}
+
+/**
+ * Skips over a value of the given type, descending no further than
+ * MaxSkipDepth into nested structs and containers.
+ */
+func (p *TBinaryDecoder) Skip(fieldType TType) TProtocolException {
+	return p.skip(fieldType, MaxSkipDepth)
+}
+
+func (p *TBinaryDecoder) skip(fieldType TType, maxDepth int) TProtocolException {
+	if maxDepth <= 0 {
+		return NewTProtocolException(INVALID_DATA, "Maximum skip depth exceeded")
+	}
+	var err TProtocolException
+	switch fieldType {
+	case STOP:
+	case BOOL, BYTE:
+		_, err = p.next(1)
+	case I16:
+		_, err = p.next(2)
+	case I32:
+		_, err = p.next(4)
+	case I64, DOUBLE:
+		_, err = p.next(8)
+	case STRING, BINARY:
+		var size int32
+		if size, err = p.ReadI32(); err == nil {
+			_, err = p.next(int(size))
+		}
+	case STRUCT:
+		for {
+			typeId, _, err := p.ReadFieldBegin()
+			if err != nil {
+				return err
+			}
+			if typeId == STOP {
+				break
+			}
+			if err = p.skip(typeId, maxDepth-1); err != nil {
+				return err
+			}
+		}
+	case MAP:
+		keyType, valueType, size, err := p.ReadMapBegin()
+		if err != nil {
+			return err
+		}
+		for i := 0; i < size; i++ {
+			if err = p.skip(keyType, maxDepth-1); err != nil {
+				return err
+			}
+			if err = p.skip(valueType, maxDepth-1); err != nil {
+				return err
+			}
+		}
+	case SET, LIST:
+		elemType, size, err := p.ReadListBegin()
+		if err != nil {
+			return err
+		}
+		for i := 0; i < size; i++ {
+			if err = p.skip(elemType, maxDepth-1); err != nil {
+				return err
+			}
+		}
+	default:
+		return NewTProtocolException(INVALID_DATA, "Unknown type "+fieldType.String()+" in binary data")
+	}
+	return err
+}
@@ -0,0 +1,171 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"testing"
+)
+
+func TestBinaryCodecMatchesTBinaryProtocol(t *testing.T) {
+	transport := NewTMemoryBuffer()
+	p := NewTBinaryProtocolTransport(transport)
+	p.WriteFieldBegin("a", I32, 3)
+	p.WriteI32(-7)
+	p.WriteFieldBegin("b", STRING, 4)
+	p.WriteString("hello")
+	p.WriteFieldBegin("c", MAP, 5)
+	p.WriteMapBegin(BYTE, DOUBLE, 1)
+	p.WriteByte(9)
+	p.WriteDouble(2.5)
+	p.WriteFieldBegin("d", LIST, 6)
+	p.WriteListBegin(I64, 2)
+	p.WriteI64(1 << 40)
+	p.WriteI64(-1)
+	p.WriteFieldBegin("e", SET, 7)
+	p.WriteSetBegin(BOOL, 1)
+	p.WriteBool(true)
+	p.WriteFieldBegin("f", I16, 8)
+	p.WriteI16(-300)
+	p.WriteFieldStop()
+
+	var buf []byte
+	buf = AppendBinaryFieldBegin(buf, I32, 3)
+	buf = AppendBinaryI32(buf, -7)
+	buf = AppendBinaryFieldBegin(buf, STRING, 4)
+	buf = AppendBinaryString(buf, "hello")
+	buf = AppendBinaryFieldBegin(buf, MAP, 5)
+	buf = AppendBinaryMapBegin(buf, BYTE, DOUBLE, 1)
+	buf = AppendBinaryByte(buf, 9)
+	buf = AppendBinaryDouble(buf, 2.5)
+	buf = AppendBinaryFieldBegin(buf, LIST, 6)
+	buf = AppendBinaryListBegin(buf, I64, 2)
+	buf = AppendBinaryI64(buf, 1<<40)
+	buf = AppendBinaryI64(buf, -1)
+	buf = AppendBinaryFieldBegin(buf, SET, 7)
+	buf = AppendBinarySetBegin(buf, BOOL, 1)
+	buf = AppendBinaryBool(buf, true)
+	buf = AppendBinaryFieldBegin(buf, I16, 8)
+	buf = AppendBinaryI16(buf, -300)
+	buf = AppendBinaryFieldStop(buf)
+
+	if !bytes.Equal(buf, transport.Bytes()) {
+		t.Fatalf("Append functions wrote %v, TBinaryProtocol wrote %v", buf, transport.Bytes())
+	}
+
+	d := NewTBinaryDecoder(buf)
+
+	if typeId, id, err := d.ReadFieldBegin(); err != nil || typeId != I32 || id != 3 {
+		t.Fatalf("ReadFieldBegin() = %v, %v, %v", typeId, id, err)
+	}
+
+	if v, err := d.ReadI32(); err != nil || v != -7 {
+		t.Fatalf("ReadI32() = %v, %v", v, err)
+	}
+
+	if typeId, _, _ := d.ReadFieldBegin(); typeId != STRING {
+		t.Fatalf("Expected STRING field, got %v", typeId)
+	}
+
+	if v, err := d.ReadString(); err != nil || v != "hello" {
+		t.Fatalf("ReadString() = %q, %v", v, err)
+	}
+
+	for {
+		typeId, _, err := d.ReadFieldBegin()
+
+		if err != nil {
+			t.Fatalf("Could not read field header: %v", err)
+		}
+
+		if typeId == STOP {
+			break
+		}
+
+		if err := d.Skip(typeId); err != nil {
+			t.Fatalf("Could not skip %v: %v", typeId, err)
+		}
+	}
+
+	if len(d.Remaining()) != 0 {
+		t.Errorf("%d bytes left after STOP", len(d.Remaining()))
+	}
+}
+
+func TestBinaryDecoderRejectsBadInput(t *testing.T) {
+	if _, err := NewTBinaryDecoder([]byte{0, 0, 0}).ReadI32(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a short i32, got %v", err)
+	}
+
+	if _, err := NewTBinaryDecoder(AppendBinaryI32(nil, 8)).ReadString(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a short string, got %v", err)
+	}
+
+	if _, err := NewTBinaryDecoder(AppendBinaryI32(nil, -1)).ReadBinary(); err == nil || err.TypeId() != NEGATIVE_SIZE {
+		t.Errorf("Expected NEGATIVE_SIZE for a negative length, got %v", err)
+	}
+
+	if _, _, err := NewTBinaryDecoder([]byte{byte(I32), 0xff, 0xff, 0xff, 0xff}).ReadListBegin(); err == nil || err.TypeId() != NEGATIVE_SIZE {
+		t.Errorf("Expected NEGATIVE_SIZE for a negative list size, got %v", err)
+	}
+
+	// A struct holding each container, which Skip() would otherwise loop
+	// over 2^31 times without reading a byte
+	for _, field := range []struct {
+		typeId TType
+		header []byte
+	}{
+		{LIST, AppendBinaryListBegin(nil, STOP, 0x7fffffff)},
+		{SET, AppendBinaryListBegin(nil, VOID, 0x7fffffff)},
+		{MAP, AppendBinaryMapBegin(nil, STOP, STOP, 0x7fffffff)},
+		{LIST, AppendBinaryListBegin(nil, STOP, 1)},
+		{MAP, AppendBinaryMapBegin(nil, I32, TType(9), 1)},
+	} {
+		data := append(AppendBinaryFieldBegin(nil, field.typeId, 1), field.header...)
+		data = AppendBinaryFieldStop(append(data, 0, 0, 0, 0))
+
+		if err := NewTBinaryDecoder(data).Skip(STRUCT); err == nil || err.TypeId() != INVALID_DATA {
+			t.Errorf("Expected INVALID_DATA skipping % x, got %v", data, err)
+		}
+	}
+
+	if _, _, err := NewTBinaryDecoder(AppendBinaryListBegin(nil, I32, 2)).ReadListBegin(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a list larger than the data left, got %v", err)
+	}
+
+	if _, _, _, err := NewTBinaryDecoder(AppendBinaryMapBegin(nil, STOP, STOP, 0)).ReadMapBegin(); err != nil {
+		t.Errorf("Could not read an empty map of STOPs: %v", err)
+	}
+}
+
+func TestBinaryDecoderCopiesBinary(t *testing.T) {
+	buf := AppendBinaryBinary(nil, []byte("abc"))
+	v, err := NewTBinaryDecoder(buf).ReadBinary()
+
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	buf[4] = 'x'
+
+	if string(v) != "abc" {
+		t.Errorf("ReadBinary() result aliases its input: %q", v)
+	}
+}
@@ -23,7 +23,6 @@ import (
 	"encoding/binary"
 	"io"
 	"math"
-	"strings"
 )
 
 type TBinaryProtocol struct {
@@ -33,6 +32,46 @@ type TBinaryProtocol struct {
 	_StrictWrite     bool
 	_ReadLength      int
 	_CheckReadLength bool
+
+	/**
+	 * Scratch space that fixed width values are encoded into and decoded
+	 * from, so that they need not be allocated one at a time.  Reads and
+	 * writes have their own, since one goroutine may read requests while
+	 * another writes replies.
+	 */
+	readBuffer  [8]byte
+	writeBuffer [8]byte
+
+	/**
+	 * Reused to receive string bodies of up to maxStringScratch bytes before
+	 * they are copied into a string.
+	 */
+	stringBuffer []byte
+
+	/**
+	 * Reused to encode the elements of a bulk list into before they are
+	 * written; see TListWriter.
+	 */
+	listBuffer []byte
+
+	/**
+	 * Where binary values and strings are read into, if set; see TArena.
+	 */
+	arena *TArena
+}
+
+/**
+ * Strings longer than this are read into a buffer of their own rather than
+ * growing stringBuffer, which lives as long as the protocol does.
+ */
+const maxStringScratch = 4096
+
+/**
+ * Implemented by transports that can take a string without it first being
+ * converted into a []byte.
+ */
+type stringWriter interface {
+	WriteString(value string) (int, error)
 }
 
 type TBinaryProtocolFactory struct {
@@ -174,41 +213,27 @@ func (p *TBinaryProtocol) WriteBool(value bool) TProtocolException {
 }
 
 func (p *TBinaryProtocol) WriteByte(value byte) TProtocolException {
-	v := []byte{value}
-	_, e := p.trans.Write(v)
+	p.writeBuffer[0] = value
+	_, e := p.trans.Write(p.writeBuffer[:1])
 	return NewTProtocolExceptionFromOsError(e)
 }
 
 func (p *TBinaryProtocol) WriteI16(value int16) TProtocolException {
-	h := byte(0xff & (value >> 8))
-	l := byte(0xff & value)
-	v := []byte{h, l}
-	_, e := p.trans.Write(v)
+	binary.BigEndian.PutUint16(p.writeBuffer[:2], uint16(value))
+	_, e := p.trans.Write(p.writeBuffer[:2])
 	return NewTProtocolExceptionFromOsError(e)
 }
 
 func (p *TBinaryProtocol) WriteI32(value int32) TProtocolException {
-	a := byte(0xff & (value >> 24))
-	b := byte(0xff & (value >> 16))
-	c := byte(0xff & (value >> 8))
-	d := byte(0xff & value)
-	v := []byte{a, b, c, d}
-	_, e := p.trans.Write(v)
+	binary.BigEndian.PutUint32(p.writeBuffer[:4], uint32(value))
+	_, e := p.trans.Write(p.writeBuffer[:4])
 	return NewTProtocolExceptionFromOsError(e)
 }
 
 func (p *TBinaryProtocol) WriteI64(value int64) TProtocolException {
-	a := byte(0xff & (value >> 56))
-	b := byte(0xff & (value >> 48))
-	c := byte(0xff & (value >> 40))
-	d := byte(0xff & (value >> 32))
-	e := byte(0xff & (value >> 24))
-	f := byte(0xff & (value >> 16))
-	g := byte(0xff & (value >> 8))
-	h := byte(0xff & value)
-	v := []byte{a, b, c, d, e, f, g, h}
-	_, err := p.trans.Write(v)
-	return NewTProtocolExceptionFromOsError(err)
+	binary.BigEndian.PutUint64(p.writeBuffer[:8], uint64(value))
+	_, e := p.trans.Write(p.writeBuffer[:8])
+	return NewTProtocolExceptionFromOsError(e)
 }
 
 func (p *TBinaryProtocol) WriteDouble(value float64) TProtocolException {
@@ -216,7 +241,20 @@ func (p *TBinaryProtocol) WriteDouble(value float64) TProtocolException {
 }
 
 func (p *TBinaryProtocol) WriteString(value string) TProtocolException {
-	return p.WriteBinaryFromReader(strings.NewReader(value), len(value))
+	e := p.WriteI32(int32(len(value)))
+	if e != nil {
+		return e
+	}
+	if len(value) == 0 {
+		return nil
+	}
+	var err error
+	if w, ok := p.trans.(stringWriter); ok {
+		_, err = w.WriteString(value)
+	} else {
+		_, err = p.trans.Write([]byte(value))
+	}
+	return NewTProtocolExceptionFromOsError(err)
 }
 
 func (p *TBinaryProtocol) WriteBinary(value []byte) TProtocolException {
@@ -242,9 +280,18 @@ func (p *TBinaryProtocol) WriteBinaryFromReader(reader io.Reader, size int) TPro
  */
 
 func (p *TBinaryProtocol) ReadMessageBegin() (name string, typeId TMessageType, seqId int32, err TProtocolException) {
+	nameBytes, typeId, seqId, err := p.ReadMessageBeginBytes()
+	return string(nameBytes), typeId, seqId, err
+}
+
+/**
+ * Reads the name into the protocol's scratch buffer, where it stays until
+ * the next string is read.
+ */
+func (p *TBinaryProtocol) ReadMessageBeginBytes() (name []byte, typeId TMessageType, seqId int32, err TProtocolException) {
 	size, e := p.ReadI32()
 	if e != nil {
-		return "", typeId, 0, NewTProtocolExceptionFromOsError(e)
+		return nil, typeId, 0, NewTProtocolExceptionFromOsError(e)
 	}
 	if size < 0 {
 		typeId = TMessageType(size & 0x0ff)
@@ -252,7 +299,11 @@ func (p *TBinaryProtocol) ReadMessageBegin() (name string, typeId TMessageType,
 		if version != VERSION_1 {
 			return name, typeId, seqId, NewTProtocolException(BAD_VERSION, "Bad version in ReadMessageBegin")
 		}
-		name, e = p.ReadString()
+		size, e = p.ReadI32()
+		if e != nil {
+			return name, typeId, seqId, NewTProtocolExceptionFromOsError(e)
+		}
+		name, e = p.readBytesBody(int(size))
 		if e != nil {
 			return name, typeId, seqId, NewTProtocolExceptionFromOsError(e)
 		}
@@ -265,7 +316,7 @@ func (p *TBinaryProtocol) ReadMessageBegin() (name string, typeId TMessageType,
 	if p._StrictRead {
 		return name, typeId, seqId, NewTProtocolException(BAD_VERSION, "Missing version in ReadMessageBegin")
 	}
-	name, e2 := p.readStringBody(int(size))
+	name, e2 := p.readBytesBody(int(size))
 	if e2 != nil {
 		return name, typeId, seqId, e2
 	}
@@ -385,34 +436,34 @@ func (p *TBinaryProtocol) ReadBool() (bool, TProtocolException) {
 }
 
 func (p *TBinaryProtocol) ReadByte() (value byte, err TProtocolException) {
-	buf := []byte{0}
+	buf := p.readBuffer[:1]
 	err = p.readAll(buf)
 	return buf[0], err
 }
 
 func (p *TBinaryProtocol) ReadI16() (value int16, err TProtocolException) {
-	buf := []byte{0, 0}
+	buf := p.readBuffer[:2]
 	err = p.readAll(buf)
 	value = int16(binary.BigEndian.Uint16(buf))
 	return value, err
 }
 
 func (p *TBinaryProtocol) ReadI32() (value int32, err TProtocolException) {
-	buf := []byte{0, 0, 0, 0}
+	buf := p.readBuffer[:4]
 	err = p.readAll(buf)
 	value = int32(binary.BigEndian.Uint32(buf))
 	return value, err
 }
 
 func (p *TBinaryProtocol) ReadI64() (value int64, err TProtocolException) {
-	buf := []byte{0, 0, 0, 0, 0, 0, 0, 0}
+	buf := p.readBuffer[:8]
 	err = p.readAll(buf)
 	value = int64(binary.BigEndian.Uint64(buf))
 	return value, err
 }
 
 func (p *TBinaryProtocol) ReadDouble() (value float64, err TProtocolException) {
-	buf := []byte{0, 0, 0, 0, 0, 0, 0, 0}
+	buf := p.readBuffer[:8]
 	err = p.readAll(buf)
 	value = math.Float64frombits(binary.BigEndian.Uint64(buf))
 	return value, err
@@ -436,11 +487,228 @@ func (p *TBinaryProtocol) ReadBinary() ([]byte, TProtocolException) {
 	if e != nil {
 		return nil, e
 	}
-	buf := make([]byte, isize)
+	buf := p.newBytes(isize)
+	_, err := p.trans.ReadAll(buf)
+	return buf, NewTProtocolExceptionFromOsError(err)
+}
+
+/**
+ * Reads a binary value in place from a transport that is a TBorrower, and
+ * otherwise as ReadBinary() does; see TBorrowingReader.
+ */
+func (p *TBinaryProtocol) ReadBinaryBorrowed() ([]byte, TProtocolException) {
+	size, e := p.ReadI32()
+	if e != nil {
+		return nil, e
+	}
+	isize := int(size)
+	if buf, ok := borrowTransport(p.trans, isize); ok {
+		return buf, p.checkReadLength(isize)
+	}
+	e = p.checkReadLength(isize)
+	if e != nil {
+		return nil, e
+	}
+	buf := p.newBytes(isize)
 	_, err := p.trans.ReadAll(buf)
 	return buf, NewTProtocolExceptionFromOsError(err)
 }
 
+/**
+ * Reads a string in place from a transport that is a TBorrower, and
+ * otherwise as ReadString() does; see TBorrowingReader.
+ */
+func (p *TBinaryProtocol) ReadStringBorrowed() (string, TProtocolException) {
+	size, e := p.ReadI32()
+	if e != nil {
+		return "", e
+	}
+	isize := int(size)
+	if buf, ok := borrowTransport(p.trans, isize); ok {
+		return borrowString(buf), p.checkReadLength(isize)
+	}
+	return p.readStringBody(isize)
+}
+
+/**
+ * Copies a binary value from the transport to writer without holding more
+ * than a small buffer of it in memory; see TBinaryStreamer.
+ */
+func (p *TBinaryProtocol) ReadBinaryToWriter(writer io.Writer) (int64, TProtocolException) {
+	size, e := p.ReadI32()
+	if e != nil {
+		return 0, e
+	}
+	if size < 0 {
+		return 0, NewTProtocolException(NEGATIVE_SIZE, "Negative length in binary data")
+	}
+	e = p.checkReadLength(int(size))
+	if e != nil {
+		return 0, e
+	}
+	n, err := io.CopyN(writer, p.trans, int64(size))
+	return n, NewTProtocolExceptionFromOsError(err)
+}
+
+/**
+ * Reads size bytes as a list's elements; see TListReader.
+ */
+func (p *TBinaryProtocol) ReadByteList(dst []byte, size int) ([]byte, TProtocolException) {
+	for size > 0 {
+		n := size
+		if n > listChunkBytes {
+			n = listChunkBytes
+		}
+		var values []byte
+		dst, values = growBytes(dst, n)
+		if err := p.readAll(values); err != nil {
+			return dst, err
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size i32s a scratch buffer at a time; see TListReader.
+ */
+func (p *TBinaryProtocol) ReadI32List(dst []int32, size int) ([]int32, TProtocolException) {
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/4 {
+			n = listChunkBytes / 4
+		}
+		buf, err := p.readBytesBody(n * 4)
+		if err != nil {
+			return dst, err
+		}
+		var values []int32
+		dst, values = growI32s(dst, n)
+		for i := range values {
+			values[i] = int32(binary.BigEndian.Uint32(buf[i*4:]))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size i64s a scratch buffer at a time; see TListReader.
+ */
+func (p *TBinaryProtocol) ReadI64List(dst []int64, size int) ([]int64, TProtocolException) {
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		buf, err := p.readBytesBody(n * 8)
+		if err != nil {
+			return dst, err
+		}
+		var values []int64
+		dst, values = growI64s(dst, n)
+		for i := range values {
+			values[i] = int64(binary.BigEndian.Uint64(buf[i*8:]))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size doubles a scratch buffer at a time; see TListReader.
+ */
+func (p *TBinaryProtocol) ReadDoubleList(dst []float64, size int) ([]float64, TProtocolException) {
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		buf, err := p.readBytesBody(n * 8)
+		if err != nil {
+			return dst, err
+		}
+		var values []float64
+		dst, values = growDoubles(dst, n)
+		for i := range values {
+			values[i] = math.Float64frombits(binary.BigEndian.Uint64(buf[i*8:]))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Writes values as a list's elements; see TListWriter.
+ */
+func (p *TBinaryProtocol) WriteByteList(values []byte) TProtocolException {
+	_, e := p.trans.Write(values)
+	return NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Writes values a scratch buffer at a time; see TListWriter.
+ */
+func (p *TBinaryProtocol) WriteI32List(values []int32) TProtocolException {
+	for len(values) > 0 {
+		n := len(values)
+		if n > listChunkBytes/4 {
+			n = listChunkBytes / 4
+		}
+		buf := p.writeListBuffer(n * 4)
+		for i, v := range values[:n] {
+			binary.BigEndian.PutUint32(buf[i*4:], uint32(v))
+		}
+		if _, e := p.trans.Write(buf); e != nil {
+			return NewTProtocolExceptionFromOsError(e)
+		}
+		values = values[n:]
+	}
+	return nil
+}
+
+/**
+ * Writes values a scratch buffer at a time; see TListWriter.
+ */
+func (p *TBinaryProtocol) WriteI64List(values []int64) TProtocolException {
+	for len(values) > 0 {
+		n := len(values)
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		buf := p.writeListBuffer(n * 8)
+		for i, v := range values[:n] {
+			binary.BigEndian.PutUint64(buf[i*8:], uint64(v))
+		}
+		if _, e := p.trans.Write(buf); e != nil {
+			return NewTProtocolExceptionFromOsError(e)
+		}
+		values = values[n:]
+	}
+	return nil
+}
+
+/**
+ * Writes values a scratch buffer at a time; see TListWriter.
+ */
+func (p *TBinaryProtocol) WriteDoubleList(values []float64) TProtocolException {
+	for len(values) > 0 {
+		n := len(values)
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		buf := p.writeListBuffer(n * 8)
+		for i, v := range values[:n] {
+			binary.BigEndian.PutUint64(buf[i*8:], math.Float64bits(v))
+		}
+		if _, e := p.trans.Write(buf); e != nil {
+			return NewTProtocolExceptionFromOsError(e)
+		}
+		values = values[n:]
+	}
+	return nil
+}
+
 func (p *TBinaryProtocol) Flush() (err TProtocolException) {
 	return NewTProtocolExceptionFromOsError(p.trans.Flush())
 }
@@ -478,15 +746,74 @@ func (p *TBinaryProtocol) checkReadLength(length int) TProtocolException {
 }
 
 func (p *TBinaryProtocol) readStringBody(size int) (value string, err TProtocolException) {
+	if p.arena != nil && size > 0 {
+		if err = p.checkReadLength(size); err != nil {
+			return "", err
+		}
+		buf := p.arena.Bytes(size)
+		if _, e := p.trans.ReadAll(buf); e != nil {
+			return "", NewTProtocolExceptionFromOsError(e)
+		}
+		return borrowString(buf), nil
+	}
+	buf, err := p.readBytesBody(size)
+	return string(buf), err
+}
+
+/**
+ * A slice of size bytes to read a binary value into, from the arena if
+ * there is one.
+ */
+func (p *TBinaryProtocol) newBytes(size int) []byte {
+	if p.arena != nil {
+		return p.arena.Bytes(size)
+	}
+	return make([]byte, size)
+}
+
+func (p *TBinaryProtocol) SetArena(arena *TArena) {
+	p.arena = arena
+}
+
+func (p *TBinaryProtocol) Arena() *TArena {
+	return p.arena
+}
+
+/**
+ * The first size bytes of listBuffer, which size must not take beyond
+ * listChunkBytes.
+ */
+func (p *TBinaryProtocol) writeListBuffer(size int) []byte {
+	if p.listBuffer == nil {
+		p.listBuffer = make([]byte, listChunkBytes)
+	}
+	return p.listBuffer[:size]
+}
+
+/**
+ * Reads size bytes into the scratch buffer if they fit, or else into a new
+ * slice.
+ */
+func (p *TBinaryProtocol) readBytesBody(size int) ([]byte, TProtocolException) {
 	if size < 0 {
-		return "", nil
+		return nil, nil
 	}
-	err = p.checkReadLength(size)
+	err := p.checkReadLength(size)
 	if err != nil {
-		return "", err
+		return nil, err
+	}
+	var buf []byte
+	if size <= maxStringScratch {
+		if cap(p.stringBuffer) < size {
+			p.stringBuffer = make([]byte, size, maxStringScratch)
+		}
+		buf = p.stringBuffer[:size]
+	} else {
+		buf = make([]byte, size)
 	}
-	isize := int(size)
-	buf := make([]byte, isize)
 	_, e := p.trans.ReadAll(buf)
-	return string(buf), NewTProtocolExceptionFromOsError(e)
+	if e != nil {
+		return nil, NewTProtocolExceptionFromOsError(e)
+	}
+	return buf, nil
 }
@@ -26,3 +26,145 @@ import (
 func TestReadWriteBinaryProtocol(t *testing.T) {
 	ReadWriteProtocolTest(t, NewTBinaryProtocolFactoryDefault())
 }
+
+// Writes the equivalent of a generated struct holding one field of each
+// primitive type.
+func writeBinaryPrimitives(p TProtocol) TProtocolException {
+	p.WriteStructBegin("Primitives")
+	p.WriteFieldBegin("b", BOOL, 1)
+	p.WriteBool(true)
+	p.WriteFieldBegin("by", BYTE, 2)
+	p.WriteByte(0x7f)
+	p.WriteFieldBegin("i16", I16, 3)
+	p.WriteI16(-12345)
+	p.WriteFieldBegin("i32", I32, 4)
+	p.WriteI32(-1234567890)
+	p.WriteFieldBegin("i64", I64, 5)
+	p.WriteI64(-1234567890123456789)
+	p.WriteFieldBegin("d", DOUBLE, 6)
+	p.WriteDouble(3.14159)
+	p.WriteFieldBegin("s", STRING, 7)
+	p.WriteString("a string of primitives")
+	p.WriteFieldStop()
+	return p.WriteStructEnd()
+}
+
+func readBinaryPrimitives(p TProtocol) TProtocolException {
+	p.ReadStructBegin()
+	for {
+		_, typeId, _, err := p.ReadFieldBegin()
+		if err != nil {
+			return err
+		}
+		if typeId == STOP {
+			break
+		}
+		switch typeId {
+		case BOOL:
+			_, err = p.ReadBool()
+		case BYTE:
+			_, err = p.ReadByte()
+		case I16:
+			_, err = p.ReadI16()
+		case I32:
+			_, err = p.ReadI32()
+		case I64:
+			_, err = p.ReadI64()
+		case DOUBLE:
+			_, err = p.ReadDouble()
+		default:
+			_, err = p.ReadString()
+		}
+		if err != nil {
+			return err
+		}
+	}
+	return p.ReadStructEnd()
+}
+
+// Only the string read back from the wire may be allocated.
+func checkBinaryProtocolAllocs(t testing.TB) {
+	buffer := NewTMemoryBuffer()
+	buffer.Grow(1024)
+	p := NewTBinaryProtocolTransport(buffer)
+	var err TProtocolException
+
+	if allocs := testing.AllocsPerRun(100, func() {
+		buffer.Reset()
+		err = writeBinaryPrimitives(p)
+	}); err != nil || allocs != 0 {
+		t.Fatalf("Writing primitives made %v allocations (%v)", allocs, err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+
+	if allocs := testing.AllocsPerRun(100, func() {
+		buffer.Reset()
+		buffer.Write(wire)
+		err = readBinaryPrimitives(p)
+	}); err != nil || allocs != 1 {
+		t.Fatalf("Reading primitives made %v allocations (%v)", allocs, err)
+	}
+}
+
+func TestBinaryProtocolPrimitivesAllocs(t *testing.T) {
+	checkBinaryProtocolAllocs(t)
+}
+
+func TestBinaryProtocolMessageNameAllocs(t *testing.T) {
+	buffer := NewTMemoryBuffer()
+	p := NewTBinaryProtocolTransport(buffer)
+	p.WriteMessageBegin("method", CALL, 7)
+	wire := append([]byte(nil), buffer.Bytes()...)
+	var name []byte
+	var seqId int32
+	var err TProtocolException
+
+	if allocs := testing.AllocsPerRun(100, func() {
+		buffer.Reset()
+		buffer.Write(wire)
+		name, _, seqId, err = ReadMessageBeginBytes(p)
+	}); err != nil || allocs != 0 {
+		t.Fatalf("Reading a message name made %v allocations (%v)", allocs, err)
+	}
+
+	if string(name) != "method" || seqId != 7 {
+		t.Fatalf("Read message %q %d, not \"method\" 7", name, seqId)
+	}
+}
+
+func BenchmarkBinaryProtocolWritePrimitives(b *testing.B) {
+	checkBinaryProtocolAllocs(b)
+	buffer := NewTMemoryBuffer()
+	p := NewTBinaryProtocolTransport(buffer)
+	writeBinaryPrimitives(p)
+	b.SetBytes(int64(buffer.Len()))
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		if err := writeBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkBinaryProtocolReadPrimitives(b *testing.B) {
+	checkBinaryProtocolAllocs(b)
+	buffer := NewTMemoryBuffer()
+	p := NewTBinaryProtocolTransport(buffer)
+	writeBinaryPrimitives(p)
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+		if err := readBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
@@ -0,0 +1,89 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"unsafe"
+)
+
+/**
+ * Implemented by transports that hold what they read in memory, and can hand
+ * out the next n bytes of it in place rather than copying them out.  The
+ * bytes borrowed alias the transport's buffer: they are only valid until the
+ * transport releases it, which for a TFramedTransport is when the frame they
+ * came from is done with, and for a TMemoryBuffer is its next write.  ok is
+ * false, and nothing is consumed, when fewer than n bytes are held.
+ */
+type TBorrower interface {
+	Borrow(n int) (buf []byte, ok bool)
+}
+
+/**
+ * Implemented by protocols and decoders that can read a binary or string
+ * value without copying it, so that the value aliases the buffer it was
+ * read from.  Anything read this way is only valid as long as that buffer
+ * is; see TBorrower.
+ */
+type TBorrowingReader interface {
+	ReadBinaryBorrowed() ([]byte, TProtocolException)
+	ReadStringBorrowed() (string, TProtocolException)
+}
+
+/**
+ * Reads a binary value from prot without copying it, if prot and its
+ * transport allow, or else as ReadBinary() does.  Code generated with
+ * "--gen go:zero_copy" reads binary fields through it.
+ */
+func ReadBinaryBorrowed(prot TProtocol) ([]byte, TProtocolException) {
+	if reader, ok := prot.(TBorrowingReader); ok {
+		return reader.ReadBinaryBorrowed()
+	}
+	return prot.ReadBinary()
+}
+
+/**
+ * Reads a string from prot without copying it, if prot and its transport
+ * allow, or else as ReadString() does.  Code generated with
+ * "--gen go:zero_copy" reads string fields through it.
+ */
+func ReadStringBorrowed(prot TProtocol) (string, TProtocolException) {
+	if reader, ok := prot.(TBorrowingReader); ok {
+		return reader.ReadStringBorrowed()
+	}
+	return prot.ReadString()
+}
+
+/**
+ * Borrows n bytes from trans if it is a TBorrower holding that many.
+ */
+func borrowTransport(trans TTransport, n int) ([]byte, bool) {
+	if borrower, ok := trans.(TBorrower); ok && n >= 0 {
+		return borrower.Borrow(n)
+	}
+	return nil, false
+}
+
+/**
+ * A string sharing buf's memory, which must therefore not change for as
+ * long as the string is in use.
+ */
+func borrowString(buf []byte) string {
+	return *(*string)(unsafe.Pointer(&buf))
+}
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"testing"
+)
+
+/**
+ * Writes a string and a binary value with the protocol made by newProtocol,
+ * then reads them back borrowed and checks that both alias the buffer they
+ * were read from.
+ */
+func checkReadBorrowed(t *testing.T, newProtocol func(TTransport) TProtocol) {
+	buffer := NewTMemoryBuffer()
+	p := newProtocol(buffer)
+	p.WriteString("borrowed string")
+	p.WriteBinary([]byte("borrowed binary"))
+	wire := buffer.Bytes()
+	s, err := ReadStringBorrowed(p)
+
+	if err != nil || s != "borrowed string" {
+		t.Fatalf("Read string %q (%v), not \"borrowed string\"", s, err)
+	}
+
+	b, err := ReadBinaryBorrowed(p)
+
+	if err != nil || string(b) != "borrowed binary" {
+		t.Fatalf("Read binary %q (%v), not \"borrowed binary\"", b, err)
+	}
+
+	for i := range wire {
+		wire[i] = 'x'
+	}
+
+	if s == "borrowed string" || string(b) == "borrowed binary" {
+		t.Fatalf("Read %q and %q, which were copied out of the buffer", s, b)
+	}
+}
+
+func TestBinaryProtocolReadBorrowed(t *testing.T) {
+	checkReadBorrowed(t, func(trans TTransport) TProtocol { return NewTBinaryProtocolTransport(trans) })
+}
+
+func TestCompactProtocolReadBorrowed(t *testing.T) {
+	checkReadBorrowed(t, func(trans TTransport) TProtocol { return NewTCompactProtocol(trans) })
+}
+
+func checkDecoderReadBorrowed(t *testing.T, wire []byte, reader TBorrowingReader) {
+	s, _ := reader.ReadStringBorrowed()
+	b, _ := reader.ReadBinaryBorrowed()
+
+	if s != "borrowed string" || string(b) != "borrowed binary" {
+		t.Fatalf("Read %q and %q, not \"borrowed string\" and \"borrowed binary\"", s, b)
+	}
+
+	for i := range wire {
+		wire[i] = 'x'
+	}
+
+	if s == "borrowed string" || string(b) == "borrowed binary" {
+		t.Fatalf("Read %q and %q, which were copied out of the buffer", s, b)
+	}
+}
+
+func TestBinaryDecoderReadBorrowed(t *testing.T) {
+	wire := AppendBinaryBinary(AppendBinaryString(nil, "borrowed string"), []byte("borrowed binary"))
+	checkDecoderReadBorrowed(t, wire, NewTBinaryDecoder(wire))
+}
+
+func TestCompactDecoderReadBorrowed(t *testing.T) {
+	wire := AppendCompactBinary(AppendCompactString(nil, "borrowed string"), []byte("borrowed binary"))
+	checkDecoderReadBorrowed(t, wire, NewTCompactDecoder(wire))
+}
+
+func TestFramedTransportBorrow(t *testing.T) {
+	buffer := NewTMemoryBuffer()
+	trans := NewTFramedTransport(buffer)
+	trans.Write([]byte("0123456789"))
+	trans.Flush()
+	head := make([]byte, 4)
+
+	if _, err := trans.ReadAll(head); err != nil || string(head) != "0123" {
+		t.Fatalf("Read %q (%v), not \"0123\"", head, err)
+	}
+
+	if _, ok := trans.Borrow(7); ok {
+		t.Fatalf("Borrowed 7 bytes of the 6 left in the frame")
+	}
+
+	if b, ok := trans.Borrow(6); !ok || string(b) != "456789" {
+		t.Fatalf("Borrowed %q (%v), not \"456789\"", b, ok)
+	}
+}
+
+func TestReadBorrowedFallsBackToCopying(t *testing.T) {
+	buffer := new(bytes.Buffer)
+	p := NewTBinaryProtocolTransport(NewTIOStreamTransportRW(buffer))
+	p.WriteString("copied string")
+	p.WriteBinary([]byte("copied binary"))
+	p.Flush()
+	s, _ := ReadStringBorrowed(p)
+	b, _ := ReadBinaryBorrowed(p)
+
+	if s != "copied string" || string(b) != "copied binary" {
+		t.Fatalf("Read %q and %q, not \"copied string\" and \"copied binary\"", s, b)
+	}
+}
+
+/**
+ * Reads a 1MB binary value over and over, copied or borrowed.
+ */
+func benchmarkReadBlob(b *testing.B, read func(TProtocol) ([]byte, TProtocolException)) {
+	buffer := NewTMemoryBuffer()
+	p := NewTBinaryProtocolTransport(buffer)
+	p.WriteBinary(make([]byte, 1<<20))
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+		if _, err := read(p); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkReadBlobCopied(b *testing.B) {
+	benchmarkReadBlob(b, func(p TProtocol) ([]byte, TProtocolException) { return p.ReadBinary() })
+}
+
+func BenchmarkReadBlobBorrowed(b *testing.B) {
+	benchmarkReadBlob(b, ReadBinaryBorrowed)
+}
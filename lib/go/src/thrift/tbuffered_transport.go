@@ -0,0 +1,265 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bufio"
+	"net"
+	"sync"
+)
+
+const (
+	DEFAULT_BUFFERED_READ_SIZE  = 4096
+	DEFAULT_BUFFERED_WRITE_SIZE = 4096
+)
+
+/**
+ * Implemented by transports that can send several buffers with a single
+ * call, such as a writev(2) on a socket.  Like net.Buffers.WriteTo, it
+ * consumes bufs.
+ */
+type TVectoredWriter interface {
+	WriteBuffers(bufs *net.Buffers) (int64, error)
+}
+
+/**
+ * Buffers reads from and writes to another transport, so that the many small
+ * reads and writes a protocol makes do not each become a call on, say, a
+ * socket.
+ *
+ * Reads are served from a buffer of the read size.  Writes are copied into a
+ * chain of chunks of the write size and held until Flush(), which sends the
+ * whole chain with one call when the transport is a TVectoredWriter.  Both
+ * kinds of buffer are taken from pools shared by transports of the same
+ * sizes and given back when the transport is closed.
+ */
+type TBufferedTransport struct {
+	transport TTransport
+	pools     *tBufferedTransportPools
+	reader    *bufio.Reader
+	chunks    net.Buffers
+	vector    net.Buffers
+}
+
+type tBufferedTransportPools struct {
+	readers sync.Pool
+	chunks  sync.Pool
+}
+
+type tBufferedTransportFactory struct {
+	factory TTransportFactory
+	pools   *tBufferedTransportPools
+}
+
+var (
+	bufferedTransportPoolsLock sync.Mutex
+	bufferedTransportPools     = make(map[[2]int]*tBufferedTransportPools)
+)
+
+/**
+ * Returns the pools of buffers of the given sizes, creating them the first
+ * time they are asked for.
+ */
+func getTBufferedTransportPools(readSize, writeSize int) *tBufferedTransportPools {
+	if readSize <= 0 {
+		readSize = DEFAULT_BUFFERED_READ_SIZE
+	}
+	if writeSize <= 0 {
+		writeSize = DEFAULT_BUFFERED_WRITE_SIZE
+	}
+	key := [2]int{readSize, writeSize}
+	bufferedTransportPoolsLock.Lock()
+	defer bufferedTransportPoolsLock.Unlock()
+	pools, ok := bufferedTransportPools[key]
+	if !ok {
+		pools = &tBufferedTransportPools{}
+		pools.readers.New = func() interface{} {
+			return bufio.NewReaderSize(nil, readSize)
+		}
+		pools.chunks.New = func() interface{} {
+			return make([]byte, 0, writeSize)
+		}
+		bufferedTransportPools[key] = pools
+	}
+	return pools
+}
+
+/**
+ * Wraps the transports made by factory in TBufferedTransports.  A size of
+ * zero or less picks the default for that buffer.
+ */
+func NewTBufferedTransportFactory(factory TTransportFactory, readSize, writeSize int) TTransportFactory {
+	return &tBufferedTransportFactory{factory: factory, pools: getTBufferedTransportPools(readSize, writeSize)}
+}
+
+func (p *tBufferedTransportFactory) GetTransport(base TTransport) TTransport {
+	return &TBufferedTransport{transport: p.factory.GetTransport(base), pools: p.pools}
+}
+
+/**
+ * A size of zero or less picks the default for that buffer.
+ */
+func NewTBufferedTransport(transport TTransport, readSize, writeSize int) *TBufferedTransport {
+	return &TBufferedTransport{transport: transport, pools: getTBufferedTransportPools(readSize, writeSize)}
+}
+
+func (p *TBufferedTransport) Open() error {
+	return p.transport.Open()
+}
+
+func (p *TBufferedTransport) IsOpen() bool {
+	return p.transport.IsOpen()
+}
+
+func (p *TBufferedTransport) Peek() bool {
+	if p.reader != nil && p.reader.Buffered() > 0 {
+		return true
+	}
+	return p.transport.Peek()
+}
+
+/**
+ * Closes the underlying transport, dropping anything read but not consumed or
+ * written but not flushed, and gives the buffers back to their pools.
+ */
+func (p *TBufferedTransport) Close() error {
+	if p.reader != nil {
+		p.reader.Reset(nil)
+		p.pools.readers.Put(p.reader)
+		p.reader = nil
+	}
+	p.releaseChunks(0)
+	p.chunks = nil
+	return p.transport.Close()
+}
+
+/**
+ * Interrupts the underlying transport, leaving the buffers for Close().
+ */
+func (p *TBufferedTransport) Interrupt() error {
+	return InterruptTransport(p.transport)
+}
+
+func (p *TBufferedTransport) Read(buf []byte) (int, error) {
+	n, err := p.readBuffer().Read(buf)
+	return n, NewTTransportExceptionFromOsError(err)
+}
+
+func (p *TBufferedTransport) ReadAll(buf []byte) (int, error) {
+	return ReadAllTransport(p, buf)
+}
+
+func (p *TBufferedTransport) ReadByte() (byte, error) {
+	b, err := p.readBuffer().ReadByte()
+	return b, NewTTransportExceptionFromOsError(err)
+}
+
+func (p *TBufferedTransport) Write(buf []byte) (int, error) {
+	for written := 0; written < len(buf); {
+		n := copy(p.free(), buf[written:])
+		p.commit(n)
+		written += n
+	}
+	return len(buf), nil
+}
+
+func (p *TBufferedTransport) WriteString(buf string) (int, error) {
+	for written := 0; written < len(buf); {
+		n := copy(p.free(), buf[written:])
+		p.commit(n)
+		written += n
+	}
+	return len(buf), nil
+}
+
+/**
+ * Sends everything written since the last flush and flushes the underlying
+ * transport.
+ */
+func (p *TBufferedTransport) Flush() error {
+	if len(p.chunks) > 0 && len(p.chunks[0]) > 0 {
+		var err error
+		if writer, ok := p.transport.(TVectoredWriter); ok {
+			vector := append(p.vector[:0], p.chunks...)
+			p.vector = vector
+			_, err = writer.WriteBuffers(&p.vector)
+			for i := range vector {
+				vector[i] = nil
+			}
+			p.vector = vector[:0]
+		} else {
+			for _, chunk := range p.chunks {
+				if _, err = p.transport.Write(chunk); err != nil {
+					break
+				}
+			}
+		}
+		p.releaseChunks(1)
+		if err != nil {
+			return NewTTransportExceptionFromOsError(err)
+		}
+	}
+	return NewTTransportExceptionFromOsError(p.transport.Flush())
+}
+
+func (p *TBufferedTransport) readBuffer() *bufio.Reader {
+	if p.reader == nil {
+		p.reader = p.pools.readers.Get().(*bufio.Reader)
+		p.reader.Reset(p.transport)
+	}
+	return p.reader
+}
+
+/**
+ * Returns the unused tail of the last chunk, starting another chunk if the
+ * last one is full.
+ */
+func (p *TBufferedTransport) free() []byte {
+	last := len(p.chunks) - 1
+	if last < 0 || len(p.chunks[last]) == cap(p.chunks[last]) {
+		p.chunks = append(p.chunks, p.pools.chunks.Get().([]byte))
+		last++
+	}
+	chunk := p.chunks[last]
+	return chunk[len(chunk):cap(chunk)]
+}
+
+func (p *TBufferedTransport) commit(n int) {
+	last := len(p.chunks) - 1
+	p.chunks[last] = p.chunks[last][:len(p.chunks[last])+n]
+}
+
+/**
+ * Empties the write chain, keeping its first keep chunks for reuse and
+ * giving the rest back to the pool.
+ */
+func (p *TBufferedTransport) releaseChunks(keep int) {
+	for i, chunk := range p.chunks {
+		if i < keep {
+			p.chunks[i] = chunk[:0]
+		} else {
+			p.pools.chunks.Put(chunk[:0])
+			p.chunks[i] = nil
+		}
+	}
+	if len(p.chunks) > keep {
+		p.chunks = p.chunks[:keep]
+	}
+}
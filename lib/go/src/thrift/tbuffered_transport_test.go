@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"io"
+	"net"
+	"testing"
+)
+
+func TestBufferedTransport(t *testing.T) {
+	trans := NewTBufferedTransport(NewTMemoryBuffer(), 0, 0)
+	TransportTest(t, trans, trans)
+}
+
+func TestBufferedTransportSmallBuffers(t *testing.T) {
+	trans := NewTBufferedTransport(NewTMemoryBuffer(), 7, 13)
+	TransportTest(t, trans, trans)
+}
+
+// Counts the calls that reach the transport it wraps; over a socket each one
+// is a system call.
+type tCountingTransport struct {
+	TTransport
+	reads, writes int
+}
+
+func (p *tCountingTransport) Read(buf []byte) (int, error) {
+	p.reads++
+	return p.TTransport.Read(buf)
+}
+
+func (p *tCountingTransport) ReadAll(buf []byte) (int, error) {
+	return ReadAllTransport(p, buf)
+}
+
+func (p *tCountingTransport) Write(buf []byte) (int, error) {
+	p.writes++
+	return p.TTransport.Write(buf)
+}
+
+func (p *tCountingTransport) WriteBuffers(bufs *net.Buffers) (int64, error) {
+	p.writes++
+	if writer, ok := p.TTransport.(TVectoredWriter); ok {
+		return writer.WriteBuffers(bufs)
+	}
+	return bufs.WriteTo(p.TTransport)
+}
+
+func TestBufferedTransportFlushesOnce(t *testing.T) {
+	memory := NewTMemoryBuffer()
+	counter := &tCountingTransport{TTransport: memory}
+	trans := NewTBufferedTransport(counter, 0, 16)
+
+	for i := 0; i < 3; i++ {
+		if _, err := trans.Write(transport_bdata[:100]); err != nil {
+			t.Fatalf("Cannot write: %s", err)
+		}
+		if _, err := trans.WriteString("a string"); err != nil {
+			t.Fatalf("Cannot write string: %s", err)
+		}
+		if memory.Len() != 0 {
+			t.Fatalf("%d bytes were written before Flush()", memory.Len())
+		}
+		if err := trans.Flush(); err != nil {
+			t.Fatalf("Cannot flush: %s", err)
+		}
+		if counter.writes != i+1 {
+			t.Errorf("Flush() %d made %d writes in all", i, counter.writes)
+		}
+		expected := append(append([]byte(nil), transport_bdata[:100]...), "a string"...)
+		if !bytes.Equal(memory.Bytes(), expected) {
+			t.Fatalf("Flush() %d wrote %v instead of %v", i, memory.Bytes(), expected)
+		}
+		memory.Reset()
+	}
+}
+
+// Connects a client to a server over loopback that echoes back whatever it
+// receives.
+func newLoopbackTransport(tb testing.TB) (*tCountingTransport, func()) {
+	l, err := net.Listen("tcp", "127.0.0.1:0")
+	if err != nil {
+		tb.Fatalf("Cannot listen on loopback: %s", err)
+	}
+	go func() {
+		conn, err := l.Accept()
+		if err != nil {
+			return
+		}
+		io.Copy(conn, conn)
+		conn.Close()
+	}()
+	conn, err := net.Dial("tcp", l.Addr().String())
+	if err != nil {
+		tb.Fatalf("Cannot connect over loopback: %s", err)
+	}
+	socket, _ := NewTNonblockingSocketConn(conn)
+	return &tCountingTransport{TTransport: socket}, func() {
+		conn.Close()
+		l.Close()
+	}
+}
+
+func benchmarkLoopback(b *testing.B, buffered bool) {
+	counter, closer := newLoopbackTransport(b)
+	defer closer()
+	var trans TTransport = counter
+	if buffered {
+		trans = NewTBufferedTransport(counter, 0, 0)
+	}
+	p := NewTBinaryProtocolTransport(trans)
+	memory := NewTMemoryBuffer()
+	writeBinaryPrimitives(NewTBinaryProtocolTransport(memory))
+	b.SetBytes(int64(memory.Len()))
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		if err := writeBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+		if err := p.Flush(); err != nil {
+			b.Fatal(err)
+		}
+		if err := readBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+	}
+	b.ReportMetric(float64(counter.reads+counter.writes)/float64(b.N), "syscalls/op")
+}
+
+func BenchmarkLoopbackUnbuffered(b *testing.B) {
+	benchmarkLoopback(b, false)
+}
+
+func BenchmarkLoopbackBuffered(b *testing.B) {
+	benchmarkLoopback(b, true)
+}
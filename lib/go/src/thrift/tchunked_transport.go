@@ -0,0 +1,178 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"encoding/binary"
+	"strconv"
+)
+
+const (
+	DEFAULT_CHUNK_SIZE = 64 * 1024
+
+	chunkHeaderSize = 4
+)
+
+/**
+ * Sends each message as a sequence of chunks of at most the chunk size, each
+ * preceded by its length as a 4-byte big-endian integer, and ends it with a
+ * chunk of length zero.
+ *
+ * Unlike a TFramedTransport, neither side ever holds more of a message than
+ * one chunk: writes are gathered into a buffer of the chunk size that is
+ * sent whenever it fills, and reads are passed straight through to the
+ * underlying transport, which may be buffered itself, for as long as the
+ * current chunk lasts.  Paired with a TBinaryStreamer protocol this lets a
+ * binary value of any size be sent from an io.Reader and received into an
+ * io.Writer.
+ */
+type TChunkedTransport struct {
+	transport TTransport
+	chunkSize int
+
+	// The chunk being written, after room for its header
+	writeBuffer []byte
+
+	// The bytes left of the chunk being read
+	unread int
+	header [chunkHeaderSize]byte
+}
+
+type tChunkedTransportFactory struct {
+	factory   TTransportFactory
+	chunkSize int
+}
+
+/**
+ * A chunk size of zero or less picks DEFAULT_CHUNK_SIZE.
+ */
+func NewTChunkedTransportFactory(factory TTransportFactory, chunkSize int) TTransportFactory {
+	return &tChunkedTransportFactory{factory: factory, chunkSize: chunkSize}
+}
+
+func (p *tChunkedTransportFactory) GetTransport(base TTransport) TTransport {
+	return NewTChunkedTransport(p.factory.GetTransport(base), p.chunkSize)
+}
+
+/**
+ * A chunk size of zero or less picks DEFAULT_CHUNK_SIZE.
+ */
+func NewTChunkedTransport(transport TTransport, chunkSize int) *TChunkedTransport {
+	if chunkSize <= 0 {
+		chunkSize = DEFAULT_CHUNK_SIZE
+	}
+	return &TChunkedTransport{
+		transport:   transport,
+		chunkSize:   chunkSize,
+		writeBuffer: make([]byte, chunkHeaderSize, chunkHeaderSize+chunkSize+chunkHeaderSize),
+	}
+}
+
+func (p *TChunkedTransport) Open() error {
+	return p.transport.Open()
+}
+
+func (p *TChunkedTransport) IsOpen() bool {
+	return p.transport.IsOpen()
+}
+
+func (p *TChunkedTransport) Peek() bool {
+	return p.unread > 0 || p.transport.Peek()
+}
+
+func (p *TChunkedTransport) Close() error {
+	return p.transport.Close()
+}
+
+func (p *TChunkedTransport) Interrupt() error {
+	return InterruptTransport(p.transport)
+}
+
+func (p *TChunkedTransport) Read(buf []byte) (int, error) {
+	for p.unread == 0 {
+		// Start the next chunk, passing over the ends of messages
+		if _, err := p.transport.ReadAll(p.header[:]); err != nil {
+			return 0, err
+		}
+		size := int(int32(binary.BigEndian.Uint32(p.header[:])))
+		if size < 0 {
+			return 0, NewTTransportException(UNKNOWN_TRANSPORT_EXCEPTION, "Read a negative chunk size ("+strconv.Itoa(size)+")")
+		}
+		p.unread = size
+	}
+	if len(buf) > p.unread {
+		buf = buf[:p.unread]
+	}
+	n, err := p.transport.Read(buf)
+	p.unread -= n
+	return n, err
+}
+
+func (p *TChunkedTransport) ReadAll(buf []byte) (int, error) {
+	return ReadAllTransport(p, buf)
+}
+
+func (p *TChunkedTransport) Write(buf []byte) (int, error) {
+	written := 0
+	for written < len(buf) {
+		n := copy(p.writeBuffer[len(p.writeBuffer):chunkHeaderSize+p.chunkSize], buf[written:])
+		p.writeBuffer = p.writeBuffer[:len(p.writeBuffer)+n]
+		written += n
+		if len(p.writeBuffer) == chunkHeaderSize+p.chunkSize {
+			if err := p.writeChunk(false); err != nil {
+				return written, err
+			}
+		}
+	}
+	return written, nil
+}
+
+/**
+ * Sends what is left of the message, and the empty chunk that ends it, and
+ * flushes the underlying transport.
+ */
+func (p *TChunkedTransport) Flush() error {
+	if err := p.writeChunk(true); err != nil {
+		return err
+	}
+	return NewTTransportExceptionFromOsError(p.transport.Flush())
+}
+
+/**
+ * Sends the chunk being written, if it is not empty, followed by the end of
+ * the message if last is set, with one write.
+ */
+func (p *TChunkedTransport) writeChunk(last bool) error {
+	chunk := p.writeBuffer
+	if size := len(chunk) - chunkHeaderSize; size > 0 {
+		binary.BigEndian.PutUint32(chunk, uint32(size))
+	} else {
+		chunk = chunk[chunkHeaderSize:]
+	}
+	if last {
+		chunk = append(chunk, 0, 0, 0, 0)
+	}
+	p.writeBuffer = p.writeBuffer[:chunkHeaderSize]
+	if len(chunk) == 0 {
+		return nil
+	}
+	_, err := p.transport.Write(chunk)
+	return NewTTransportExceptionFromOsError(err)
+}
@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"io"
+	"io/ioutil"
+	"runtime"
+	"testing"
+)
+
+func TestChunkedTransport(t *testing.T) {
+	trans := NewTChunkedTransport(NewTMemoryBuffer(), 0)
+	TransportTest(t, trans, trans)
+}
+
+func TestChunkedTransportSmallChunks(t *testing.T) {
+	trans := NewTChunkedTransport(NewTMemoryBuffer(), 7)
+	TransportTest(t, trans, trans)
+}
+
+func TestChunkedTransportWritesWholeChunks(t *testing.T) {
+	memory := NewTMemoryBuffer()
+	counter := &tCountingTransport{TTransport: memory}
+	trans := NewTChunkedTransport(counter, 40)
+	trans.Write(transport_bdata[:100])
+
+	if counter.writes != 2 || memory.Len() != 2*(4+40) {
+		t.Fatalf("Writing 100 bytes in chunks of 40 made %d writes of %d bytes", counter.writes, memory.Len())
+	}
+
+	trans.Flush()
+
+	if counter.writes != 3 {
+		t.Fatalf("Flush() made %d writes rather than 1", counter.writes-2)
+	}
+
+	expected := []byte{0, 0, 0, 40}
+	expected = append(expected, transport_bdata[:40]...)
+	expected = append(expected, 0, 0, 0, 40)
+	expected = append(expected, transport_bdata[40:80]...)
+	expected = append(expected, 0, 0, 0, 20)
+	expected = append(expected, transport_bdata[80:100]...)
+	expected = append(expected, 0, 0, 0, 0)
+
+	if !bytes.Equal(memory.Bytes(), expected) {
+		t.Fatalf("Wrote %v instead of %v", memory.Bytes(), expected)
+	}
+}
+
+/**
+ * Sends a binary value of size bytes from an io.Reader to an io.Writer over
+ * a pipe, through the protocol and transport that wrap made, and returns
+ * the bytes allocated meanwhile.
+ */
+func streamBinary(tb testing.TB, size int, wrap func(TTransport) TTransport) uint64 {
+	pipeReader, pipeWriter := io.Pipe()
+	in := NewTBinaryProtocolTransport(wrap(&TIOStreamTransport{Writer: pipeWriter}))
+	out := NewTBinaryProtocolTransport(wrap(&TIOStreamTransport{Reader: pipeReader}))
+	var before, after runtime.MemStats
+	runtime.ReadMemStats(&before)
+	go func() {
+		in.WriteBinaryFromReader(io.LimitReader(zeroReader{}, int64(size)), size)
+		in.Flush()
+	}()
+	n, err := out.ReadBinaryToWriter(ioutil.Discard)
+	runtime.ReadMemStats(&after)
+
+	if err != nil || n != int64(size) {
+		tb.Fatalf("Streamed %d bytes (%v) rather than %d", n, err, size)
+	}
+
+	return after.TotalAlloc - before.TotalAlloc
+}
+
+type zeroReader struct{}
+
+func (zeroReader) Read(buf []byte) (int, error) {
+	for i := range buf {
+		buf[i] = 0
+	}
+	return len(buf), nil
+}
+
+func TestChunkedTransportStreamsInBoundedMemory(t *testing.T) {
+	allocated := streamBinary(t, 64<<20, func(trans TTransport) TTransport { return NewTChunkedTransport(trans, 0) })
+
+	if allocated > 1<<20 {
+		t.Fatalf("Streaming 64MB allocated %d bytes", allocated)
+	}
+}
+
+func benchmarkStreamBinary(b *testing.B, wrap func(TTransport) TTransport) {
+	const size = 8 << 20
+	b.SetBytes(size)
+	var allocated uint64
+
+	for i := 0; i < b.N; i++ {
+		allocated += streamBinary(b, size, wrap)
+	}
+
+	b.ReportMetric(float64(allocated)/float64(b.N), "allocated-B/op")
+}
+
+func BenchmarkStreamBinaryFramed(b *testing.B) {
+	benchmarkStreamBinary(b, func(trans TTransport) TTransport { return NewTFramedTransport(trans) })
+}
+
+func BenchmarkStreamBinaryChunked(b *testing.B) {
+	benchmarkStreamBinary(b, func(trans TTransport) TTransport { return NewTChunkedTransport(trans, 0) })
+}
@@ -0,0 +1,545 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"encoding/binary"
+	"math"
+)
+
+/**
+ * Byte slice codec for the TCompactProtocol wire format.
+ *
+ * The AppendCompact* functions and TCompactDecoder are the compact protocol
+ * counterparts of the AppendBinary* functions and TBinaryDecoder, and are
+ * what generated MarshalCompactThrift() and UnmarshalCompactThrift() methods
+ * are built on.  Field ids are delta encoded against the id of the previous
+ * field of the same struct, which the caller passes in; generated code works
+ * most of these headers out when it is generated and appends them directly.
+ */
+
+func AppendCompactVarint32(buf []byte, n uint32) []byte {
+	for n >= 0x80 {
+		buf = append(buf, byte(n)|0x80)
+		n >>= 7
+	}
+	return append(buf, byte(n))
+}
+
+func AppendCompactVarint64(buf []byte, n uint64) []byte {
+	for n >= 0x80 {
+		buf = append(buf, byte(n)|0x80)
+		n >>= 7
+	}
+	return append(buf, byte(n))
+}
+
+/**
+ * Appends a bool that is not a field value, such as a list element.  Bool
+ * fields carry their value in the field header instead; see
+ * AppendCompactBoolField().
+ */
+func AppendCompactBool(buf []byte, value bool) []byte {
+	if value {
+		return append(buf, COMPACT_BOOLEAN_TRUE)
+	}
+	return append(buf, COMPACT_BOOLEAN_FALSE)
+}
+
+func AppendCompactByte(buf []byte, value byte) []byte {
+	return append(buf, value)
+}
+
+func AppendCompactI16(buf []byte, value int16) []byte {
+	return AppendCompactI32(buf, int32(value))
+}
+
+func AppendCompactI32(buf []byte, value int32) []byte {
+	return AppendCompactVarint32(buf, uint32((value<<1)^(value>>31)))
+}
+
+func AppendCompactI64(buf []byte, value int64) []byte {
+	return AppendCompactVarint64(buf, uint64((value<<1)^(value>>63)))
+}
+
+func AppendCompactDouble(buf []byte, value float64) []byte {
+	bits := math.Float64bits(value)
+	return append(buf, byte(bits), byte(bits>>8), byte(bits>>16), byte(bits>>24),
+		byte(bits>>32), byte(bits>>40), byte(bits>>48), byte(bits>>56))
+}
+
+func AppendCompactString(buf []byte, value string) []byte {
+	return append(AppendCompactVarint32(buf, uint32(len(value))), value...)
+}
+
+func AppendCompactBinary(buf []byte, value []byte) []byte {
+	return append(AppendCompactVarint32(buf, uint32(len(value))), value...)
+}
+
+func appendCompactFieldHeader(buf []byte, compactType byte, id int16, lastId int16) []byte {
+	if id > lastId && id-lastId <= 15 {
+		return append(buf, byte(id-lastId)<<4|compactType)
+	}
+	return AppendCompactI16(append(buf, compactType), id)
+}
+
+/**
+ * Appends the header of field id, which follows field lastId (zero for the
+ * first field of a struct).
+ */
+func AppendCompactFieldBegin(buf []byte, typeId TType, id int16, lastId int16) []byte {
+	return appendCompactFieldHeader(buf, byte(_TTypeToCompactType[typeId.ThriftTypeId()]), id, lastId)
+}
+
+/**
+ * Appends a bool field, whose value is carried in its header.
+ */
+func AppendCompactBoolField(buf []byte, id int16, lastId int16, value bool) []byte {
+	if value {
+		return appendCompactFieldHeader(buf, COMPACT_BOOLEAN_TRUE, id, lastId)
+	}
+	return appendCompactFieldHeader(buf, COMPACT_BOOLEAN_FALSE, id, lastId)
+}
+
+func AppendCompactFieldStop(buf []byte) []byte {
+	return append(buf, STOP)
+}
+
+func AppendCompactMapBegin(buf []byte, keyType TType, valueType TType, size int) []byte {
+	if size == 0 {
+		return append(buf, 0)
+	}
+	buf = AppendCompactVarint32(buf, uint32(size))
+	return append(buf, byte(_TTypeToCompactType[keyType.ThriftTypeId()])<<4|byte(_TTypeToCompactType[valueType.ThriftTypeId()]))
+}
+
+func AppendCompactListBegin(buf []byte, elemType TType, size int) []byte {
+	compactType := byte(_TTypeToCompactType[elemType.ThriftTypeId()])
+	if size <= 14 {
+		return append(buf, byte(size)<<4|compactType)
+	}
+	return AppendCompactVarint32(append(buf, 0xf0|compactType), uint32(size))
+}
+
+func AppendCompactSetBegin(buf []byte, elemType TType, size int) []byte {
+	return AppendCompactListBegin(buf, elemType, size)
+}
+
+/**
+ * The following return the number of bytes the corresponding Append
+ * functions add, for working out a struct's CompactSize() without encoding
+ * it.
+ */
+
+func CompactVarint32Size(n uint32) int {
+	size := 1
+	for ; n >= 0x80; n >>= 7 {
+		size++
+	}
+	return size
+}
+
+func CompactVarint64Size(n uint64) int {
+	size := 1
+	for ; n >= 0x80; n >>= 7 {
+		size++
+	}
+	return size
+}
+
+func CompactI32Size(value int32) int {
+	return CompactVarint32Size(uint32((value << 1) ^ (value >> 31)))
+}
+
+func CompactI64Size(value int64) int {
+	return CompactVarint64Size(uint64((value << 1) ^ (value >> 63)))
+}
+
+/**
+ * Returns the size of a string or binary value of the given length.
+ */
+func CompactStringSize(length int) int {
+	return CompactVarint32Size(uint32(length)) + length
+}
+
+func CompactFieldBeginSize(id int16, lastId int16) int {
+	if id > lastId && id-lastId <= 15 {
+		return 1
+	}
+	return 1 + CompactI32Size(int32(id))
+}
+
+func CompactMapBeginSize(size int) int {
+	if size == 0 {
+		return 1
+	}
+	return CompactVarint32Size(uint32(size)) + 1
+}
+
+func CompactListBeginSize(size int) int {
+	if size <= 14 {
+		return 1
+	}
+	return 1 + CompactVarint32Size(uint32(size))
+}
+
+/**
+ * Reads TCompactProtocol encoded values from a byte slice.  Strings and
+ * binary values are copied out, so the slice may be reused once decoding is
+ * done.
+ */
+type TCompactDecoder struct {
+	buf []byte
+	pos int
+
+	// The value of the bool field whose header was read last, which
+	// ReadBool() returns instead of reading a byte.
+	boolValue    bool
+	hasBoolValue bool
+}
+
+func NewTCompactDecoder(buf []byte) *TCompactDecoder {
+	return &TCompactDecoder{buf: buf}
+}
+
+/**
+ * Returns the bytes that have not been read yet.
+ */
+func (p *TCompactDecoder) Remaining() []byte {
+	return p.buf[p.pos:]
+}
+
+func (p *TCompactDecoder) next(n int) ([]byte, TProtocolException) {
+	if n < 0 {
+		return nil, NewTProtocolException(NEGATIVE_SIZE, "Negative length in compact data")
+	}
+	if len(p.buf)-p.pos < n {
+		return nil, NewTProtocolException(INVALID_DATA, "Unexpected end of compact data")
+	}
+	b := p.buf[p.pos : p.pos+n]
+	p.pos += n
+	return b, nil
+}
+
+func (p *TCompactDecoder) readVarint64() (uint64, TProtocolException) {
+	var result uint64
+	for shift := uint(0); shift < 64; shift += 7 {
+		if p.pos >= len(p.buf) {
+			return 0, NewTProtocolException(INVALID_DATA, "Unexpected end of compact data")
+		}
+		b := p.buf[p.pos]
+		p.pos++
+		result |= uint64(b&0x7f) << shift
+		if b&0x80 == 0 {
+			return result, nil
+		}
+	}
+	return 0, NewTProtocolException(INVALID_DATA, "Varint too long in compact data")
+}
+
+func (p *TCompactDecoder) readSize() (int, TProtocolException) {
+	v, err := p.readVarint64()
+	if err != nil {
+		return 0, err
+	}
+	if size := int32(v); size >= 0 {
+		return int(size), nil
+	}
+	return 0, NewTProtocolException(NEGATIVE_SIZE, "Negative size in compact data")
+}
+
+func (p *TCompactDecoder) ReadBool() (bool, TProtocolException) {
+	if p.hasBoolValue {
+		p.hasBoolValue = false
+		return p.boolValue, nil
+	}
+	b, err := p.ReadByte()
+	return b == COMPACT_BOOLEAN_TRUE, err
+}
+
+func (p *TCompactDecoder) ReadByte() (byte, TProtocolException) {
+	if p.pos >= len(p.buf) {
+		return 0, NewTProtocolException(INVALID_DATA, "Unexpected end of compact data")
+	}
+	b := p.buf[p.pos]
+	p.pos++
+	return b, nil
+}
+
+func (p *TCompactDecoder) ReadI16() (int16, TProtocolException) {
+	v, err := p.ReadI32()
+	return int16(v), err
+}
+
+func (p *TCompactDecoder) ReadI32() (int32, TProtocolException) {
+	v, err := p.readVarint64()
+	n := uint32(v)
+	return int32(n>>1) ^ -int32(n&1), err
+}
+
+func (p *TCompactDecoder) ReadI64() (int64, TProtocolException) {
+	v, err := p.readVarint64()
+	return int64(v>>1) ^ -int64(v&1), err
+}
+
+func (p *TCompactDecoder) ReadDouble() (float64, TProtocolException) {
+	b, err := p.next(8)
+	if err != nil {
+		return 0, err
+	}
+	return math.Float64frombits(binary.LittleEndian.Uint64(b)), nil
+}
+
+func (p *TCompactDecoder) ReadString() (string, TProtocolException) {
+	size, err := p.readSize()
+	if err != nil {
+		return "", err
+	}
+	b, err := p.next(size)
+	if err != nil {
+		return "", err
+	}
+	return string(b), nil
+}
+
+func (p *TCompactDecoder) ReadBinary() ([]byte, TProtocolException) {
+	size, err := p.readSize()
+	if err != nil {
+		return nil, err
+	}
+	b, err := p.next(size)
+	if err != nil {
+		return nil, err
+	}
+	value := make([]byte, len(b))
+	copy(value, b)
+	return value, nil
+}
+
+/**
+ * Returns a binary value as a subslice of the decoder's buffer rather than
+ * a copy; see TBorrowingReader.
+ */
+func (p *TCompactDecoder) ReadBinaryBorrowed() ([]byte, TProtocolException) {
+	size, err := p.readSize()
+	if err != nil {
+		return nil, err
+	}
+	return p.next(size)
+}
+
+/**
+ * Returns a string sharing the decoder's buffer rather than a copy; see
+ * TBorrowingReader.
+ */
+func (p *TCompactDecoder) ReadStringBorrowed() (string, TProtocolException) {
+	size, err := p.readSize()
+	if err != nil {
+		return "", err
+	}
+	b, err := p.next(size)
+	if err != nil {
+		return "", err
+	}
+	return borrowString(b), nil
+}
+
+func (p *TCompactDecoder) ttype(compactType byte) (TType, TProtocolException) {
+	switch compactType {
+	case STOP:
+		return STOP, nil
+	case COMPACT_BOOLEAN_TRUE, COMPACT_BOOLEAN_FALSE:
+		return BOOL, nil
+	case COMPACT_BYTE:
+		return BYTE, nil
+	case COMPACT_I16:
+		return I16, nil
+	case COMPACT_I32:
+		return I32, nil
+	case COMPACT_I64:
+		return I64, nil
+	case COMPACT_DOUBLE:
+		return DOUBLE, nil
+	case COMPACT_BINARY:
+		return STRING, nil
+	case COMPACT_LIST:
+		return LIST, nil
+	case COMPACT_SET:
+		return SET, nil
+	case COMPACT_MAP:
+		return MAP, nil
+	case COMPACT_STRUCT:
+		return STRUCT, nil
+	}
+	return STOP, NewTProtocolException(INVALID_DATA, "Unknown type in compact data")
+}
+
+/**
+ * Reads the header of the field that follows field lastId (zero for the
+ * first field of a struct).  The id is zero when typeId is STOP.
+ */
+func (p *TCompactDecoder) ReadFieldBegin(lastId int16) (typeId TType, id int16, err TProtocolException) {
+	t, err := p.ReadByte()
+	if err != nil || t&0x0f == STOP {
+		return STOP, 0, err
+	}
+	if delta := int16(t >> 4); delta != 0 {
+		id = lastId + delta
+	} else if id, err = p.ReadI16(); err != nil {
+		return STOP, 0, err
+	}
+	if typeId, err = p.ttype(t & 0x0f); err != nil {
+		return STOP, 0, err
+	}
+	if typeId == BOOL {
+		p.boolValue = t&0x0f == COMPACT_BOOLEAN_TRUE
+		p.hasBoolValue = true
+	}
+	return typeId, id, nil
+}
+
+/**
+ * Reads a map header.  Every key and value takes at least a byte, so a size
+ * the bytes left cannot hold is refused, as is a STOP key or value type,
+ * which Skip() would loop over without reading anything.
+ */
+func (p *TCompactDecoder) ReadMapBegin() (keyType TType, valueType TType, size int, err TProtocolException) {
+	if size, err = p.readSize(); err != nil || size == 0 {
+		return STOP, STOP, size, err
+	}
+	t, err := p.ReadByte()
+	if err != nil {
+		return STOP, STOP, 0, err
+	}
+	if size > (len(p.buf)-p.pos)/2 {
+		return STOP, STOP, 0, NewTProtocolException(INVALID_DATA, "Map size exceeds the compact data left")
+	}
+	if keyType, err = p.ttype(t >> 4); err != nil {
+		return STOP, STOP, 0, err
+	}
+	if valueType, err = p.ttype(t & 0x0f); err != nil {
+		return STOP, STOP, 0, err
+	}
+	if keyType == STOP || valueType == STOP {
+		return STOP, STOP, 0, NewTProtocolException(INVALID_DATA, "Invalid map key or value type in compact data")
+	}
+	return keyType, valueType, size, nil
+}
+
+/**
+ * Reads a list or set header, refusing it as ReadMapBegin() does a map's.
+ */
+func (p *TCompactDecoder) ReadListBegin() (elemType TType, size int, err TProtocolException) {
+	t, err := p.ReadByte()
+	if err != nil {
+		return STOP, 0, err
+	}
+	size = int(t >> 4)
+	if size == 15 {
+		if size, err = p.readSize(); err != nil {
+			return STOP, 0, err
+		}
+	}
+	if size > len(p.buf)-p.pos {
+		return STOP, 0, NewTProtocolException(INVALID_DATA, "List size exceeds the compact data left")
+	}
+	if elemType, err = p.ttype(t & 0x0f); err != nil {
+		return STOP, 0, err
+	}
+	if elemType == STOP && size > 0 {
+		return STOP, 0, NewTProtocolException(INVALID_DATA, "Invalid list element type in compact data")
+	}
+	return elemType, size, nil
+}
+
+func (p *TCompactDecoder) ReadSetBegin() (elemType TType, size int, err TProtocolException) {
+	return p.ReadListBegin()
+}
+
+/**
+ * Skips over a value of the given type, descending no further than
+ * MaxSkipDepth into nested structs and containers.
+ */
+func (p *TCompactDecoder) Skip(fieldType TType) TProtocolException {
+	return p.skip(fieldType, MaxSkipDepth)
+}
+
+func (p *TCompactDecoder) skip(fieldType TType, maxDepth int) TProtocolException {
+	if maxDepth <= 0 {
+		return NewTProtocolException(INVALID_DATA, "Maximum skip depth exceeded")
+	}
+	var err TProtocolException
+	switch fieldType {
+	case STOP:
+	case BOOL:
+		_, err = p.ReadBool()
+	case BYTE:
+		_, err = p.next(1)
+	case I16, I32, I64:
+		_, err = p.readVarint64()
+	case DOUBLE:
+		_, err = p.next(8)
+	case STRING, BINARY:
+		var size int
+		if size, err = p.readSize(); err == nil {
+			_, err = p.next(size)
+		}
+	case STRUCT:
+		for id := int16(0); ; {
+			typeId, next, err := p.ReadFieldBegin(id)
+			if err != nil {
+				return err
+			}
+			if typeId == STOP {
+				break
+			}
+			if err = p.skip(typeId, maxDepth-1); err != nil {
+				return err
+			}
+			id = next
+		}
+	case MAP:
+		keyType, valueType, size, err := p.ReadMapBegin()
+		if err != nil {
+			return err
+		}
+		for i := 0; i < size; i++ {
+			if err = p.skip(keyType, maxDepth-1); err != nil {
+				return err
+			}
+			if err = p.skip(valueType, maxDepth-1); err != nil {
+				return err
+			}
+		}
+	case SET, LIST:
+		elemType, size, err := p.ReadListBegin()
+		if err != nil {
+			return err
+		}
+		for i := 0; i < size; i++ {
+			if err = p.skip(elemType, maxDepth-1); err != nil {
+				return err
+			}
+		}
+	default:
+		return NewTProtocolException(INVALID_DATA, "Unknown type "+fieldType.String()+" in compact data")
+	}
+	return err
+}
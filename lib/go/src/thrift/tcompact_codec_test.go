@@ -0,0 +1,212 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"testing"
+)
+
+func TestCompactCodecMatchesTCompactProtocol(t *testing.T) {
+	transport := NewTMemoryBuffer()
+	p := NewTCompactProtocol(transport)
+	p.WriteStructBegin("s")
+	p.WriteFieldBegin("a", I32, 3)
+	p.WriteI32(-7)
+	p.WriteFieldBegin("b", BINARY, 4)
+	p.WriteBinary([]byte("hello"))
+	p.WriteFieldBegin("c", BOOL, 40)
+	p.WriteBool(false)
+	p.WriteFieldBegin("d", MAP, 41)
+	p.WriteMapBegin(BYTE, DOUBLE, 1)
+	p.WriteByte(9)
+	p.WriteDouble(2.5)
+	p.WriteFieldBegin("e", MAP, 42)
+	p.WriteMapBegin(STRING, STRING, 0)
+	p.WriteFieldBegin("f", LIST, 43)
+	p.WriteListBegin(I64, 20)
+	for i := int64(0); i < 20; i++ {
+		p.WriteI64(i << 40)
+	}
+	p.WriteFieldBegin("g", SET, 44)
+	p.WriteSetBegin(BOOL, 1)
+	p.WriteBool(true)
+	p.WriteFieldBegin("h", I16, 45)
+	p.WriteI16(-300)
+	p.WriteFieldBegin("i", STRING, 46)
+	p.WriteString("")
+	p.WriteFieldStop()
+	p.WriteStructEnd()
+
+	var buf []byte
+	buf = AppendCompactFieldBegin(buf, I32, 3, 0)
+	buf = AppendCompactI32(buf, -7)
+	buf = AppendCompactFieldBegin(buf, BINARY, 4, 3)
+	buf = AppendCompactBinary(buf, []byte("hello"))
+	buf = AppendCompactBoolField(buf, 40, 4, false)
+	buf = AppendCompactFieldBegin(buf, MAP, 41, 40)
+	buf = AppendCompactMapBegin(buf, BYTE, DOUBLE, 1)
+	buf = AppendCompactByte(buf, 9)
+	buf = AppendCompactDouble(buf, 2.5)
+	buf = AppendCompactFieldBegin(buf, MAP, 42, 41)
+	buf = AppendCompactMapBegin(buf, STRING, STRING, 0)
+	buf = AppendCompactFieldBegin(buf, LIST, 43, 42)
+	buf = AppendCompactListBegin(buf, I64, 20)
+	for i := int64(0); i < 20; i++ {
+		buf = AppendCompactI64(buf, i<<40)
+	}
+	buf = AppendCompactFieldBegin(buf, SET, 44, 43)
+	buf = AppendCompactSetBegin(buf, BOOL, 1)
+	buf = AppendCompactBool(buf, true)
+	buf = AppendCompactFieldBegin(buf, I16, 45, 44)
+	buf = AppendCompactI16(buf, -300)
+	buf = AppendCompactFieldBegin(buf, STRING, 46, 45)
+	buf = AppendCompactString(buf, "")
+	buf = AppendCompactFieldStop(buf)
+
+	if !bytes.Equal(buf, transport.Bytes()) {
+		t.Fatalf("Append functions wrote %v, TCompactProtocol wrote %v", buf, transport.Bytes())
+	}
+
+	d := NewTCompactDecoder(buf)
+
+	if typeId, id, err := d.ReadFieldBegin(0); err != nil || typeId != I32 || id != 3 {
+		t.Fatalf("ReadFieldBegin() = %v, %v, %v", typeId, id, err)
+	}
+
+	if v, err := d.ReadI32(); err != nil || v != -7 {
+		t.Fatalf("ReadI32() = %v, %v", v, err)
+	}
+
+	if typeId, id, _ := d.ReadFieldBegin(3); typeId != STRING || id != 4 {
+		t.Fatalf("Expected STRING field 4, got %v field %d", typeId, id)
+	}
+
+	if v, err := d.ReadBinary(); err != nil || string(v) != "hello" {
+		t.Fatalf("ReadBinary() = %q, %v", v, err)
+	}
+
+	if typeId, id, _ := d.ReadFieldBegin(4); typeId != BOOL || id != 40 {
+		t.Fatalf("Expected BOOL field 40, got %v field %d", typeId, id)
+	}
+
+	if v, err := d.ReadBool(); err != nil || v {
+		t.Fatalf("ReadBool() = %v, %v", v, err)
+	}
+
+	for id := int16(40); ; {
+		typeId, next, err := d.ReadFieldBegin(id)
+
+		if err != nil {
+			t.Fatalf("Could not read field header after %d: %v", id, err)
+		}
+
+		if typeId == STOP {
+			break
+		}
+
+		if next != id+1 {
+			t.Errorf("Expected field %d, got %d", id+1, next)
+		}
+
+		if err := d.Skip(typeId); err != nil {
+			t.Fatalf("Could not skip %v: %v", typeId, err)
+		}
+
+		id = next
+	}
+
+	if len(d.Remaining()) != 0 {
+		t.Errorf("%d bytes left after STOP", len(d.Remaining()))
+	}
+}
+
+func TestCompactDecoderRejectsBadInput(t *testing.T) {
+	if _, err := NewTCompactDecoder([]byte{0x80, 0x80}).ReadI32(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a short varint, got %v", err)
+	}
+
+	if _, err := NewTCompactDecoder(AppendCompactVarint32(nil, 8)).ReadString(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a short string, got %v", err)
+	}
+
+	if _, err := NewTCompactDecoder(AppendCompactVarint32(nil, 0xffffffff)).ReadBinary(); err == nil || err.TypeId() != NEGATIVE_SIZE {
+		t.Errorf("Expected NEGATIVE_SIZE for a negative length, got %v", err)
+	}
+
+	if _, _, err := NewTCompactDecoder([]byte{0x1d}).ReadFieldBegin(0); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for an unknown type, got %v", err)
+	}
+
+	// A struct holding each container, which Skip() would otherwise loop
+	// over 2^31 times without reading a byte
+	for _, field := range []struct {
+		typeId TType
+		header []byte
+	}{
+		{LIST, AppendCompactListBegin(nil, STOP, 0x7fffffff)},
+		{MAP, AppendCompactMapBegin(nil, STOP, STOP, 0x7fffffff)},
+		{SET, AppendCompactSetBegin(nil, STOP, 1)},
+		{MAP, AppendCompactMapBegin(nil, I32, STOP, 1)},
+	} {
+		data := append(AppendCompactFieldBegin(nil, field.typeId, 1, 0), field.header...)
+		data = AppendCompactFieldStop(append(data, 0, 0, 0, 0))
+
+		if err := NewTCompactDecoder(data).Skip(STRUCT); err == nil || err.TypeId() != INVALID_DATA {
+			t.Errorf("Expected INVALID_DATA skipping % x, got %v", data, err)
+		}
+	}
+
+	if _, _, err := NewTCompactDecoder(AppendCompactListBegin(nil, I32, 2)).ReadListBegin(); err == nil || err.TypeId() != INVALID_DATA {
+		t.Errorf("Expected INVALID_DATA for a list larger than the data left, got %v", err)
+	}
+}
+
+func TestCompactProtocolReadsFieldsAfterNestedStructs(t *testing.T) {
+	transport := NewTMemoryBuffer()
+	p := NewTCompactProtocol(transport)
+	p.WriteStructBegin("outer")
+	p.WriteFieldBegin("middle", STRUCT, 5)
+	p.WriteStructBegin("middle")
+	p.WriteFieldBegin("inner", STRUCT, 1)
+	p.WriteStructBegin("inner")
+	p.WriteFieldStop()
+	p.WriteStructEnd()
+	p.WriteFieldStop()
+	p.WriteStructEnd()
+	p.WriteFieldBegin("after", BINARY, 6)
+	p.WriteBinary([]byte("x"))
+	p.WriteFieldStop()
+	p.WriteStructEnd()
+
+	p.ReadStructBegin()
+	p.ReadFieldBegin()
+	p.ReadStructBegin()
+	p.ReadFieldBegin()
+	p.ReadStructBegin()
+	p.ReadFieldBegin()
+	p.ReadStructEnd()
+	p.ReadFieldBegin()
+	p.ReadStructEnd()
+
+	if _, typeId, id, err := p.ReadFieldBegin(); err != nil || typeId != STRING || id != 6 {
+		t.Errorf("Expected STRING field 6 after the nested structs, got %v field %d: %v", typeId, id, err)
+	}
+}
@@ -22,6 +22,7 @@ package thrift
 import (
 	"encoding/binary"
 	"fmt"
+	"io"
 	"math"
 	"strings"
 )
@@ -105,6 +106,31 @@ type TCompactProtocol struct {
 	 */
 	boolValue          bool
 	boolValueIsNotNull bool
+
+	/**
+	 * Scratch space for encoding varints, doubles and single bytes before
+	 * they are written to the transport.
+	 */
+	buffer [10]byte
+
+	/**
+	 * Scratch space for single bytes and doubles as they are read, kept
+	 * apart from buffer since one goroutine may read requests while another
+	 * writes replies.
+	 */
+	readBuffer [8]byte
+
+	/**
+	 * Reused to decode and encode the elements of bulk lists; see
+	 * TListReader and TListWriter.
+	 */
+	listReadBuffer  []byte
+	listWriteBuffer []byte
+
+	/**
+	 * Where binary values and strings are read into, if set; see TArena.
+	 */
+	arena *TArena
 }
 
 /**
@@ -312,9 +338,7 @@ func (p *TCompactProtocol) WriteI64(value int64) TProtocolException {
  * Write a double to the wire as 8 bytes.
  */
 func (p *TCompactProtocol) WriteDouble(value float64) TProtocolException {
-	buf := make([]byte, 8)
-	binary.LittleEndian.PutUint64(buf, math.Float64bits(value))
-	_, err := p.trans.Write(buf)
+	_, err := p.trans.Write(AppendCompactDouble(p.buffer[:0], value))
 	return NewTProtocolExceptionFromOsError(err)
 }
 
@@ -342,6 +366,19 @@ func (p *TCompactProtocol) WriteBinary(bin []byte) TProtocolException {
 	return nil
 }
 
+/**
+ * Writes size bytes read from reader as a binary value; see
+ * TBinaryStreamer.
+ */
+func (p *TCompactProtocol) WriteBinaryFromReader(reader io.Reader, size int) TProtocolException {
+	_, e := p.writeVarint32(int32(size))
+	if e != nil {
+		return NewTProtocolExceptionFromOsError(e)
+	}
+	_, e = io.CopyN(p.trans, reader, int64(size))
+	return NewTProtocolExceptionFromOsError(e)
+}
+
 //
 // Reading methods.
 //
@@ -394,6 +431,7 @@ func (p *TCompactProtocol) ReadStructBegin() (name string, err TProtocolExceptio
 func (p *TCompactProtocol) ReadStructEnd() TProtocolException {
 	// consume the last field we read off the wire.
 	p.lastFieldId = p.lastField[len(p.lastField)-1]
+	p.lastField = p.lastField[:len(p.lastField)-1]
 	return nil
 }
 
@@ -529,7 +567,7 @@ func (p *TCompactProtocol) ReadBool() (value bool, err TProtocolException) {
  * Read a single byte off the wire. Nothing interesting here.
  */
 func (p *TCompactProtocol) ReadByte() (value byte, err TProtocolException) {
-	buf := []byte{0}
+	buf := p.readBuffer[:1]
 	_, e := p.trans.ReadAll(buf)
 	if e != nil {
 		return 0, NewTProtocolExceptionFromOsError(e)
@@ -573,7 +611,7 @@ func (p *TCompactProtocol) ReadI64() (value int64, err TProtocolException) {
  * No magic here - just read a double off the wire.
  */
 func (p *TCompactProtocol) ReadDouble() (value float64, err TProtocolException) {
-	longBits := make([]byte, 8)
+	longBits := p.readBuffer[:8]
 	_, e := p.trans.ReadAll(longBits)
 	if e != nil {
 		return 0.0, NewTProtocolExceptionFromOsError(e)
@@ -586,6 +624,9 @@ func (p *TCompactProtocol) ReadDouble() (value float64, err TProtocolException)
  */
 func (p *TCompactProtocol) ReadString() (value string, err TProtocolException) {
 	v, e := p.ReadBinary()
+	if p.arena != nil {
+		return borrowString(v), NewTProtocolExceptionFromOsError(e)
+	}
 	return string(v), NewTProtocolExceptionFromOsError(e)
 }
 
@@ -601,11 +642,247 @@ func (p *TCompactProtocol) ReadBinary() (value []byte, err TProtocolException) {
 		return []byte{}, nil
 	}
 
-	buf := make([]byte, length)
+	buf := p.newBytes(int(length))
+	p.trans.ReadAll(buf)
+	return buf, nil
+}
+
+/**
+ * Reads a []byte in place from a transport that is a TBorrower, and
+ * otherwise as ReadBinary() does; see TBorrowingReader.
+ */
+func (p *TCompactProtocol) ReadBinaryBorrowed() (value []byte, err TProtocolException) {
+	length, e := p.readVarint32()
+	if e != nil {
+		return []byte{}, NewTProtocolExceptionFromOsError(e)
+	}
+	if length == 0 {
+		return []byte{}, nil
+	}
+	if buf, ok := borrowTransport(p.trans, int(length)); ok {
+		return buf, nil
+	}
+
+	buf := p.newBytes(int(length))
 	p.trans.ReadAll(buf)
 	return buf, nil
 }
 
+/**
+ * Reads a string in place from a transport that is a TBorrower, and
+ * otherwise as ReadString() does; see TBorrowingReader.
+ */
+func (p *TCompactProtocol) ReadStringBorrowed() (value string, err TProtocolException) {
+	length, e := p.readVarint32()
+	if e != nil {
+		return "", NewTProtocolExceptionFromOsError(e)
+	}
+	if buf, ok := borrowTransport(p.trans, int(length)); ok {
+		return borrowString(buf), nil
+	}
+
+	buf := p.newBytes(int(length))
+	p.trans.ReadAll(buf)
+	if p.arena != nil {
+		return borrowString(buf), nil
+	}
+	return string(buf), nil
+}
+
+/**
+ * A slice of size bytes to read a binary value into, from the arena if
+ * there is one.
+ */
+func (p *TCompactProtocol) newBytes(size int) []byte {
+	if p.arena != nil {
+		return p.arena.Bytes(size)
+	}
+	return make([]byte, size)
+}
+
+func (p *TCompactProtocol) SetArena(arena *TArena) {
+	p.arena = arena
+}
+
+func (p *TCompactProtocol) Arena() *TArena {
+	return p.arena
+}
+
+/**
+ * Copies a binary value from the transport to writer without holding more
+ * than a small buffer of it in memory; see TBinaryStreamer.
+ */
+func (p *TCompactProtocol) ReadBinaryToWriter(writer io.Writer) (int64, TProtocolException) {
+	length, e := p.readVarint32()
+	if e != nil {
+		return 0, NewTProtocolExceptionFromOsError(e)
+	}
+	if length < 0 {
+		return 0, NewTProtocolException(NEGATIVE_SIZE, "Negative length in compact data")
+	}
+	n, e := io.CopyN(writer, p.trans, int64(length))
+	return n, NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Reads size bytes as a list's elements; see TListReader.
+ */
+func (p *TCompactProtocol) ReadByteList(dst []byte, size int) ([]byte, TProtocolException) {
+	for size > 0 {
+		n := size
+		if n > listChunkBytes {
+			n = listChunkBytes
+		}
+		var values []byte
+		dst, values = growBytes(dst, n)
+		if _, e := p.trans.ReadAll(values); e != nil {
+			return dst, NewTProtocolExceptionFromOsError(e)
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size zigzag varint i32s straight from the transport if it is an
+ * io.ByteReader; see TListReader.
+ */
+func (p *TCompactProtocol) ReadI32List(dst []int32, size int) ([]int32, TProtocolException) {
+	reader := p.byteReader()
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/4 {
+			n = listChunkBytes / 4
+		}
+		var values []int32
+		dst, values = growI32s(dst, n)
+		for i := range values {
+			v, e := binary.ReadUvarint(reader)
+			if e != nil {
+				return dst, NewTProtocolExceptionFromOsError(e)
+			}
+			values[i] = p.zigzagToInt32(int32(v))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size zigzag varint i64s straight from the transport if it is an
+ * io.ByteReader; see TListReader.
+ */
+func (p *TCompactProtocol) ReadI64List(dst []int64, size int) ([]int64, TProtocolException) {
+	reader := p.byteReader()
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		var values []int64
+		dst, values = growI64s(dst, n)
+		for i := range values {
+			v, e := binary.ReadUvarint(reader)
+			if e != nil {
+				return dst, NewTProtocolExceptionFromOsError(e)
+			}
+			values[i] = p.zigzagToInt64(int64(v))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size doubles a scratch buffer at a time; see TListReader.
+ */
+func (p *TCompactProtocol) ReadDoubleList(dst []float64, size int) ([]float64, TProtocolException) {
+	if p.listReadBuffer == nil {
+		p.listReadBuffer = make([]byte, listChunkBytes)
+	}
+	for size > 0 {
+		n := size
+		if n > listChunkBytes/8 {
+			n = listChunkBytes / 8
+		}
+		buf := p.listReadBuffer[:n*8]
+		if _, e := p.trans.ReadAll(buf); e != nil {
+			return dst, NewTProtocolExceptionFromOsError(e)
+		}
+		var values []float64
+		dst, values = growDoubles(dst, n)
+		for i := range values {
+			values[i] = math.Float64frombits(p.bytesToUint64(buf[i*8:]))
+		}
+		size -= n
+	}
+	return dst, nil
+}
+
+/**
+ * Writes values as a list's elements; see TListWriter.
+ */
+func (p *TCompactProtocol) WriteByteList(values []byte) TProtocolException {
+	_, e := p.trans.Write(values)
+	return NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Writes values as zigzag varints, a scratch buffer of them at a time; see
+ * TListWriter.
+ */
+func (p *TCompactProtocol) WriteI32List(values []int32) TProtocolException {
+	buf := p.writeListBuffer()
+	for _, v := range values {
+		if len(buf) > listChunkBytes-5 {
+			if _, e := p.trans.Write(buf); e != nil {
+				return NewTProtocolExceptionFromOsError(e)
+			}
+			buf = buf[:0]
+		}
+		buf = AppendCompactVarint32(buf, uint32(p.int32ToZigzag(v)))
+	}
+	_, e := p.trans.Write(buf)
+	return NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Writes values as zigzag varints, a scratch buffer of them at a time; see
+ * TListWriter.
+ */
+func (p *TCompactProtocol) WriteI64List(values []int64) TProtocolException {
+	buf := p.writeListBuffer()
+	for _, v := range values {
+		if len(buf) > listChunkBytes-10 {
+			if _, e := p.trans.Write(buf); e != nil {
+				return NewTProtocolExceptionFromOsError(e)
+			}
+			buf = buf[:0]
+		}
+		buf = AppendCompactVarint64(buf, uint64(p.int64ToZigzag(v)))
+	}
+	_, e := p.trans.Write(buf)
+	return NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Writes values a scratch buffer at a time; see TListWriter.
+ */
+func (p *TCompactProtocol) WriteDoubleList(values []float64) TProtocolException {
+	buf := p.writeListBuffer()
+	for _, v := range values {
+		if len(buf) == listChunkBytes {
+			if _, e := p.trans.Write(buf); e != nil {
+				return NewTProtocolExceptionFromOsError(e)
+			}
+			buf = buf[:0]
+		}
+		buf = AppendCompactDouble(buf, v)
+	}
+	_, e := p.trans.Write(buf)
+	return NewTProtocolExceptionFromOsError(e)
+}
+
 func (p *TCompactProtocol) Flush() (err TProtocolException) {
 	return NewTProtocolExceptionFromOsError(p.trans.Flush())
 }
@@ -640,48 +917,16 @@ func (p *TCompactProtocol) writeCollectionBegin(elemType TType, size int) (int,
 
 /**
  * Write an i32 as a varint. Results in 1-5 bytes on the wire.
- * TODO(pomack): make a permanent buffer like writeVarint64?
  */
 func (p *TCompactProtocol) writeVarint32(n int32) (int, error) {
-	i32buf := make([]byte, 5)
-	idx := 0
-	for {
-		if (n & ^0x7F) == 0 {
-			i32buf[idx] = byte(n)
-			idx++
-			// p.writeByteDirect(byte(n));
-			break
-			// return;
-		} else {
-			i32buf[idx] = byte((n & 0x7F) | 0x80)
-			idx++
-			// p.writeByteDirect(byte(((n & 0x7F) | 0x80)));
-			u := uint32(n)
-			n = int32(u >> 7)
-		}
-	}
-	return p.trans.Write(i32buf[0:idx])
+	return p.trans.Write(AppendCompactVarint32(p.buffer[:0], uint32(n)))
 }
 
 /**
  * Write an i64 as a varint. Results in 1-10 bytes on the wire.
  */
 func (p *TCompactProtocol) writeVarint64(n int64) (int, error) {
-	varint64out := make([]byte, 10)
-	idx := 0
-	for {
-		if (n & ^0x7F) == 0 {
-			varint64out[idx] = byte(n)
-			idx++
-			break
-		} else {
-			varint64out[idx] = byte((n & 0x7F) | 0x80)
-			idx++
-			u := uint64(n)
-			n = int64(u >> 7)
-		}
-	}
-	return p.trans.Write(varint64out[0:idx])
+	return p.trans.Write(AppendCompactVarint64(p.buffer[:0], uint64(n)))
 }
 
 /**
@@ -713,7 +958,8 @@ func (p *TCompactProtocol) fixedInt64ToBytes(n int64, buf []byte) {
  * Used internally by other writing methods that know they need to write a byte.
  */
 func (p *TCompactProtocol) writeByteDirect(b byte) (int, error) {
-	return p.trans.Write([]byte{b})
+	p.buffer[0] = b
+	return p.trans.Write(p.buffer[:1])
 }
 
 /**
@@ -723,10 +969,40 @@ func (p *TCompactProtocol) writeIntAsByteDirect(n int) (int, error) {
 	return p.writeByteDirect(byte(n))
 }
 
+/**
+ * listWriteBuffer emptied, for a bulk list to be encoded into up to
+ * listChunkBytes at a time.
+ */
+func (p *TCompactProtocol) writeListBuffer() []byte {
+	if p.listWriteBuffer == nil {
+		p.listWriteBuffer = make([]byte, 0, listChunkBytes)
+	}
+	return p.listWriteBuffer[:0]
+}
+
 //
 // Internal reading methods
 //
 
+/**
+ * The transport, if it can be read a byte at a time, or else the protocol's
+ * own ReadByte(), through which the varints of a bulk list are read.
+ */
+func (p *TCompactProtocol) byteReader() io.ByteReader {
+	if reader, ok := p.trans.(io.ByteReader); ok {
+		return reader
+	}
+	return compactByteReader{p}
+}
+
+type compactByteReader struct {
+	p *TCompactProtocol
+}
+
+func (r compactByteReader) ReadByte() (byte, error) {
+	return r.p.ReadByte()
+}
+
 /**
  * Read an i32 from the wire as a varint. The MSB of each byte is set
  * if there is another byte to follow. This can read up to 5 bytes.
@@ -813,8 +1089,7 @@ func (p *TCompactProtocol) getTType(t TCompactType) (TType, error) {
 	switch byte(t) & 0x0f {
 	case STOP:
 		return STOP, nil
-	case COMPACT_BOOLEAN_FALSE:
-	case COMPACT_BOOLEAN_TRUE:
+	case COMPACT_BOOLEAN_FALSE, COMPACT_BOOLEAN_TRUE:
 		return BOOL, nil
 	case COMPACT_BYTE:
 		return BYTE, nil
@@ -844,5 +1119,5 @@ func (p *TCompactProtocol) getTType(t TCompactType) (TType, error) {
  * Given a TType value, find the appropriate TCompactProtocol.Types constant.
  */
 func (p *TCompactProtocol) getCompactType(t TType) TCompactType {
-	return _TTypeToCompactType[int(t)]
+	return _TTypeToCompactType[int(t.ThriftTypeId())]
 }
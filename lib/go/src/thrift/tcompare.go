@@ -19,6 +19,10 @@
 
 package thrift
 
+import (
+	"bytes"
+)
+
 func CompareInt(i, j int) int {
 	if i > j {
 		return 1
@@ -124,3 +128,20 @@ func CompareBool(i, j bool) int {
 	}
 	return 0
 }
+
+/**
+ * Orders as bytes.Compare() does, except that a nil slice comes before any
+ * other, so that an unset binary field differs from an empty one.
+ */
+func CompareBytes(i, j []byte) int {
+	if i == nil || j == nil {
+		if i != nil {
+			return 1
+		}
+		if j != nil {
+			return -1
+		}
+		return 0
+	}
+	return bytes.Compare(i, j)
+}
@@ -0,0 +1,267 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"sync"
+	"sync/atomic"
+)
+
+/**
+ * Implemented by the generated Args structs.
+ */
+type TWritable interface {
+	Write(oprot TProtocol) TProtocolException
+}
+
+/**
+ * Implemented by the generated Result structs.
+ */
+type TReadable interface {
+	Read(iprot TProtocol) TProtocolException
+}
+
+/**
+ * Issues calls from any number of goroutines over a single transport without
+ * waiting for one reply before sending the next request.  The generated
+ * ConcurrentClients embed it.
+ *
+ * Callers take turns writing their requests.  The last of a run of callers
+ * waiting to write flushes for all of them, so a burst of calls leaves in one
+ * write.  A goroutine started by the first call reads the replies and hands
+ * each to the caller waiting on its sequence id; the server may answer in any
+ * order.  At most maxInFlight calls are outstanding at once, if it is
+ * greater than zero, and further callers wait for one of those to finish.
+ *
+ * An error reading or writing the transport fails every outstanding call and
+ * all those made after it, since the stream can no longer be trusted.
+ */
+type TConcurrentClient struct {
+	transport TTransport
+	iprot     TProtocol
+	oprot     TProtocol
+	slots     chan struct{}
+
+	writeLock sync.Mutex
+	waiting   int32
+	seqId     int32
+
+	lock    sync.Mutex
+	pending map[int32]*tConcurrentCall
+	err     error
+	failed  chan struct{}
+
+	readerStart sync.Once
+	readerDone  sync.WaitGroup
+}
+
+type tConcurrentCall struct {
+	result TReadable
+	done   chan error
+}
+
+var concurrentCalls = sync.Pool{
+	New: func() interface{} {
+		return &tConcurrentCall{done: make(chan error, 1)}
+	},
+}
+
+func NewTConcurrentClient(t TTransport, f TProtocolFactory, maxInFlight int) *TConcurrentClient {
+	return NewTConcurrentClientProtocol(t, f.GetProtocol(t), f.GetProtocol(t), maxInFlight)
+}
+
+func NewTConcurrentClientProtocol(t TTransport, iprot TProtocol, oprot TProtocol, maxInFlight int) *TConcurrentClient {
+	p := &TConcurrentClient{
+		transport: t,
+		iprot:     iprot,
+		oprot:     oprot,
+		pending:   make(map[int32]*tConcurrentCall),
+		failed:    make(chan struct{}),
+	}
+	if maxInFlight > 0 {
+		p.slots = make(chan struct{}, maxInFlight)
+	}
+	return p
+}
+
+func (p *TConcurrentClient) Transport() TTransport {
+	return p.transport
+}
+
+/**
+ * Sends a call to the named function and, unless result is nil, as it is for
+ * oneway functions, waits for its reply to be read into result.  The error
+ * returned is that of the transport or protocol, or the TApplicationException
+ * the server replied with.
+ */
+func (p *TConcurrentClient) Call(name string, args TWritable, result TReadable) error {
+	if p.slots != nil {
+		select {
+		case p.slots <- struct{}{}:
+			defer func() { <-p.slots }()
+		case <-p.failed:
+			return p.failure()
+		}
+	}
+	var call *tConcurrentCall
+	if result != nil {
+		p.readerStart.Do(p.startReader)
+		call = concurrentCalls.Get().(*tConcurrentCall)
+		call.result = result
+	}
+	atomic.AddInt32(&p.waiting, 1)
+	p.writeLock.Lock()
+	p.seqId++
+	err := p.register(p.seqId, call)
+	if err == nil {
+		err = p.writeCall(name, p.seqId, args)
+	}
+	if atomic.AddInt32(&p.waiting, -1) == 0 && err == nil {
+		err = p.oprot.Flush()
+	}
+	p.writeLock.Unlock()
+	if err != nil {
+		p.fail(err)
+	}
+	if call == nil {
+		return err
+	}
+	if err == nil || len(call.done) > 0 {
+		err = <-call.done
+	}
+	call.result = nil
+	concurrentCalls.Put(call)
+	return err
+}
+
+/**
+ * Fails every outstanding call and closes the transport once the goroutine
+ * reading replies has stopped.
+ */
+func (p *TConcurrentClient) Close() error {
+	p.fail(NewTTransportException(NOT_OPEN, "Client closed"))
+	p.readerDone.Wait()
+	p.writeLock.Lock()
+	defer p.writeLock.Unlock()
+	return p.transport.Close()
+}
+
+func (p *TConcurrentClient) writeCall(name string, seqId int32, args TWritable) error {
+	if err := p.oprot.WriteMessageBegin(name, CALL, seqId); err != nil {
+		return err
+	}
+	if sizer, ok := args.(TSizer); ok {
+		GrowForWrite(p.oprot, sizer)
+	}
+	if err := args.Write(p.oprot); err != nil {
+		return err
+	}
+	if err := p.oprot.WriteMessageEnd(); err != nil {
+		return err
+	}
+	return nil
+}
+
+/**
+ * Records that call waits on the reply to seqId, unless the client has
+ * failed.  Oneway calls, which have no call, only check for the failure.
+ */
+func (p *TConcurrentClient) register(seqId int32, call *tConcurrentCall) error {
+	p.lock.Lock()
+	defer p.lock.Unlock()
+	if p.err != nil {
+		return p.err
+	}
+	if call != nil {
+		p.pending[seqId] = call
+	}
+	return nil
+}
+
+func (p *TConcurrentClient) failure() error {
+	p.lock.Lock()
+	defer p.lock.Unlock()
+	return p.err
+}
+
+/**
+ * Fails the client with err if it has not failed already, handing err to
+ * every outstanding call and interrupting the transport so that the reader
+ * stops.
+ */
+func (p *TConcurrentClient) fail(err error) {
+	p.lock.Lock()
+	defer p.lock.Unlock()
+	if p.err != nil {
+		return
+	}
+	p.err = err
+	close(p.failed)
+	for seqId, call := range p.pending {
+		call.done <- err
+		delete(p.pending, seqId)
+	}
+	InterruptTransport(p.transport)
+}
+
+func (p *TConcurrentClient) startReader() {
+	p.readerDone.Add(1)
+	go p.readReplies()
+}
+
+func (p *TConcurrentClient) readReplies() {
+	defer p.readerDone.Done()
+	for {
+		_, typeId, seqId, err := p.iprot.ReadMessageBegin()
+		if err != nil {
+			p.fail(err)
+			return
+		}
+		p.lock.Lock()
+		call := p.pending[seqId]
+		delete(p.pending, seqId)
+		p.lock.Unlock()
+		if call == nil {
+			p.fail(NewTApplicationException(BAD_SEQUENCE_ID, "Reply to an unknown call"))
+			return
+		}
+		var callErr, readErr error
+		if typeId == EXCEPTION {
+			var x TApplicationException
+			x, readErr = NewTApplicationExceptionDefault().Read(p.iprot)
+			if x != nil {
+				callErr = x
+			}
+		} else if e := call.result.Read(p.iprot); e != nil {
+			readErr = e
+		}
+		if readErr == nil {
+			if e := p.iprot.ReadMessageEnd(); e != nil {
+				readErr = e
+			}
+		}
+		if readErr != nil {
+			call.done <- readErr
+			p.fail(readErr)
+			return
+		}
+		call.done <- callErr
+	}
+}
@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"sync"
+)
+
+/**
+ * Serves the calls arriving on one connection concurrently, replying to each
+ * as its handler finishes rather than in the order the calls were made.
+ *
+ * The calling goroutine reads one call after another.  The handler of each
+ * call whose generated function is a TSplitProcessorFunction runs in a
+ * goroutine of its own, at most maxConcurrent at once, and writes its reply
+ * into a buffer from a per-connection free list through a protocol from
+ * replyFactory.  A single writer copies the finished replies, each tagged
+ * with the sequence id of its call, to oprot's transport and flushes once no
+ * more are ready, so that a burst of replies leaves in one write; over a
+ * TFramedTransport such a burst shares a frame.
+ *
+ * A handler that fails is answered with a TApplicationException, as it would
+ * be by the processor, but the connection stays open for the other calls.
+ * An unknown method, a malformed call or a transport error ends the
+ * connection once the calls already read have been answered, and is
+ * returned.  A processor that does not look up its functions by name, or a
+ * maxConcurrent below 2, is served one call at a time as before.
+ */
+func ProcessConcurrently(processor TProcessor, iprot, oprot TProtocol, replyFactory TProtocolFactory, maxConcurrent int) TException {
+	functions, ok := processor.(TProcessorFunctionMap)
+	if !ok || maxConcurrent < 2 {
+		for {
+			ok, err := processor.Process(iprot, oprot)
+			if err != nil || !ok {
+				return err
+			}
+		}
+	}
+	return processDispatched(functions, iprot, oprot, replyFactory, maxConcurrent, func(handle func()) bool {
+		go handle()
+		return true
+	})
+}
+
+/**
+ * Serves a connection as ProcessConcurrently() does, but hands each handler
+ * to dispatch to run, which reports false if it would not.  A call that is
+ * refused this way is answered with a TApplicationException at once, unless
+ * it is oneway: its client reads no answer, so it is dropped.
+ */
+func processDispatched(functions TProcessorFunctionMap, iprot, oprot TProtocol, replyFactory TProtocolFactory, maxConcurrent int, dispatch func(handle func()) bool) TException {
+	if maxConcurrent < 1 {
+		maxConcurrent = 1
+	}
+	p := &tConcurrentProcessor{
+		functions:    functions,
+		iprot:        iprot,
+		oprot:        oprot,
+		replyFactory: replyFactory,
+		dispatch:     dispatch,
+		slots:        make(chan struct{}, maxConcurrent),
+		free:         make(chan *tConcurrentReply, maxConcurrent),
+		replies:      make(chan *tConcurrentReply, maxConcurrent),
+		writerDone:   make(chan struct{}),
+	}
+	go p.writeReplies()
+	err := p.readCalls()
+	p.handlers.Wait()
+	close(p.replies)
+	<-p.writerDone
+	return err
+}
+
+type tConcurrentProcessor struct {
+	functions    TProcessorFunctionMap
+	iprot        TProtocol
+	oprot        TProtocol
+	replyFactory TProtocolFactory
+	dispatch     func(handle func()) bool
+	slots        chan struct{}
+	free         chan *tConcurrentReply
+	replies      chan *tConcurrentReply
+	handlers     sync.WaitGroup
+	writerDone   chan struct{}
+}
+
+type tConcurrentReply struct {
+	buffer   *TMemoryBuffer
+	protocol TProtocol
+}
+
+/**
+ * Replies larger than this are not kept on the free list, so that one large
+ * reply does not pin its buffer for the life of the connection.
+ */
+const maxConcurrentReplyScratch = 64 * 1024
+
+func (p *tConcurrentProcessor) readCalls() TException {
+	for {
+		p.slots <- struct{}{}
+		name, _, seqId, err := p.iprot.ReadMessageBegin()
+		if err != nil {
+			<-p.slots
+			return err
+		}
+		function, found := p.functions.GetProcessorFunction(name)
+		if !found || function == nil {
+			p.iprot.Skip(STRUCT)
+			p.iprot.ReadMessageEnd()
+			x := NewTApplicationException(UNKNOWN_METHOD, "Unknown function "+name)
+			p.replyException(name, seqId, x)
+			return x
+		}
+		split, ok := function.(TSplitProcessorFunction)
+		if !ok {
+			reply := p.getReply()
+			ok, err := function.Process(seqId, p.iprot, reply.protocol)
+			p.finish(reply)
+			if err != nil || !ok {
+				return err
+			}
+			continue
+		}
+		args, err := split.ReadArgs(p.iprot)
+		if err != nil {
+			p.replyException(name, seqId, NewTApplicationException(PROTOCOL_ERROR, err.Error()))
+			return err
+		}
+		p.handlers.Add(1)
+		handle := func() {
+			defer p.handlers.Done()
+			reply := p.getReply()
+			split.ProcessArgs(seqId, args, reply.protocol)
+			p.finish(reply)
+		}
+		if !p.dispatch(handle) {
+			p.handlers.Done()
+			if split.IsOneway() {
+				<-p.slots
+				continue
+			}
+			p.replyException(name, seqId, NewTApplicationException(INTERNAL_ERROR, "Server overloaded, "+name+" refused"))
+		}
+	}
+}
+
+func (p *tConcurrentProcessor) replyException(name string, seqId int32, x TApplicationException) {
+	reply := p.getReply()
+	reply.protocol.WriteMessageBegin(name, EXCEPTION, seqId)
+	x.Write(reply.protocol)
+	reply.protocol.WriteMessageEnd()
+	p.finish(reply)
+}
+
+func (p *tConcurrentProcessor) getReply() *tConcurrentReply {
+	select {
+	case reply := <-p.free:
+		return reply
+	default:
+	}
+	buffer := NewTMemoryBuffer()
+	return &tConcurrentReply{buffer: buffer, protocol: p.replyFactory.GetProtocol(buffer)}
+}
+
+func (p *tConcurrentProcessor) putReply(reply *tConcurrentReply) {
+	if reply.buffer.buf.Cap() > maxConcurrentReplyScratch {
+		return
+	}
+	reply.buffer.Reset()
+	select {
+	case p.free <- reply:
+	default:
+	}
+}
+
+/**
+ * Hands a finished reply to the writer, unless there is none, as for a
+ * oneway call, and frees the call's slot.
+ */
+func (p *tConcurrentProcessor) finish(reply *tConcurrentReply) {
+	if reply.buffer.Len() > 0 {
+		p.replies <- reply
+	} else {
+		p.putReply(reply)
+	}
+	<-p.slots
+}
+
+/**
+ * Once writing fails the remaining replies are dropped, and the input is
+ * interrupted so that no more calls are read.
+ */
+func (p *tConcurrentProcessor) writeReplies() {
+	defer close(p.writerDone)
+	trans := p.oprot.Transport()
+	var err error
+	for reply := range p.replies {
+		if err == nil {
+			_, err = trans.Write(reply.buffer.Bytes())
+			if err == nil && len(p.replies) == 0 {
+				err = trans.Flush()
+			}
+			if err != nil {
+				InterruptTransport(p.iprot.Transport())
+			}
+		}
+		p.putReply(reply)
+	}
+}
@@ -25,3 +25,36 @@ type TContainer interface {
 	Equals(other interface{}) bool
 	CompareTo(other interface{}) (int, bool)
 }
+
+/**
+ * The largest number of elements a container will reserve room for up front.
+ * Container sizes read off the wire are untrusted, so a larger container
+ * still grows one element at a time as its contents actually arrive.
+ */
+var (
+	MaxContainerCapacityHint = 1 << 16
+)
+
+/**
+ * Specifies the largest capacity that will be preallocated for a container
+ * on the strength of its declared size.  This is a global setting.
+ *
+ * @param size  the maximum number of elements to reserve room for.
+ */
+func SetMaxContainerCapacityHint(size int) {
+	MaxContainerCapacityHint = size
+}
+
+/**
+ * Returns the capacity to preallocate for a container declared to hold size
+ * elements, clamped to [0, MaxContainerCapacityHint].
+ */
+func ContainerCapacityHint(size int) int {
+	if size <= 0 {
+		return 0
+	}
+	if size > MaxContainerCapacityHint {
+		return MaxContainerCapacityHint
+	}
+	return size
+}
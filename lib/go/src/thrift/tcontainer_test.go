@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"testing"
+)
+
+func TestContainerCapacityHint(t *testing.T) {
+	defer SetMaxContainerCapacityHint(MaxContainerCapacityHint)
+	SetMaxContainerCapacityHint(100)
+	for i, definition := range []struct {
+		in  int
+		out int
+	}{
+		{-1, 0},
+		{0, 0},
+		{1, 1},
+		{100, 100},
+		{101, 100},
+		{1 << 30, 100},
+	} {
+		if actual := ContainerCapacityHint(definition.in); actual != definition.out {
+			t.Errorf("%d. ContainerCapacityHint(%d) => %d, want %d", i, definition.in, actual, definition.out)
+		}
+	}
+}
+
+func TestListCapacityHint(t *testing.T) {
+	defer SetMaxContainerCapacityHint(MaxContainerCapacityHint)
+	SetMaxContainerCapacityHint(100)
+	if l := NewTList(I64, 10).(*tList); cap(l.l) != 10 {
+		t.Errorf("Expected capacity of 10, but was %d", cap(l.l))
+	}
+	if l := NewTList(I64, 1<<30).(*tList); cap(l.l) != 100 {
+		t.Errorf("Expected capacity capped at 100, but was %d", cap(l.l))
+	}
+	if l := NewTList(I64, -5).(*tList); cap(l.l) != 0 || l.Len() != 0 {
+		t.Errorf("Expected an empty list for a negative size, but was %d/%d", l.Len(), cap(l.l))
+	}
+}
@@ -130,6 +130,7 @@ type TFieldContainer interface {
 	FieldFromFieldId(id int) TField
 	FieldFromFieldName(name string) TField
 	At(i int) TField
+	ForEach(f func(field TField) error) error
 	Iter() <-chan TField
 }
 
@@ -263,6 +264,19 @@ func (p *tFieldContainer) CompareTo(other interface{}) (int, bool) {
 	return 0, false
 }
 
+/**
+ * Calls f for each field, stopping at and returning the first error f
+ * returns.  Unlike Iter(), no goroutine or channel is involved.
+ */
+func (p *tFieldContainer) ForEach(f func(field TField) error) error {
+	for _, field := range p.fields {
+		if err := f(field); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
 func (p *tFieldContainer) Iter() <-chan TField {
 	c := make(chan TField)
 	go p.iterate(c)
@@ -22,30 +22,113 @@ package thrift
 import (
 	"bytes"
 	"encoding/binary"
+	"strconv"
+	"sync"
 )
 
+const (
+	/**
+	 * The largest frame a TFramedTransport reads unless told otherwise, as
+	 * in the other Thrift libraries.
+	 */
+	DEFAULT_MAX_FRAME_SIZE = 16384000
+
+	frameHeaderSize = 4
+
+	/**
+	 * Frames are read into pooled buffers of minFrameBuffer bytes doubled
+	 * up to frameBufferClasses - 1 times; larger frames get buffers of
+	 * their own.
+	 */
+	minFrameBuffer     = 512
+	frameBufferClasses = 16
+)
+
+/**
+ * Reads and writes messages as frames, each preceded by its length as a
+ * 4-byte big-endian integer.
+ *
+ * A frame is written into a buffer that reserves room for its header, so
+ * that Flush() sends header and body with a single write.  A frame is read
+ * whole into a buffer taken from pools shared by all TFramedTransports and
+ * sorted by size, and the buffer goes back to its pool once the frame has
+ * been read through, so that reading takes no allocations once the pools
+ * are warm.
+ */
 type TFramedTransport struct {
-	transport   TTransport
-	writeBuffer *bytes.Buffer
-	readBuffer  *bytes.Buffer
+	transport    TTransport
+	maxFrameSize int
+	writeBuffer  *bytes.Buffer
+	header       [frameHeaderSize]byte
+
+	// The pooled buffer the frame being read is in, or nil, and the part
+	// of the frame that has not been read yet
+	frame  *[]byte
+	unread []byte
+
+	// Set once anything has been borrowed from the frame, which must then
+	// not be reused
+	borrowed bool
+}
+
+var (
+	frameBufferPools [frameBufferClasses]sync.Pool
+
+	// Holds the place of the header at the start of a frame being written
+	noFrameHeader [frameHeaderSize]byte
+)
+
+func init() {
+	for i := range frameBufferPools {
+		size := minFrameBuffer << uint(i)
+		frameBufferPools[i].New = func() interface{} {
+			buf := make([]byte, size)
+			return &buf
+		}
+	}
+}
+
+/**
+ * Returns the index of the smallest pool whose buffers hold size bytes, or
+ * -1 if there is none.
+ */
+func frameBufferClass(size int) int {
+	for i := 0; i < frameBufferClasses; i++ {
+		if size <= minFrameBuffer<<uint(i) {
+			return i
+		}
+	}
+	return -1
 }
 
 type tFramedTransportFactory struct {
-	factory TTransportFactory
+	factory      TTransportFactory
+	maxFrameSize int
 }
 
 func NewTFramedTransportFactory(factory TTransportFactory) TTransportFactory {
-	return &tFramedTransportFactory{factory: factory}
+	return NewTFramedTransportFactoryMaxFrameSize(factory, DEFAULT_MAX_FRAME_SIZE)
+}
+
+func NewTFramedTransportFactoryMaxFrameSize(factory TTransportFactory, maxFrameSize int) TTransportFactory {
+	return &tFramedTransportFactory{factory: factory, maxFrameSize: maxFrameSize}
 }
 
 func (p *tFramedTransportFactory) GetTransport(base TTransport) TTransport {
-	return NewTFramedTransport(p.factory.GetTransport(base))
+	return NewTFramedTransportMaxFrameSize(p.factory.GetTransport(base), p.maxFrameSize)
 }
 
 func NewTFramedTransport(transport TTransport) *TFramedTransport {
-	writeBuf := make([]byte, 0, 1024)
-	readBuf := make([]byte, 0, 1024)
-	return &TFramedTransport{transport: transport, writeBuffer: bytes.NewBuffer(writeBuf), readBuffer: bytes.NewBuffer(readBuf)}
+	return NewTFramedTransportMaxFrameSize(transport, DEFAULT_MAX_FRAME_SIZE)
+}
+
+/**
+ * Makes a TFramedTransport that refuses to read a frame longer than
+ * maxFrameSize bytes.
+ */
+func NewTFramedTransportMaxFrameSize(transport TTransport, maxFrameSize int) *TFramedTransport {
+	writeBuf := make([]byte, frameHeaderSize, 1024)
+	return &TFramedTransport{transport: transport, maxFrameSize: maxFrameSize, writeBuffer: bytes.NewBuffer(writeBuf)}
 }
 
 func (p *TFramedTransport) Open() error {
@@ -57,75 +140,158 @@ func (p *TFramedTransport) IsOpen() bool {
 }
 
 func (p *TFramedTransport) Peek() bool {
-	return p.transport.Peek()
+	return len(p.unread) > 0 || p.transport.Peek()
 }
 
+/**
+ * Closes the underlying transport, dropping the rest of the frame being
+ * read.
+ */
 func (p *TFramedTransport) Close() error {
+	p.releaseFrame()
 	return p.transport.Close()
 }
 
+func (p *TFramedTransport) Interrupt() error {
+	return InterruptTransport(p.transport)
+}
+
 func (p *TFramedTransport) Read(buf []byte) (int, error) {
-	if p.readBuffer.Len() > 0 {
-		got, err := p.readBuffer.Read(buf)
-		if got > 0 {
-			return got, NewTTransportExceptionFromOsError(err)
+	for len(p.unread) == 0 {
+		// Read another frame of data, skipping empty ones
+		if err := p.readFrame(); err != nil {
+			return 0, err
 		}
 	}
-
-	// Read another frame of data
-	p.readFrame()
-
-	got, err := p.readBuffer.Read(buf)
-	return got, NewTTransportExceptionFromOsError(err)
+	n := copy(buf, p.unread)
+	p.unread = p.unread[n:]
+	if len(p.unread) == 0 {
+		p.releaseFrame()
+	}
+	return n, nil
 }
 
 func (p *TFramedTransport) ReadAll(buf []byte) (int, error) {
 	return ReadAllTransport(p, buf)
 }
 
+/**
+ * Reads a byte of the current frame, so that a protocol reading varints need
+ * not go through ReadAll() for each byte.
+ */
+func (p *TFramedTransport) ReadByte() (byte, error) {
+	for len(p.unread) == 0 {
+		if err := p.readFrame(); err != nil {
+			return 0, err
+		}
+	}
+	b := p.unread[0]
+	p.unread = p.unread[1:]
+	if len(p.unread) == 0 {
+		p.releaseFrame()
+	}
+	return b, nil
+}
+
+/**
+ * Hands out the next n bytes of the frame being read in place; see
+ * TBorrower.  A frame that anything was borrowed from never goes back to the
+ * pool, so what is borrowed stays valid for as long as it is referenced.
+ */
+func (p *TFramedTransport) Borrow(n int) ([]byte, bool) {
+	if len(p.unread) < n {
+		return nil, false
+	}
+	buf := p.unread[:n:n]
+	p.unread = p.unread[n:]
+	p.borrowed = true
+	if len(p.unread) == 0 {
+		p.releaseFrame()
+	}
+	return buf, true
+}
+
 func (p *TFramedTransport) Write(buf []byte) (int, error) {
 	n, err := p.writeBuffer.Write(buf)
 	return n, NewTTransportExceptionFromOsError(err)
 }
 
+func (p *TFramedTransport) WriteString(buf string) (int, error) {
+	n, err := p.writeBuffer.WriteString(buf)
+	return n, NewTTransportExceptionFromOsError(err)
+}
+
+/**
+ * Makes room for another n bytes to be written to the current frame without
+ * reallocating.
+ */
+func (p *TFramedTransport) Grow(n int) {
+	p.writeBuffer.Grow(n)
+}
+
+/**
+ * Sends the frame written since the last flush, header and all, with one
+ * write to the underlying transport, and flushes it.
+ */
 func (p *TFramedTransport) Flush() error {
-	size := p.writeBuffer.Len()
-	buf := []byte{0, 0, 0, 0}
-	binary.BigEndian.PutUint32(buf, uint32(size))
-	_, err := p.transport.Write(buf)
+	frame := p.writeBuffer.Bytes()
+	size := len(frame) - frameHeaderSize
+	binary.BigEndian.PutUint32(frame, uint32(size))
+	n, err := p.writeBuffer.WriteTo(p.transport)
+	p.writeBuffer.Reset()
+	p.writeBuffer.Write(noFrameHeader[:])
 	if err != nil {
+		print("Error while flushing write buffer of size ", size, " to transport, only wrote ", n, " bytes: ", err.Error(), "\n")
 		return NewTTransportExceptionFromOsError(err)
 	}
-	if size > 0 {
-		n, err := p.writeBuffer.WriteTo(p.transport)
-		if err != nil {
-			print("Error while flushing write buffer of size ", size, " to transport, only wrote ", n, " bytes: ", err.Error(), "\n")
-			return NewTTransportExceptionFromOsError(err)
-		}
-	}
 	err = p.transport.Flush()
 	return NewTTransportExceptionFromOsError(err)
 }
 
-func (p *TFramedTransport) readFrame() (int, error) {
-	buf := []byte{0, 0, 0, 0}
-	_, err := p.transport.ReadAll(buf)
+/**
+ * Reads the next frame into a pooled buffer.
+ */
+func (p *TFramedTransport) readFrame() error {
+	p.releaseFrame()
+	_, err := p.transport.ReadAll(p.header[:])
 	if err != nil {
-		return 0, err
+		return err
 	}
-	size := int(binary.BigEndian.Uint32(buf))
+	size := int(int32(binary.BigEndian.Uint32(p.header[:])))
 	if size < 0 {
-		// TODO(pomack) log error
-		return 0, NewTTransportException(UNKNOWN_TRANSPORT_EXCEPTION, "Read a negative frame size ("+string(size)+")")
+		return NewTTransportException(UNKNOWN_TRANSPORT_EXCEPTION, "Read a negative frame size ("+strconv.Itoa(size)+")")
+	}
+	if size > p.maxFrameSize {
+		return NewTTransportException(UNKNOWN_TRANSPORT_EXCEPTION, "Frame size ("+strconv.Itoa(size)+") larger than max length ("+strconv.Itoa(p.maxFrameSize)+")")
 	}
 	if size == 0 {
-		return 0, nil
+		return nil
 	}
-	buf2 := make([]byte, size)
-	n, err := p.transport.ReadAll(buf2)
-	if err != nil {
-		return n, err
+	if class := frameBufferClass(size); class >= 0 {
+		p.frame = frameBufferPools[class].Get().(*[]byte)
+	} else {
+		buf := make([]byte, size)
+		p.frame = &buf
+	}
+	p.unread = (*p.frame)[:size]
+	if _, err = p.transport.ReadAll(p.unread); err != nil {
+		p.releaseFrame()
+		return err
+	}
+	return nil
+}
+
+/**
+ * Gives the buffer of the frame being read back to its pool, unless
+ * something was borrowed from it.
+ */
+func (p *TFramedTransport) releaseFrame() {
+	if p.frame != nil && !p.borrowed {
+		if class := frameBufferClass(cap(*p.frame)); class >= 0 && cap(*p.frame) == minFrameBuffer<<uint(class) {
+			frameBufferPools[class].Put(p.frame)
+		}
 	}
-	p.readBuffer = bytes.NewBuffer(buf2)
-	return size, nil
+	p.frame = nil
+	p.unread = nil
+	p.borrowed = false
 }
@@ -20,6 +20,7 @@
 package thrift
 
 import (
+	"bytes"
 	"testing"
 )
 
@@ -27,3 +28,88 @@ func TestFramedTransport(t *testing.T) {
 	trans := NewTFramedTransport(NewTMemoryBuffer())
 	TransportTest(t, trans, trans)
 }
+
+func TestFramedTransportFlushesOnce(t *testing.T) {
+	memory := NewTMemoryBuffer()
+	counter := &tCountingTransport{TTransport: memory}
+	trans := NewTFramedTransport(counter)
+
+	for i := 0; i < 3; i++ {
+		trans.Write(transport_bdata[:100])
+		trans.WriteString("a string")
+
+		if err := trans.Flush(); err != nil {
+			t.Fatalf("Cannot flush: %s", err)
+		}
+		if counter.writes != i+1 {
+			t.Errorf("Flush() %d made %d writes in all", i, counter.writes)
+		}
+		expected := append(append([]byte{0, 0, 0, 108}, transport_bdata[:100]...), "a string"...)
+		if !bytes.Equal(memory.Bytes(), expected) {
+			t.Fatalf("Flush() %d wrote %v instead of %v", i, memory.Bytes(), expected)
+		}
+		memory.Reset()
+	}
+}
+
+func TestFramedTransportMaxFrameSize(t *testing.T) {
+	memory := NewTMemoryBuffer()
+	NewTFramedTransport(memory).Write(make([]byte, 101))
+	NewTFramedTransport(memory).Flush()
+	trans := NewTFramedTransportMaxFrameSize(memory, 100)
+
+	if _, err := trans.Read(make([]byte, 1)); err == nil {
+		t.Fatalf("Read a frame of 101 bytes with a maximum of 100")
+	}
+}
+
+func TestFramedTransportSkipsEmptyFrames(t *testing.T) {
+	memory := NewTMemoryBuffer()
+	trans := NewTFramedTransport(memory)
+	trans.Flush()
+	trans.Write([]byte("after"))
+	trans.Flush()
+	buf := make([]byte, 5)
+
+	if _, err := trans.ReadAll(buf); err != nil || string(buf) != "after" {
+		t.Fatalf("Read %q (%v), not \"after\"", buf, err)
+	}
+}
+
+func TestFramedTransportAllocs(t *testing.T) {
+	trans := NewTFramedTransport(NewTMemoryBuffer())
+	buf := make([]byte, 3000)
+	var err error
+
+	if allocs := testing.AllocsPerRun(100, func() {
+		trans.Write(transport_bdata[:len(buf)])
+		trans.Flush()
+		_, err = trans.ReadAll(buf)
+	}); err != nil || allocs != 0 {
+		t.Fatalf("Writing and reading a frame made %v allocations (%v)", allocs, err)
+	}
+}
+
+func BenchmarkLoopbackFramed(b *testing.B) {
+	counter, closer := newLoopbackTransport(b)
+	defer closer()
+	p := NewTBinaryProtocolTransport(NewTFramedTransport(counter))
+	memory := NewTMemoryBuffer()
+	writeBinaryPrimitives(NewTBinaryProtocolTransport(memory))
+	b.SetBytes(int64(memory.Len()))
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		if err := writeBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+		if err := p.Flush(); err != nil {
+			b.Fatal(err)
+		}
+		if err := readBinaryPrimitives(p); err != nil {
+			b.Fatal(err)
+		}
+	}
+	b.ReportMetric(float64(counter.reads+counter.writes)/float64(b.N), "syscalls/op")
+}
@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"math"
+)
+
+/**
+ * The state generated Hash64() methods start from, and fold each field into
+ * with the functions below.  Words are mixed with a multiply-xorshift step
+ * and strings a byte at a time as FNV-1a does: fast and well spread, but
+ * not proof against keys chosen to collide.
+ */
+const HashSeed uint64 = 14695981039346656037
+
+const hashPrime uint64 = 1099511628211
+
+func HashUint64(h, v uint64) uint64 {
+	v ^= v >> 33
+	v *= 0xff51afd7ed558ccd
+	v ^= v >> 33
+	return (h ^ v) * hashPrime
+}
+
+func HashInt64(h uint64, v int64) uint64 {
+	return HashUint64(h, uint64(v))
+}
+
+func HashBool(h uint64, v bool) uint64 {
+	if v {
+		return HashUint64(h, 1)
+	}
+	return HashUint64(h, 0)
+}
+
+/**
+ * Hashes -0 as 0, since the two are equal.
+ */
+func HashDouble(h uint64, v float64) uint64 {
+	if v == 0 {
+		v = 0
+	}
+	return HashUint64(h, math.Float64bits(v))
+}
+
+/**
+ * Folds in the length as well as the bytes, so that adjacent strings hash
+ * differently however the same bytes are split between them.
+ */
+func HashString(h uint64, v string) uint64 {
+	for i := 0; i < len(v); i++ {
+		h = (h ^ uint64(v[i])) * hashPrime
+	}
+	return HashUint64(h, uint64(len(v)))
+}
+
+func HashBytes(h uint64, v []byte) uint64 {
+	for _, b := range v {
+		h = (h ^ uint64(b)) * hashPrime
+	}
+	return HashUint64(h, uint64(len(v)))
+}
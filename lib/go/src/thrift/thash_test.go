@@ -0,0 +1,78 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"math"
+	"testing"
+)
+
+func TestHashSeparatesValues(t *testing.T) {
+	hashes := map[uint64]string{}
+	add := func(name string, h uint64) {
+		if other, ok := hashes[h]; ok {
+			t.Errorf("%s hashes the same as %s", name, other)
+		}
+		hashes[h] = name
+	}
+	add("seed", HashSeed)
+	add("false", HashBool(HashSeed, false))
+	add("true", HashBool(HashSeed, true))
+	add("int64 2", HashInt64(HashSeed, 2))
+	add("int64 -1", HashInt64(HashSeed, -1))
+	add("int64 1<<40", HashInt64(HashSeed, 1<<40))
+	add("double 1.5", HashDouble(HashSeed, 1.5))
+	add("string \"a\"", HashString(HashSeed, "a"))
+	add("strings \"ab\", \"c\"", HashString(HashString(HashSeed, "ab"), "c"))
+	add("strings \"a\", \"bc\"", HashString(HashString(HashSeed, "a"), "bc"))
+	add("fields 1, 2", HashInt64(HashInt64(HashSeed, 1), 2))
+	add("fields 2, 1", HashInt64(HashInt64(HashSeed, 2), 1))
+}
+
+func TestHashAgreesWithEquality(t *testing.T) {
+	if HashDouble(HashSeed, math.Copysign(0, -1)) != HashDouble(HashSeed, 0) {
+		t.Errorf("-0 and 0 are equal but hash differently")
+	}
+	if HashBytes(HashSeed, []byte("value")) != HashString(HashSeed, "value") {
+		t.Errorf("HashBytes() and HashString() differ on the same bytes")
+	}
+	if allocs := testing.AllocsPerRun(100, func() { HashString(HashSeed, "value") }); allocs != 0 {
+		t.Errorf("HashString() made %v allocations", allocs)
+	}
+}
+
+func TestCompareBytes(t *testing.T) {
+	cases := []struct {
+		i, j []byte
+		want int
+	}{
+		{nil, nil, 0},
+		{nil, []byte{}, -1},
+		{[]byte{}, nil, 1},
+		{[]byte{}, []byte{}, 0},
+		{[]byte("a"), []byte("b"), -1},
+		{[]byte("b"), []byte("ab"), 1},
+	}
+	for _, c := range cases {
+		if got := CompareBytes(c.i, c.j); got != c.want {
+			t.Errorf("CompareBytes(%q, %q) => %d, want %d", c.i, c.j, got, c.want)
+		}
+	}
+}
@@ -21,6 +21,8 @@ package thrift
 
 import (
 	"bytes"
+	"errors"
+	"io"
 	"net/http"
 	"net/url"
 	"strconv"
@@ -32,17 +34,33 @@ type THttpClient struct {
 	requestBuffer      *bytes.Buffer
 	nsecConnectTimeout int64
 	nsecReadTimeout    int64
+
+	// Set for a client that streams its requests: the body of the request
+	// being sent, if one has been started, and where its response arrives
+	streaming     bool
+	requestWriter *io.PipeWriter
+	responses     chan tHttpResponse
+}
+
+type tHttpResponse struct {
+	response *http.Response
+	err      error
 }
 
 type THttpClientTransportFactory struct {
-	url    string
-	isPost bool
+	url         string
+	isPost      bool
+	isStreaming bool
 }
 
 func (p *THttpClientTransportFactory) GetTransport(trans TTransport) TTransport {
 	if trans != nil {
 		t, ok := trans.(*THttpClient)
 		if ok && t.url != nil {
+			if t.streaming {
+				t2, _ := NewTHttpStreamingPostClient(t.url.String())
+				return t2
+			}
 			if t.requestBuffer != nil {
 				t2, _ := NewTHttpPostClient(t.url.String())
 				return t2
@@ -51,6 +69,10 @@ func (p *THttpClientTransportFactory) GetTransport(trans TTransport) TTransport
 			return t2
 		}
 	}
+	if p.isStreaming {
+		s, _ := NewTHttpStreamingPostClient(p.url)
+		return s
+	}
 	if p.isPost {
 		s, _ := NewTHttpPostClient(p.url)
 		return s
@@ -67,6 +89,10 @@ func NewTHttpPostClientTransportFactory(url string) *THttpClientTransportFactory
 	return &THttpClientTransportFactory{url: url, isPost: true}
 }
 
+func NewTHttpStreamingPostClientTransportFactory(url string) *THttpClientTransportFactory {
+	return &THttpClientTransportFactory{url: url, isPost: true, isStreaming: true}
+}
+
 func NewTHttpClient(urlstr string) (TTransport, error) {
 	parsedURL, err := url.Parse(urlstr)
 	if err != nil {
@@ -88,13 +114,26 @@ func NewTHttpPostClient(urlstr string) (TTransport, error) {
 	return &THttpClient{url: parsedURL, requestBuffer: bytes.NewBuffer(buf)}, nil
 }
 
+/**
+ * Makes a client that sends each request as it is written, as the chunked
+ * body of a POST, rather than holding all of it until Flush().  Flush()
+ * then ends the request and waits for the response.
+ */
+func NewTHttpStreamingPostClient(urlstr string) (TTransport, error) {
+	parsedURL, err := url.Parse(urlstr)
+	if err != nil {
+		return nil, err
+	}
+	return &THttpClient{url: parsedURL, streaming: true, responses: make(chan tHttpResponse, 1)}, nil
+}
+
 func (p *THttpClient) Open() error {
 	// do nothing
 	return nil
 }
 
 func (p *THttpClient) IsOpen() bool {
-	return p.response != nil || p.requestBuffer != nil
+	return p.response != nil || p.requestBuffer != nil || p.streaming
 }
 
 func (p *THttpClient) Peek() bool {
@@ -102,6 +141,13 @@ func (p *THttpClient) Peek() bool {
 }
 
 func (p *THttpClient) Close() error {
+	if p.requestWriter != nil {
+		p.requestWriter.CloseWithError(errors.New("THttpClient closed"))
+		p.requestWriter = nil
+		if result := <-p.responses; result.response != nil {
+			result.response.Body.Close()
+		}
+	}
 	if p.response != nil && p.response.Body != nil {
 		err := p.response.Body.Close()
 		p.response = nil
@@ -127,12 +173,47 @@ func (p *THttpClient) ReadAll(buf []byte) (int, error) {
 }
 
 func (p *THttpClient) Write(buf []byte) (int, error) {
+	if p.streaming {
+		if p.requestWriter == nil {
+			p.startRequest()
+		}
+		n, err := p.requestWriter.Write(buf)
+		return n, NewTTransportExceptionFromOsError(err)
+	}
 	n, err := p.requestBuffer.Write(buf)
 	return n, err
 }
 
+/**
+ * Starts a POST whose body is whatever is written until the next Flush().
+ */
+func (p *THttpClient) startRequest() {
+	reader, writer := io.Pipe()
+	p.requestWriter = writer
+	url := p.url.String()
+	responses := p.responses
+	go func() {
+		response, err := http.Post(url, "application/x-thrift", reader)
+		// Fail any write still waiting on a request that has given up
+		reader.CloseWithError(err)
+		responses <- tHttpResponse{response, err}
+	}()
+}
+
 func (p *THttpClient) Flush() error {
-	response, err := http.Post(p.url.String(), "application/x-thrift", p.requestBuffer)
+	var response *http.Response
+	var err error
+	if p.streaming {
+		if p.requestWriter == nil {
+			p.startRequest()
+		}
+		p.requestWriter.Close()
+		p.requestWriter = nil
+		result := <-p.responses
+		response, err = result.response, result.err
+	} else {
+		response, err = http.Post(p.url.String(), "application/x-thrift", p.requestBuffer)
+	}
 	if err != nil {
 		return NewTTransportExceptionFromOsError(err)
 	}
@@ -20,7 +20,13 @@
 package thrift
 
 import (
+	"io"
+	"io/ioutil"
+	"net/http"
+	"net/http/httptest"
+	"strconv"
 	"testing"
+	"time"
 )
 
 func TestHttpClient(t *testing.T) {
@@ -35,3 +41,39 @@ func TestHttpClient(t *testing.T) {
 	}
 	TransportTest(t, trans, trans)
 }
+
+func TestHttpStreamingPostClient(t *testing.T) {
+	started := make(chan bool, 1)
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		first := make([]byte, 1)
+		io.ReadFull(r.Body, first)
+		started <- true
+		n, _ := io.Copy(ioutil.Discard, r.Body)
+		w.Write([]byte(strconv.FormatInt(n+1, 10)))
+	}))
+	defer server.Close()
+	trans, _ := NewTHttpStreamingPostClient(server.URL)
+	defer trans.Close()
+
+	for i := 0; i < 256; i++ {
+		if _, err := trans.Write(transport_bdata); err != nil {
+			t.Fatalf("Cannot write: %s", err)
+		}
+	}
+
+	select {
+	case <-started:
+	case <-time.After(5 * time.Second):
+		t.Fatalf("The server received nothing before Flush()")
+	}
+
+	if err := trans.Flush(); err != nil {
+		t.Fatalf("Cannot flush: %s", err)
+	}
+
+	reply, _ := ioutil.ReadAll(trans)
+
+	if expected := strconv.Itoa(256 * len(transport_bdata)); string(reply) != expected {
+		t.Fatalf("The server received %s bytes rather than %s", reply, expected)
+	}
+}
@@ -39,6 +39,7 @@ type TList interface {
 	Insert(i int, data interface{})
 	Delete(i int)
 	Less(i, j int) bool
+	ForEach(f func(elem interface{}) error) error
 	Iter() <-chan interface{}
 }
 
@@ -48,8 +49,8 @@ type tList struct {
 }
 
 func NewTList(t TType, s int) TList {
-	//this automatically grows using append so 0
-	v := make([]interface{}, 0)
+	//this automatically grows using append past the capacity hint
+	v := make([]interface{}, 0, ContainerCapacityHint(s))
 	return &tList{elemType: t, l: v}
 }
 
@@ -123,6 +124,19 @@ func (p *tList) Less(i, j int) bool {
 	return less
 }
 
+/**
+ * Calls f for each element in order, stopping at and returning the first
+ * error f returns.  Unlike Iter(), no goroutine or channel is involved.
+ */
+func (p *tList) ForEach(f func(elem interface{}) error) error {
+	for _, elem := range p.l {
+		if err := f(elem); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
 func (p *tList) Iter() <-chan interface{} {
 	c := make(chan interface{})
 	go p.iterate(c)
@@ -0,0 +1,209 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+/**
+ * Implemented by protocols that can read the elements of a list of fixed
+ * width numbers in bulk, rather than through one interface call and one
+ * transport read apiece.  Each reads size elements, once ReadListBegin() has
+ * given their number, and appends them to dst.
+ */
+type TListReader interface {
+	ReadByteList(dst []byte, size int) ([]byte, TProtocolException)
+	ReadI32List(dst []int32, size int) ([]int32, TProtocolException)
+	ReadI64List(dst []int64, size int) ([]int64, TProtocolException)
+	ReadDoubleList(dst []float64, size int) ([]float64, TProtocolException)
+}
+
+/**
+ * Implemented by protocols that can write the elements of a list of fixed
+ * width numbers in bulk, once WriteListBegin() has been called for them.
+ */
+type TListWriter interface {
+	WriteByteList(values []byte) TProtocolException
+	WriteI32List(values []int32) TProtocolException
+	WriteI64List(values []int64) TProtocolException
+	WriteDoubleList(values []float64) TProtocolException
+}
+
+/**
+ * Reads size bytes from prot, appending them to dst, in bulk if prot is a
+ * TListReader or else one at a time.  Code generated with
+ * "--gen go:native_containers" reads list<byte> fields through it.
+ */
+func ReadByteList(prot TProtocol, dst []byte, size int) ([]byte, TProtocolException) {
+	if reader, ok := prot.(TListReader); ok {
+		return reader.ReadByteList(dst, size)
+	}
+	for i := 0; i < size; i++ {
+		v, err := prot.ReadByte()
+		if err != nil {
+			return dst, err
+		}
+		dst = append(dst, v)
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size i32s from prot, appending them to dst; see ReadByteList().
+ */
+func ReadI32List(prot TProtocol, dst []int32, size int) ([]int32, TProtocolException) {
+	if reader, ok := prot.(TListReader); ok {
+		return reader.ReadI32List(dst, size)
+	}
+	for i := 0; i < size; i++ {
+		v, err := prot.ReadI32()
+		if err != nil {
+			return dst, err
+		}
+		dst = append(dst, v)
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size i64s from prot, appending them to dst; see ReadByteList().
+ */
+func ReadI64List(prot TProtocol, dst []int64, size int) ([]int64, TProtocolException) {
+	if reader, ok := prot.(TListReader); ok {
+		return reader.ReadI64List(dst, size)
+	}
+	for i := 0; i < size; i++ {
+		v, err := prot.ReadI64()
+		if err != nil {
+			return dst, err
+		}
+		dst = append(dst, v)
+	}
+	return dst, nil
+}
+
+/**
+ * Reads size doubles from prot, appending them to dst; see ReadByteList().
+ */
+func ReadDoubleList(prot TProtocol, dst []float64, size int) ([]float64, TProtocolException) {
+	if reader, ok := prot.(TListReader); ok {
+		return reader.ReadDoubleList(dst, size)
+	}
+	for i := 0; i < size; i++ {
+		v, err := prot.ReadDouble()
+		if err != nil {
+			return dst, err
+		}
+		dst = append(dst, v)
+	}
+	return dst, nil
+}
+
+/**
+ * Writes values to prot, in bulk if prot is a TListWriter or else one at a
+ * time.  Code generated with "--gen go:native_containers" writes list<byte>
+ * fields through it.
+ */
+func WriteByteList(prot TProtocol, values []byte) TProtocolException {
+	if writer, ok := prot.(TListWriter); ok {
+		return writer.WriteByteList(values)
+	}
+	for _, v := range values {
+		if err := prot.WriteByte(v); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+/**
+ * Writes values to prot; see WriteByteList().
+ */
+func WriteI32List(prot TProtocol, values []int32) TProtocolException {
+	if writer, ok := prot.(TListWriter); ok {
+		return writer.WriteI32List(values)
+	}
+	for _, v := range values {
+		if err := prot.WriteI32(v); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+/**
+ * Writes values to prot; see WriteByteList().
+ */
+func WriteI64List(prot TProtocol, values []int64) TProtocolException {
+	if writer, ok := prot.(TListWriter); ok {
+		return writer.WriteI64List(values)
+	}
+	for _, v := range values {
+		if err := prot.WriteI64(v); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+/**
+ * Writes values to prot; see WriteByteList().
+ */
+func WriteDoubleList(prot TProtocol, values []float64) TProtocolException {
+	if writer, ok := prot.(TListWriter); ok {
+		return writer.WriteDoubleList(values)
+	}
+	for _, v := range values {
+		if err := prot.WriteDouble(v); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+/**
+ * The most elements of a bulk list that are decoded from, or encoded into,
+ * a protocol's scratch buffer at once, so that a list of any length is read
+ * and written a buffer of this many bytes at a time.
+ */
+const listChunkBytes = maxStringScratch
+
+/**
+ * growI32s() and its siblings extend dst by n elements, returning it and the
+ * part added, which the caller fills in.  Growing it chunk by chunk as the
+ * elements arrive, rather than by the whole length up front, means a corrupt
+ * length cannot make it allocate more than was actually sent.
+ */
+func growI32s(dst []int32, n int) ([]int32, []int32) {
+	dst = append(dst, make([]int32, n)...)
+	return dst, dst[len(dst)-n:]
+}
+
+func growI64s(dst []int64, n int) ([]int64, []int64) {
+	dst = append(dst, make([]int64, n)...)
+	return dst, dst[len(dst)-n:]
+}
+
+func growDoubles(dst []float64, n int) ([]float64, []float64) {
+	dst = append(dst, make([]float64, n)...)
+	return dst, dst[len(dst)-n:]
+}
+
+func growBytes(dst []byte, n int) ([]byte, []byte) {
+	dst = append(dst, make([]byte, n)...)
+	return dst, dst[len(dst)-n:]
+}
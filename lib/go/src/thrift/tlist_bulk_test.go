@@ -0,0 +1,269 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"bytes"
+	"math"
+	"reflect"
+	"testing"
+)
+
+var (
+	listBulkI32s    = make([]int32, 3000)
+	listBulkI64s    = make([]int64, 1500)
+	listBulkDoubles = make([]float64, 1500)
+	listBulkBytes   = make([]byte, 10000)
+)
+
+func init() {
+	for i := range listBulkI32s {
+		listBulkI32s[i] = int32(i*i*7919) - math.MaxInt32/2
+	}
+	for i := range listBulkI64s {
+		listBulkI64s[i] = int64(i*i*i*7919) - math.MaxInt64/2
+	}
+	for i := range listBulkDoubles {
+		listBulkDoubles[i] = float64(i) * -math.Pi
+	}
+	for i := range listBulkBytes {
+		listBulkBytes[i] = byte(i * 31)
+	}
+}
+
+/**
+ * Hides every method but those of TTransport, such as the ReadByte() of a
+ * TMemoryBuffer.
+ */
+type plainTransport struct {
+	TTransport
+}
+
+func writeListsPerElement(p TProtocol) {
+	for _, v := range listBulkBytes {
+		p.WriteByte(v)
+	}
+	for _, v := range listBulkI32s {
+		p.WriteI32(v)
+	}
+	for _, v := range listBulkI64s {
+		p.WriteI64(v)
+	}
+	for _, v := range listBulkDoubles {
+		p.WriteDouble(v)
+	}
+}
+
+func writeListsBulk(p TProtocol) {
+	WriteByteList(p, listBulkBytes)
+	WriteI32List(p, listBulkI32s)
+	WriteI64List(p, listBulkI64s)
+	WriteDoubleList(p, listBulkDoubles)
+}
+
+/**
+ * Checks that writing lists in bulk with the protocol made by newProtocol
+ * puts the same bytes on the wire as writing their elements one at a time,
+ * and that they read back in bulk, appended to what is already there.
+ */
+func checkListBulk(t *testing.T, newProtocol func(TTransport) TProtocol, wrap func(TTransport) TTransport) {
+	perElement := NewTMemoryBuffer()
+	writeListsPerElement(newProtocol(perElement))
+	bulk := NewTMemoryBuffer()
+	p := newProtocol(wrap(bulk))
+	writeListsBulk(p)
+
+	if !bytes.Equal(perElement.Bytes(), bulk.Bytes()) {
+		t.Fatalf("Wrote %d bytes in bulk, not the %d written one at a time", bulk.Len(), perElement.Len())
+	}
+
+	bs, err := ReadByteList(p, []byte{42}, len(listBulkBytes))
+	if err != nil || bs[0] != 42 || !bytes.Equal(bs[1:], listBulkBytes) {
+		t.Fatalf("Read bytes back wrongly (%v)", err)
+	}
+	i32s, err := ReadI32List(p, []int32{42}, len(listBulkI32s))
+	if err != nil || i32s[0] != 42 || !reflect.DeepEqual(i32s[1:], listBulkI32s) {
+		t.Fatalf("Read i32s back wrongly (%v)", err)
+	}
+	i64s, err := ReadI64List(p, []int64{42}, len(listBulkI64s))
+	if err != nil || i64s[0] != 42 || !reflect.DeepEqual(i64s[1:], listBulkI64s) {
+		t.Fatalf("Read i64s back wrongly (%v)", err)
+	}
+	doubles, err := ReadDoubleList(p, []float64{42}, len(listBulkDoubles))
+	if err != nil || doubles[0] != 42 || !reflect.DeepEqual(doubles[1:], listBulkDoubles) {
+		t.Fatalf("Read doubles back wrongly (%v)", err)
+	}
+	if bulk.Len() != 0 {
+		t.Fatalf("Left %d bytes unread", bulk.Len())
+	}
+}
+
+func sameTransport(trans TTransport) TTransport {
+	return trans
+}
+
+func plainTransportOf(trans TTransport) TTransport {
+	return plainTransport{trans}
+}
+
+func TestBinaryProtocolListBulk(t *testing.T) {
+	newProtocol := func(trans TTransport) TProtocol { return NewTBinaryProtocolTransport(trans) }
+	checkListBulk(t, newProtocol, sameTransport)
+}
+
+func TestCompactProtocolListBulk(t *testing.T) {
+	newProtocol := func(trans TTransport) TProtocol { return NewTCompactProtocol(trans) }
+	checkListBulk(t, newProtocol, sameTransport)
+	checkListBulk(t, newProtocol, plainTransportOf)
+}
+
+func TestListBulkFallsBackToElements(t *testing.T) {
+	buffer := NewTMemoryBuffer()
+	p := NewTJSONProtocol(buffer)
+
+	if _, ok := TProtocol(p).(TListReader); ok {
+		t.Fatalf("TJSONProtocol is a TListReader, so cannot test the fallback")
+	}
+
+	p.WriteListBegin(I64, len(listBulkI64s))
+	WriteI64List(p, listBulkI64s)
+	p.WriteListEnd()
+	p.Flush()
+	_, size, err := p.ReadListBegin()
+
+	if err != nil || size != len(listBulkI64s) {
+		t.Fatalf("Read a list of %d (%v), not %d", size, err, len(listBulkI64s))
+	}
+
+	i64s, err := ReadI64List(p, nil, size)
+
+	if err != nil || !reflect.DeepEqual(i64s, listBulkI64s) {
+		t.Fatalf("Read i64s back wrongly (%v)", err)
+	}
+}
+
+func TestBinaryProtocolListBulkTruncated(t *testing.T) {
+	buffer := NewTMemoryBuffer()
+	WriteI64List(NewTBinaryProtocolTransport(buffer), listBulkI64s)
+	truncated := NewTMemoryBuffer()
+	truncated.Write(buffer.Bytes()[:buffer.Len()-1])
+
+	if _, err := ReadI64List(NewTBinaryProtocolTransport(truncated), nil, len(listBulkI64s)); err == nil {
+		t.Fatalf("Read %d i64s from too few bytes", len(listBulkI64s))
+	}
+}
+
+/**
+ * The length of the lists benchmarked, as sent by feature vector RPCs.
+ */
+const benchmarkListLength = 1 << 20
+
+func benchmarkReadI64List(b *testing.B, newProtocol func(TTransport) TProtocol, bulk bool) {
+	values := make([]int64, benchmarkListLength)
+	for i := range values {
+		values[i] = int64(i) << 20
+	}
+	buffer := NewTMemoryBuffer()
+	p := newProtocol(buffer)
+	WriteI64List(p, values)
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(values) * 8))
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		buffer.Reset()
+		buffer.Write(wire)
+		values = values[:0]
+		b.StartTimer()
+
+		if bulk {
+			values, _ = ReadI64List(p, values, benchmarkListLength)
+		} else {
+			for j := 0; j < benchmarkListLength; j++ {
+				v, _ := p.ReadI64()
+				values = append(values, v)
+			}
+		}
+	}
+}
+
+func benchmarkWriteI64List(b *testing.B, newProtocol func(TTransport) TProtocol, bulk bool) {
+	values := make([]int64, benchmarkListLength)
+	for i := range values {
+		values[i] = int64(i) << 20
+	}
+	buffer := NewTMemoryBufferLen(len(values) * 10)
+	p := newProtocol(buffer)
+	b.SetBytes(int64(len(values) * 8))
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+
+		if bulk {
+			WriteI64List(p, values)
+		} else {
+			for _, v := range values {
+				p.WriteI64(v)
+			}
+		}
+	}
+}
+
+func newBinaryProtocolForBenchmark(trans TTransport) TProtocol {
+	return NewTBinaryProtocolTransport(trans)
+}
+
+func newCompactProtocolForBenchmark(trans TTransport) TProtocol {
+	return NewTCompactProtocol(trans)
+}
+
+func BenchmarkBinaryReadI64ListPerElement(b *testing.B) {
+	benchmarkReadI64List(b, newBinaryProtocolForBenchmark, false)
+}
+
+func BenchmarkBinaryReadI64ListBulk(b *testing.B) {
+	benchmarkReadI64List(b, newBinaryProtocolForBenchmark, true)
+}
+
+func BenchmarkBinaryWriteI64ListPerElement(b *testing.B) {
+	benchmarkWriteI64List(b, newBinaryProtocolForBenchmark, false)
+}
+
+func BenchmarkBinaryWriteI64ListBulk(b *testing.B) {
+	benchmarkWriteI64List(b, newBinaryProtocolForBenchmark, true)
+}
+
+func BenchmarkCompactReadI64ListPerElement(b *testing.B) {
+	benchmarkReadI64List(b, newCompactProtocolForBenchmark, false)
+}
+
+func BenchmarkCompactReadI64ListBulk(b *testing.B) {
+	benchmarkReadI64List(b, newCompactProtocolForBenchmark, true)
+}
+
+func BenchmarkCompactWriteI64ListPerElement(b *testing.B) {
+	benchmarkWriteI64List(b, newCompactProtocolForBenchmark, false)
+}
+
+func BenchmarkCompactWriteI64ListBulk(b *testing.B) {
+	benchmarkWriteI64List(b, newCompactProtocolForBenchmark, true)
+}
@@ -0,0 +1,124 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"errors"
+	"testing"
+)
+
+const benchmarkListSize = 10000
+
+func TestListForEach(t *testing.T) {
+	tl := NewTList(I32, 3)
+	tl.Push(int32(1))
+	tl.Push(int32(2))
+	tl.Push(int32(3))
+	sum := int32(0)
+	if err := tl.ForEach(func(elem interface{}) error {
+		sum += elem.(int32)
+		return nil
+	}); err != nil {
+		t.Errorf("Expected no error, but was %v", err)
+	}
+	if sum != 6 {
+		t.Errorf("Expected sum of 6, but was %d", sum)
+	}
+	stop := errors.New("stop")
+	n := 0
+	if err := tl.ForEach(func(elem interface{}) error {
+		n++
+		if elem.(int32) == 2 {
+			return stop
+		}
+		return nil
+	}); err != stop {
+		t.Errorf("Expected ForEach to return the callback error, but was %v", err)
+	}
+	if n != 2 {
+		t.Errorf("Expected iteration to stop after 2 elements, but visited %d", n)
+	}
+}
+
+func newBenchmarkList() TList {
+	tl := NewTList(I64, benchmarkListSize)
+	for i := 0; i < benchmarkListSize; i++ {
+		tl.Push(int64(i))
+	}
+	return tl
+}
+
+/**
+ * Mirrors the list serialization loop the generator used to emit.
+ */
+func writeListWithIter(oprot TProtocol, tl TList) TProtocolException {
+	err := oprot.WriteListBegin(tl.ElemType(), tl.Len())
+	if err != nil {
+		return err
+	}
+	for Iter1 := range tl.Iter() {
+		Iter2 := Iter1.(int64)
+		err = oprot.WriteI64(Iter2)
+		if err != nil {
+			return err
+		}
+	}
+	return oprot.WriteListEnd()
+}
+
+/**
+ * Mirrors the list serialization loop the generator emits now.
+ */
+func writeListWithAt(oprot TProtocol, tl TList) TProtocolException {
+	err := oprot.WriteListBegin(tl.ElemType(), tl.Len())
+	if err != nil {
+		return err
+	}
+	for Iter1 := 0; Iter1 < tl.Len(); Iter1++ {
+		Iter2 := tl.At(Iter1).(int64)
+		err = oprot.WriteI64(Iter2)
+		if err != nil {
+			return err
+		}
+	}
+	return oprot.WriteListEnd()
+}
+
+func benchmarkListWrite(b *testing.B, write func(TProtocol, TList) TProtocolException) {
+	b.StopTimer()
+	tl := newBenchmarkList()
+	buffer := NewTMemoryBuffer()
+	oprot := NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	b.StartTimer()
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		if err := write(oprot, tl); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkListWriteIter10k(b *testing.B) {
+	benchmarkListWrite(b, writeListWithIter)
+}
+
+func BenchmarkListWriteAt10k(b *testing.B) {
+	benchmarkListWrite(b, writeListWithAt)
+}
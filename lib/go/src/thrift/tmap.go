@@ -36,6 +36,7 @@ type TMap interface {
 	Set(key, value interface{})
 	Get(key interface{}) (interface{}, bool)
 	Contains(key interface{}) bool
+	ForEach(f func(key, value interface{}) error) error
 	Iter() <-chan TMapElem
 	KeyIter() <-chan interface{}
 	ValueIter() <-chan interface{}
@@ -55,6 +56,7 @@ type tMap struct {
 	keyType   TType
 	valueType TType
 	size      int
+	capacity  int
 	l         *list.List
 	b         map[bool]interface{}
 	i08       map[byte]interface{}
@@ -83,7 +85,7 @@ func NewTMapElem(k, v interface{}) TMapElem {
 }
 
 func NewTMap(k, v TType, s int) TMap {
-	return &tMap{keyType: k, valueType: v, size: s, l: list.New()}
+	return &tMap{keyType: k, valueType: v, size: s, capacity: ContainerCapacityHint(s), l: list.New()}
 }
 
 func NewTMapDefault() TMap {
@@ -352,43 +354,43 @@ func (p *tMap) Set(key, value interface{}) {
 		return
 	case BOOL:
 		if p.b == nil {
-			p.b = make(map[bool]interface{})
+			p.b = make(map[bool]interface{}, p.capacity)
 		}
 		b := coercedKey.(bool)
 		p.b[b] = value
 	case BYTE:
 		if p.i08 == nil {
-			p.i08 = make(map[byte]interface{})
+			p.i08 = make(map[byte]interface{}, p.capacity)
 		}
 		b := coercedKey.(byte)
 		p.i08[b] = value
 	case DOUBLE:
 		if p.f64 == nil {
-			p.f64 = make(map[float64]interface{})
+			p.f64 = make(map[float64]interface{}, p.capacity)
 		}
 		b := coercedKey.(float64)
 		p.f64[b] = value
 	case I16:
 		if p.i16 == nil {
-			p.i16 = make(map[int16]interface{})
+			p.i16 = make(map[int16]interface{}, p.capacity)
 		}
 		b := coercedKey.(int16)
 		p.i16[b] = value
 	case I32:
 		if p.i32 == nil {
-			p.i32 = make(map[int32]interface{})
+			p.i32 = make(map[int32]interface{}, p.capacity)
 		}
 		b := coercedKey.(int32)
 		p.i32[b] = value
 	case I64:
 		if p.i64 == nil {
-			p.i64 = make(map[int64]interface{})
+			p.i64 = make(map[int64]interface{}, p.capacity)
 		}
 		b := coercedKey.(int64)
 		p.i64[b] = value
 	case STRING, UTF8, UTF16:
 		if p.s == nil {
-			p.s = make(map[string]interface{})
+			p.s = make(map[string]interface{}, p.capacity)
 		}
 		b := coercedKey.(string)
 		p.s[b] = value
@@ -564,54 +566,75 @@ func (p *tMap) Contains(key interface{}) bool {
 	return false
 }
 
-// Iterate over all elements; driver for range
-func (p *tMap) iterate(c chan<- TMapElem) {
+/**
+ * Calls f for each key/value pair, stopping at and returning the first error
+ * f returns.  Unlike Iter(), no goroutine or channel is involved.
+ */
+func (p *tMap) ForEach(f func(key, value interface{}) error) error {
 	switch p.KeyType() {
 	case STOP, VOID:
-		close(c)
 	case BOOL:
 		for k, v := range p.b {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case BYTE:
 		for k, v := range p.i08 {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case I16:
 		for k, v := range p.i16 {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case I32:
 		for k, v := range p.i32 {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case I64:
 		for k, v := range p.i64 {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case DOUBLE:
 		for k, v := range p.f64 {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case STRING, UTF8, UTF16:
 		for k, v := range p.s {
-			c <- NewTMapElem(k, v)
+			if err := f(k, v); err != nil {
+				return err
+			}
 		}
-		close(c)
 	case BINARY, STRUCT, LIST, SET:
 		for v := p.l.Front(); v != nil; v = v.Next() {
-			c <- v.Value.(TMapElem)
+			elem := v.Value.(TMapElem)
+			if err := f(elem.Key(), elem.Value()); err != nil {
+				return err
+			}
 		}
-		close(c)
 	default:
 		panic("Invalid Thrift type")
 	}
+	return nil
+}
+
+// Iterate over all elements; driver for range
+func (p *tMap) iterate(c chan<- TMapElem) {
+	p.ForEach(func(key, value interface{}) error {
+		c <- NewTMapElem(key, value)
+		return nil
+	})
+	close(c)
 }
 
 // Channel iterator for range.
@@ -623,52 +646,11 @@ func (p *tMap) Iter() <-chan TMapElem {
 
 // Iterate over all keys; driver for range
 func (p *tMap) iterateKeys(c chan<- interface{}) {
-	switch p.KeyType() {
-	case STOP, VOID:
-		close(c)
-	case BOOL:
-		for k, _ := range p.b {
-			c <- k
-		}
-		close(c)
-	case BYTE:
-		for k, _ := range p.i08 {
-			c <- k
-		}
-		close(c)
-	case I16:
-		for k, _ := range p.i16 {
-			c <- k
-		}
-		close(c)
-	case I32:
-		for k, _ := range p.i32 {
-			c <- k
-		}
-		close(c)
-	case I64:
-		for k, _ := range p.i64 {
-			c <- k
-		}
-		close(c)
-	case DOUBLE:
-		for k, _ := range p.f64 {
-			c <- k
-		}
-		close(c)
-	case STRING, UTF8, UTF16:
-		for k, _ := range p.s {
-			c <- k
-		}
-		close(c)
-	case BINARY, STRUCT, LIST, SET:
-		for v := p.l.Front(); v != nil; v = v.Next() {
-			c <- v.Value.(TMapElem).Key()
-		}
-		close(c)
-	default:
-		panic("Invalid Thrift type")
-	}
+	p.ForEach(func(key, value interface{}) error {
+		c <- key
+		return nil
+	})
+	close(c)
 }
 
 func (p *tMap) KeyIter() <-chan interface{} {
@@ -679,52 +661,11 @@ func (p *tMap) KeyIter() <-chan interface{} {
 
 // Iterate over all values; driver for range
 func (p *tMap) iterateValues(c chan<- interface{}) {
-	switch p.KeyType() {
-	case STOP, VOID:
-		close(c)
-	case BOOL:
-		for _, v := range p.b {
-			c <- v
-		}
-		close(c)
-	case BYTE:
-		for _, v := range p.i08 {
-			c <- v
-		}
-		close(c)
-	case I16:
-		for _, v := range p.i16 {
-			c <- v
-		}
-		close(c)
-	case I32:
-		for _, v := range p.i32 {
-			c <- v
-		}
-		close(c)
-	case I64:
-		for _, v := range p.i64 {
-			c <- v
-		}
-		close(c)
-	case DOUBLE:
-		for _, v := range p.f64 {
-			c <- v
-		}
-		close(c)
-	case STRING, UTF8, UTF16:
-		for _, v := range p.s {
-			c <- v
-		}
-		close(c)
-	case BINARY, STRUCT, LIST, SET:
-		for v := p.l.Front(); v != nil; v = v.Next() {
-			c <- v.Value.(TMapElem).Value()
-		}
-		close(c)
-	default:
-		panic("Invalid Thrift type")
-	}
+	p.ForEach(func(key, value interface{}) error {
+		c <- value
+		return nil
+	})
+	close(c)
 }
 
 func (p *tMap) ValueIter() <-chan interface{} {
@@ -751,10 +692,11 @@ func (p *tMap) Keys() []interface{} {
 	size := p.Len()
 	values := make([]interface{}, size, size)
 	i := 0
-	for k := range p.KeyIter() {
-		values[i] = k
+	p.ForEach(func(key, value interface{}) error {
+		values[i] = key
 		i++
-	}
+		return nil
+	})
 	return values
 }
 
@@ -762,9 +704,10 @@ func (p *tMap) Values() []interface{} {
 	size := p.Len()
 	values := make([]interface{}, size, size)
 	i := 0
-	for v := range p.ValueIter() {
-		values[i] = v
+	p.ForEach(func(key, value interface{}) error {
+		values[i] = value
 		i++
-	}
+		return nil
+	})
 	return values
 }
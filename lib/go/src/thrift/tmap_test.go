@@ -75,3 +75,22 @@ func TestMapSetBinary(t *testing.T) {
 		t.Errorf("Expected key of []byte(\"c\") => false, false, but was %v, %v", v, found)
 	}
 }
+
+func TestMapForEach(t *testing.T) {
+	tm := NewTMap(BINARY, I32, 2)
+	tm.Set([]byte("a"), int32(1))
+	tm.Set([]byte("b"), int32(2))
+	seen := make(map[string]int32)
+	if err := tm.ForEach(func(key, value interface{}) error {
+		seen[string(key.([]byte))] = value.(int32)
+		return nil
+	}); err != nil {
+		t.Errorf("Expected no error, but was %v", err)
+	}
+	if len(seen) != 2 || seen["a"] != 1 || seen["b"] != 2 {
+		t.Errorf("Expected map[a:1 b:2], but was %v", seen)
+	}
+	if keys := tm.Keys(); len(keys) != 2 {
+		t.Errorf("Expected 2 keys, but was %v", keys)
+	}
+}
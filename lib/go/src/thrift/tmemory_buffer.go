@@ -89,6 +89,17 @@ func (p *TMemoryBuffer) ReadByte() (byte, error) {
 	return p.buf.ReadByte()
 }
 
+/**
+ * Hands out the next n bytes in place; see TBorrower.  They are only valid
+ * until the buffer is next written to or reset.
+ */
+func (p *TMemoryBuffer) Borrow(n int) ([]byte, bool) {
+	if p.buf.Len() < n {
+		return nil, false
+	}
+	return p.buf.Next(n), true
+}
+
 func (p *TMemoryBuffer) ReadFrom(r io.Reader) (int64, error) {
 	return p.buf.ReadFrom(r)
 }
@@ -105,6 +116,13 @@ func (p *TMemoryBuffer) WriteTo(w io.Writer) (int64, error) {
 	return p.buf.WriteTo(w)
 }
 
+/**
+ * Makes room for another n bytes to be written without reallocating.
+ */
+func (p *TMemoryBuffer) Grow(n int) {
+	p.buf.Grow(n)
+}
+
 func (p *TMemoryBuffer) Flush() error {
 	return nil
 }
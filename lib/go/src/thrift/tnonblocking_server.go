@@ -42,6 +42,8 @@ type TNonblockingServer struct {
 	outputTransportFactory TTransportFactory
 	inputProtocolFactory   TProtocolFactory
 	outputProtocolFactory  TProtocolFactory
+
+	maxConcurrentRequests int
 }
 
 func NewTNonblockingServer2(processor TProcessor, serverTransport TServerTransport) *TNonblockingServer {
@@ -120,6 +122,15 @@ func (p *TNonblockingServer) OutputProtocolFactory() TProtocolFactory {
 	return p.outputProtocolFactory
 }
 
+/**
+ * Serves up to n calls from each connection at once, replying to each as it
+ * finishes; see ProcessConcurrently().  The default of 1 serves the calls of
+ * a connection one at a time, in order.
+ */
+func (p *TNonblockingServer) SetMaxConcurrentRequests(n int) {
+	p.maxConcurrentRequests = n
+}
+
 func (p *TNonblockingServer) Serve() error {
 	p.stopped = false
 	err := p.serverTransport.Listen()
@@ -160,6 +171,10 @@ func (p *TNonblockingServer) processRequest(client TTransport) {
 	if outputTransport != nil {
 		defer outputTransport.Close()
 	}
+	if p.maxConcurrentRequests > 1 {
+		ProcessConcurrently(processor, inputProtocol, outputProtocol, p.outputProtocolFactory, p.maxConcurrentRequests)
+		return
+	}
 	for {
 		ok, e := processor.Process(inputProtocol, outputProtocol)
 		if e != nil {
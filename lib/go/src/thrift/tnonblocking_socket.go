@@ -20,6 +20,7 @@
 package thrift
 
 import (
+	"errors"
 	"net"
 	"time"
 )
@@ -154,6 +155,18 @@ func (p *TNonblockingSocket) Write(buf []byte) (int, error) {
 	return p.conn.Write(buf)
 }
 
+/**
+ * Sends bufs with one vectored write on the connection.
+ */
+func (p *TNonblockingSocket) WriteBuffers(bufs *net.Buffers) (int64, error) {
+	if !p.IsOpen() {
+		return 0, NewTTransportException(NOT_OPEN, "Connection not open")
+	}
+	p.pushDeadline(false, true)
+	n, err := bufs.WriteTo(p.conn)
+	return n, NewTTransportExceptionFromOsError(err)
+}
+
 /**
  * Flushes the underlying output stream if not null.
  */
@@ -184,7 +197,7 @@ func (p *TNonblockingSocket) Peek() bool {
  */
 func (p *TNonblockingSocket) Close() error {
 	if p.conn != nil {
-		if err := p.conn.Close(); err != nil {
+		if err := p.conn.Close(); err != nil && !errors.Is(err, net.ErrClosed) {
 			LOGGER.Print("Could not close socket.", err.Error())
 			return err
 		}
@@ -197,6 +210,7 @@ func (p *TNonblockingSocket) Interrupt() error {
 	if !p.IsOpen() {
 		return nil
 	}
-	// TODO(pomack) fix Interrupt as it is probably not right
-	return p.Close()
+	// Leaves p.conn in place, since a Read() or Write() blocked in another
+	// goroutine is still using it; Close() releases the socket afterwards.
+	return p.conn.Close()
 }
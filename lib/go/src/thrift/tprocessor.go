@@ -19,6 +19,10 @@
 
 package thrift
 
+import (
+	"sync"
+)
+
 /**
  * A processor is a generic object which operates upon an input stream and
  * writes to some output stream.
@@ -31,3 +35,55 @@ type TProcessor interface {
 type TProcessorFunction interface {
 	Process(seqId int32, in, out TProtocol) (bool, TException)
 }
+
+/**
+ * Implemented by generated processors, which dispatch each call to the
+ * TProcessorFunction registered under its method name.
+ */
+type TProcessorFunctionMap interface {
+	GetProcessorFunction(key string) (TProcessorFunction, bool)
+}
+
+/**
+ * A TProcessorFunction whose call may be read off the wire apart from running
+ * it, so that the handler can run while the next call is being read; see
+ * ProcessConcurrently().
+ *
+ * ReadArgs() reads the arguments and the end of the message.  ProcessArgs()
+ * runs the handler with them and writes the reply, if any, to out.
+ * IsOneway() reports whether the call is oneway, so that no reply is
+ * expected of it even should it not be run.
+ */
+type TSplitProcessorFunction interface {
+	TProcessorFunction
+	ReadArgs(in TProtocol) (interface{}, TProtocolException)
+	ProcessArgs(seqId int32, args interface{}, out TProtocol) (bool, TException)
+	IsOneway() bool
+}
+
+/**
+ * Implemented by handlers that keep a reference to any of their arguments,
+ * or to any container within one, after they return.  Generated processors
+ * otherwise reset and reuse the structs they read arguments into, so that
+ * a later call may overwrite the containers an earlier one was passed.
+ */
+type TArgsRetainer interface {
+	RetainsArgs() bool
+}
+
+/**
+ * Whether the generated processor for handler may reuse the structs it
+ * reads arguments into; see TArgsRetainer.
+ */
+func PoolsArgs(handler interface{}) bool {
+	retainer, ok := handler.(TArgsRetainer)
+	return !ok || !retainer.RetainsArgs()
+}
+
+/**
+ * A pool of the structs made by newStruct, through which generated
+ * processors reuse their Args and Result structs.
+ */
+func NewTStructPool(newStruct func() interface{}) *sync.Pool {
+	return &sync.Pool{New: newStruct}
+}
@@ -76,6 +76,28 @@ type TProtocol interface {
 	Transport() TTransport
 }
 
+/**
+ * Implemented by protocols that can read a message's name without
+ * allocating a string for it.  The name returned is only valid until the
+ * next read from the protocol.
+ */
+type TMessageNameReader interface {
+	ReadMessageBeginBytes() (name []byte, typeId TMessageType, seqid int32, err TProtocolException)
+}
+
+/**
+ * Reads a message header as ReadMessageBegin() does, returning the name as
+ * bytes that are only valid until the next read from prot.  Generated
+ * processors use it to look up the method called without allocating.
+ */
+func ReadMessageBeginBytes(prot TProtocol) (name []byte, typeId TMessageType, seqid int32, err TProtocolException) {
+	if reader, ok := prot.(TMessageNameReader); ok {
+		return reader.ReadMessageBeginBytes()
+	}
+	s, typeId, seqid, err := prot.ReadMessageBegin()
+	return []byte(s), typeId, seqid, err
+}
+
 /**
  * The maximum recursive depth the skip() function will traverse before
  * throwing a TException.
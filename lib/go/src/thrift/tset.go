@@ -22,12 +22,19 @@ package thrift
 import (
 	"bytes"
 	"container/list"
+	"sort"
 )
 
 /**
  * Helper class that encapsulates set metadata.
  *
  * Note that sets of structs requires pointers, not struct values.
+ *
+ * Base type and enum elements are tracked in typed hash maps, so Add,
+ * Contains and Remove take constant time for them; structs and containers
+ * are still matched by a linear scan.  Front(), Back() and Values() iterate
+ * in insertion order, or, for sets made with NewTSetOrdered(), in the order
+ * given by TType.Less.
  */
 type TSet interface {
 	TContainer
@@ -43,11 +50,30 @@ type TSet interface {
 type tSet struct {
 	elemType TType
 	size     int
+	capacity int
+	ordered  bool
+	sorted   bool
 	l        *list.List
+	b        map[bool]*list.Element
+	i08      map[byte]*list.Element
+	i16      map[int16]*list.Element
+	i32      map[int32]*list.Element
+	i64      map[int64]*list.Element
+	f64      map[float64]*list.Element
+	s        map[string]*list.Element
 }
 
 func NewTSet(t TType, s int) TSet {
-	return &tSet{elemType: t, size: s, l: list.New()}
+	return &tSet{elemType: t, size: s, capacity: ContainerCapacityHint(s), l: list.New()}
+}
+
+/**
+ * Creates a set whose iteration order follows TType.Less rather than the
+ * order in which elements were added.  The ordering is applied lazily, the
+ * first time the set is iterated after being modified.
+ */
+func NewTSetOrdered(t TType, s int) TSet {
+	return &tSet{elemType: t, size: s, capacity: ContainerCapacityHint(s), ordered: true, l: list.New()}
 }
 
 func NewTSetDefault() TSet {
@@ -59,18 +85,17 @@ func (p *tSet) ElemType() TType {
 }
 
 func (p *tSet) Front() *list.Element {
+	p.sort()
 	return p.l.Front()
 }
 
 func (p *tSet) Back() *list.Element {
+	p.sort()
 	return p.l.Back()
 }
 
 func (p *tSet) Len() int {
-	if p.l.Len() != 0 {
-		return p.l.Len()
-	}
-	return p.size
+	return p.l.Len()
 }
 
 func (p *tSet) Contains(data interface{}) bool {
@@ -78,25 +103,18 @@ func (p *tSet) Contains(data interface{}) bool {
 }
 
 func (p *tSet) Add(other interface{}) {
-	if data, ok := p.elemType.CoerceData(other); ok {
-		if p.l.Front() == nil {
-			p.l.PushFront(data)
-		} else {
-			for elem := p.l.Front(); elem != nil; elem = elem.Next() {
-				if cmp, ok := p.elemType.Compare(data, elem.Value); ok && cmp >= 0 {
-					if cmp > 0 {
-						p.l.InsertBefore(data, elem)
-					}
-					return
-				}
-			}
-		}
+	data, ok := p.elemType.CoerceData(other)
+	if !ok || p.lookup(data) != nil {
+		return
 	}
+	p.index(data, p.l.PushBack(data))
+	p.sorted = false
 }
 
 func (p *tSet) Remove(data interface{}) {
 	elem := p.find(data)
 	if elem != nil {
+		p.unindex(elem.Value)
 		p.l.Remove(elem)
 	}
 }
@@ -115,7 +133,135 @@ func (p *tSet) CompareTo(other interface{}) (int, bool) {
 	return TType(SET).Compare(p, other)
 }
 
+func (p *tSet) Values() []interface{} {
+	p.sort()
+	size := p.l.Len()
+	values := make([]interface{}, size, size)
+	i := 0
+	for v := p.l.Front(); v != nil; v = v.Next() {
+		values[i] = v.Value
+		i++
+	}
+	return values
+}
+
 func (p *tSet) find(data interface{}) *list.Element {
+	if data == nil && !p.hashed() {
+		return p.scan(nil)
+	}
+	data, ok := p.elemType.CoerceData(data)
+	if !ok {
+		return nil
+	}
+	return p.lookup(data)
+}
+
+/**
+ * Returns true if elements of this set are kept in the typed hash maps.
+ */
+func (p *tSet) hashed() bool {
+	switch p.elemType {
+	case BOOL, BYTE, I16, I32, I64, DOUBLE, STRING, UTF8, UTF16, BINARY:
+		return true
+	}
+	return false
+}
+
+/**
+ * Finds the list element holding an already coerced value.
+ */
+func (p *tSet) lookup(data interface{}) *list.Element {
+	switch p.elemType {
+	case BOOL:
+		return p.b[data.(bool)]
+	case BYTE:
+		return p.i08[data.(byte)]
+	case I16:
+		return p.i16[data.(int16)]
+	case I32:
+		return p.i32[data.(int32)]
+	case I64:
+		return p.i64[data.(int64)]
+	case DOUBLE:
+		return p.f64[data.(float64)]
+	case STRING, UTF8, UTF16:
+		return p.s[data.(string)]
+	case BINARY:
+		return p.s[string(data.([]byte))]
+	}
+	return p.scan(data)
+}
+
+func (p *tSet) index(data interface{}, elem *list.Element) {
+	switch p.elemType {
+	case BOOL:
+		if p.b == nil {
+			p.b = make(map[bool]*list.Element, 2)
+		}
+		p.b[data.(bool)] = elem
+	case BYTE:
+		if p.i08 == nil {
+			p.i08 = make(map[byte]*list.Element, p.capacity)
+		}
+		p.i08[data.(byte)] = elem
+	case I16:
+		if p.i16 == nil {
+			p.i16 = make(map[int16]*list.Element, p.capacity)
+		}
+		p.i16[data.(int16)] = elem
+	case I32:
+		if p.i32 == nil {
+			p.i32 = make(map[int32]*list.Element, p.capacity)
+		}
+		p.i32[data.(int32)] = elem
+	case I64:
+		if p.i64 == nil {
+			p.i64 = make(map[int64]*list.Element, p.capacity)
+		}
+		p.i64[data.(int64)] = elem
+	case DOUBLE:
+		if p.f64 == nil {
+			p.f64 = make(map[float64]*list.Element, p.capacity)
+		}
+		p.f64[data.(float64)] = elem
+	case STRING, UTF8, UTF16:
+		if p.s == nil {
+			p.s = make(map[string]*list.Element, p.capacity)
+		}
+		p.s[data.(string)] = elem
+	case BINARY:
+		if p.s == nil {
+			p.s = make(map[string]*list.Element, p.capacity)
+		}
+		p.s[string(data.([]byte))] = elem
+	}
+}
+
+func (p *tSet) unindex(data interface{}) {
+	switch p.elemType {
+	case BOOL:
+		delete(p.b, data.(bool))
+	case BYTE:
+		delete(p.i08, data.(byte))
+	case I16:
+		delete(p.i16, data.(int16))
+	case I32:
+		delete(p.i32, data.(int32))
+	case I64:
+		delete(p.i64, data.(int64))
+	case DOUBLE:
+		delete(p.f64, data.(float64))
+	case STRING, UTF8, UTF16:
+		delete(p.s, data.(string))
+	case BINARY:
+		delete(p.s, string(data.([]byte)))
+	}
+}
+
+/**
+ * Linear search used for element types that cannot be hashed.
+ */
+func (p *tSet) scan(data interface{}) *list.Element {
 	if data == nil {
 		for elem := p.l.Front(); elem != nil; elem = elem.Next() {
 			if elem.Value == nil {
@@ -124,10 +270,6 @@ func (p *tSet) find(data interface{}) *list.Element {
 		}
 		return nil
 	}
-	data, ok := p.elemType.CoerceData(data)
-	if data == nil || !ok {
-		return nil
-	}
 	if p.elemType == BINARY {
 		for elem := p.l.Front(); elem != nil; elem = elem.Next() {
 			if bytes.Compare(data.([]byte), elem.Value.([]byte)) == 0 {
@@ -209,13 +351,65 @@ func (p *tSet) find(data interface{}) *list.Element {
 	return nil
 }
 
-func (p *tSet) Values() []interface{} {
-	size := p.l.Len()
-	values := make([]interface{}, size, size)
-	i := 0
-	for v := p.l.Front(); v != nil; v = v.Next() {
-		values[i] = v.Value
-		i++
+/**
+ * Puts the elements of an ordered set into TType.Less order.  Elements are
+ * moved rather than copied so the hash maps stay valid.
+ */
+func (p *tSet) sort() {
+	if !p.ordered || p.sorted {
+		return
+	}
+	elems := make([]*list.Element, 0, p.l.Len())
+	for elem := p.l.Front(); elem != nil; elem = elem.Next() {
+		elems = append(elems, elem)
 	}
+	sort.Sort(&tSetElements{elemType: p.elemType, elems: elems})
+	for _, elem := range elems {
+		p.l.MoveToBack(elem)
+	}
+	p.sorted = true
+}
+
+type tSetElements struct {
+	elemType TType
+	elems    []*list.Element
+}
+
+func (p *tSetElements) Len() int {
+	return len(p.elems)
+}
+
+func (p *tSetElements) Less(i, j int) bool {
+	return p.elemType.Less(p.elems[i].Value, p.elems[j].Value)
+}
+
+func (p *tSetElements) Swap(i, j int) {
+	p.elems[i], p.elems[j] = p.elems[j], p.elems[i]
+}
+
+/**
+ * Returns the values of a set in TType.Less order, so that two sets holding
+ * the same elements compare equal whatever order they were built in.
+ */
+func orderedSetValues(set TSet) []interface{} {
+	values := set.Values()
+	sort.Sort(&tSetValues{elemType: set.ElemType(), values: values})
 	return values
 }
+
+type tSetValues struct {
+	elemType TType
+	values   []interface{}
+}
+
+func (p *tSetValues) Len() int {
+	return len(p.values)
+}
+
+func (p *tSetValues) Less(i, j int) bool {
+	return p.elemType.Less(p.values[i], p.values[j])
+}
+
+func (p *tSetValues) Swap(i, j int) {
+	p.values[i], p.values[j] = p.values[j], p.values[i]
+}
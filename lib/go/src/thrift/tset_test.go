@@ -0,0 +1,258 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"strconv"
+	"testing"
+)
+
+type testSetEnum int
+
+func (p testSetEnum) String() string {
+	return "testSetEnum_" + strconv.Itoa(int(p))
+}
+
+func (p testSetEnum) Value() int {
+	return int(p)
+}
+
+func (p testSetEnum) IsEnum() bool {
+	return true
+}
+
+func TestSetAddRemoveI64(t *testing.T) {
+	ts := NewTSet(I64, 3)
+	if ts.Len() != 0 {
+		t.Errorf("Expected an empty set to have length 0, but was %d", ts.Len())
+	}
+	ts.Add(int64(3))
+	ts.Add(int64(1))
+	ts.Add(2)
+	ts.Add(int64(3))
+	if ts.Len() != 3 {
+		t.Errorf("Expected length 3, but was %d", ts.Len())
+	}
+	for _, v := range []interface{}{int64(1), int64(2), int64(3), int32(2)} {
+		if !ts.Contains(v) {
+			t.Errorf("Expected %v (%T) in set, but not found", v, v)
+		}
+	}
+	if ts.Contains(int64(4)) {
+		t.Errorf("Expected not to find 4 in set, but found")
+	}
+	ts.Remove(2)
+	if ts.Contains(int64(2)) || ts.Len() != 2 {
+		t.Errorf("Expected 2 to be removed, but set was %v", ts.Values())
+	}
+	ts.Add(int64(2))
+	if values := ts.Values(); len(values) != 3 || values[0] != int64(3) || values[1] != int64(1) || values[2] != int64(2) {
+		t.Errorf("Expected insertion order [3 1 2], but was %v", values)
+	}
+}
+
+func TestSetAddString(t *testing.T) {
+	ts := NewTSet(STRING, 1)
+	ts.Add("a")
+	ts.Add([]byte("b"))
+	ts.Add("a")
+	if ts.Len() != 2 {
+		t.Errorf("Expected length 2, but was %d", ts.Len())
+	}
+	if !ts.Contains("a") || !ts.Contains("b") {
+		t.Errorf("Expected \"a\" and \"b\" in set, but set was %v", ts.Values())
+	}
+	if ts.Contains("c") {
+		t.Errorf("Expected not to find \"c\" in set, but found")
+	}
+}
+
+func TestSetAddBinary(t *testing.T) {
+	ts := NewTSet(BINARY, 1)
+	ts.Add([]byte("a"))
+	ts.Add([]byte("b"))
+	ts.Add([]byte("a"))
+	if ts.Len() != 2 {
+		t.Errorf("Expected length 2, but was %d", ts.Len())
+	}
+	if !ts.Contains([]byte("a")) || !ts.Contains("b") {
+		t.Errorf("Expected []byte(\"a\") and []byte(\"b\") in set, but set was %v", ts.Values())
+	}
+	ts.Remove([]byte("a"))
+	if ts.Contains([]byte("a")) || ts.Len() != 1 {
+		t.Errorf("Expected []byte(\"a\") to be removed, but set was %v", ts.Values())
+	}
+}
+
+func TestSetAddEnum(t *testing.T) {
+	ts := NewTSet(I32, 2)
+	ts.Add(testSetEnum(1))
+	ts.Add(testSetEnum(2))
+	ts.Add(int32(2))
+	if ts.Len() != 2 {
+		t.Errorf("Expected length 2, but was %d", ts.Len())
+	}
+	if !ts.Contains(testSetEnum(1)) || !ts.Contains(int32(2)) {
+		t.Errorf("Expected 1 and 2 in set, but set was %v", ts.Values())
+	}
+}
+
+func TestSetOrdered(t *testing.T) {
+	ts := NewTSetOrdered(I32, 4)
+	for _, v := range []int32{2, 4, 1, 3} {
+		ts.Add(v)
+	}
+	expected := []int32{4, 3, 2, 1}
+	i := 0
+	for e := ts.Front(); e != nil; e = e.Next() {
+		if e.Value != expected[i] {
+			t.Errorf("Expected element %d to be %d, but was %v", i, expected[i], e.Value)
+		}
+		i++
+	}
+	ts.Add(int32(5))
+	ts.Remove(int32(2))
+	if values := ts.Values(); len(values) != 4 || values[0] != int32(5) || values[3] != int32(1) {
+		t.Errorf("Expected [5 4 3 1], but was %v", values)
+	}
+	if !ts.Contains(int32(3)) || ts.Contains(int32(2)) {
+		t.Errorf("Expected index to survive reordering, but set was %v", ts.Values())
+	}
+}
+
+func TestSetEqualsIgnoresOrder(t *testing.T) {
+	a := NewTSet(STRING, 2)
+	a.Add("a")
+	a.Add("b")
+	b := NewTSet(STRING, 2)
+	b.Add("b")
+	b.Add("a")
+	if !a.Equals(b) {
+		t.Errorf("Expected %v to equal %v", a.Values(), b.Values())
+	}
+	b.Add("c")
+	if a.Equals(b) {
+		t.Errorf("Expected %v not to equal %v", a.Values(), b.Values())
+	}
+}
+
+func benchmarkSetI64Values(n int) []interface{} {
+	values := make([]interface{}, n)
+	for i := 0; i < n; i++ {
+		values[i] = int64(i * 7919 % n)
+	}
+	return values
+}
+
+func benchmarkSetStringValues(n int) []interface{} {
+	values := make([]interface{}, n)
+	for i := 0; i < n; i++ {
+		values[i] = "value-" + strconv.Itoa(i*7919%n)
+	}
+	return values
+}
+
+func benchmarkSetAdd(b *testing.B, elemType TType, values []interface{}) {
+	for i := 0; i < b.N; i++ {
+		set := NewTSet(elemType, len(values))
+		for _, v := range values {
+			set.Add(v)
+		}
+	}
+}
+
+func benchmarkSetContains(b *testing.B, elemType TType, values []interface{}) {
+	b.StopTimer()
+	set := NewTSet(elemType, len(values))
+	for _, v := range values {
+		set.Add(v)
+	}
+	b.StartTimer()
+	for i := 0; i < b.N; i++ {
+		if !set.Contains(values[i%len(values)]) {
+			b.Fatalf("Expected to find %v in set", values[i%len(values)])
+		}
+	}
+}
+
+func benchmarkSetIter(b *testing.B, set TSet, values []interface{}) {
+	b.StopTimer()
+	for _, v := range values {
+		set.Add(v)
+	}
+	b.StartTimer()
+	for i := 0; i < b.N; i++ {
+		n := 0
+		for e := set.Front(); e != nil; e = e.Next() {
+			n++
+		}
+		if n != len(values) {
+			b.Fatalf("Expected %d elements, but iterated over %d", len(values), n)
+		}
+	}
+}
+
+func BenchmarkSetAddI64_1k(b *testing.B) {
+	benchmarkSetAdd(b, I64, benchmarkSetI64Values(1000))
+}
+
+func BenchmarkSetAddI64_100k(b *testing.B) {
+	benchmarkSetAdd(b, I64, benchmarkSetI64Values(100000))
+}
+
+func BenchmarkSetAddString_1k(b *testing.B) {
+	benchmarkSetAdd(b, STRING, benchmarkSetStringValues(1000))
+}
+
+func BenchmarkSetAddString_100k(b *testing.B) {
+	benchmarkSetAdd(b, STRING, benchmarkSetStringValues(100000))
+}
+
+func BenchmarkSetContainsI64_1k(b *testing.B) {
+	benchmarkSetContains(b, I64, benchmarkSetI64Values(1000))
+}
+
+func BenchmarkSetContainsI64_100k(b *testing.B) {
+	benchmarkSetContains(b, I64, benchmarkSetI64Values(100000))
+}
+
+func BenchmarkSetContainsString_1k(b *testing.B) {
+	benchmarkSetContains(b, STRING, benchmarkSetStringValues(1000))
+}
+
+func BenchmarkSetContainsString_100k(b *testing.B) {
+	benchmarkSetContains(b, STRING, benchmarkSetStringValues(100000))
+}
+
+func BenchmarkSetIterI64_1k(b *testing.B) {
+	benchmarkSetIter(b, NewTSet(I64, 1000), benchmarkSetI64Values(1000))
+}
+
+func BenchmarkSetIterI64_100k(b *testing.B) {
+	benchmarkSetIter(b, NewTSet(I64, 100000), benchmarkSetI64Values(100000))
+}
+
+func BenchmarkSetIterOrderedI64_1k(b *testing.B) {
+	benchmarkSetIter(b, NewTSetOrdered(I64, 1000), benchmarkSetI64Values(1000))
+}
+
+func BenchmarkSetIterOrderedI64_100k(b *testing.B) {
+	benchmarkSetIter(b, NewTSetOrdered(I64, 100000), benchmarkSetI64Values(100000))
+}
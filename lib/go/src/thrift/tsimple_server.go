@@ -32,6 +32,8 @@ type TSimpleServer struct {
 	outputTransportFactory TTransportFactory
 	inputProtocolFactory   TProtocolFactory
 	outputProtocolFactory  TProtocolFactory
+
+	maxConcurrentRequests int
 }
 
 func NewTSimpleServer2(processor TProcessor, serverTransport TServerTransport) *TSimpleServer {
@@ -110,6 +112,15 @@ func (p *TSimpleServer) OutputProtocolFactory() TProtocolFactory {
 	return p.outputProtocolFactory
 }
 
+/**
+ * Serves up to n calls from each connection at once, replying to each as it
+ * finishes; see ProcessConcurrently().  The default of 1 serves the calls of
+ * a connection one at a time, in order.
+ */
+func (p *TSimpleServer) SetMaxConcurrentRequests(n int) {
+	p.maxConcurrentRequests = n
+}
+
 func (p *TSimpleServer) Serve() error {
 	p.stopped = false
 	err := p.serverTransport.Listen()
@@ -146,6 +157,10 @@ func (p *TSimpleServer) processRequest(client TTransport) {
 	if outputTransport != nil {
 		defer outputTransport.Close()
 	}
+	if p.maxConcurrentRequests > 1 {
+		ProcessConcurrently(processor, inputProtocol, outputProtocol, p.outputProtocolFactory, p.maxConcurrentRequests)
+		return
+	}
 	for {
 		ok, e := processor.Process(inputProtocol, outputProtocol)
 		if e != nil {
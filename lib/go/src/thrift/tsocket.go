@@ -21,6 +21,7 @@ package thrift
 
 import (
 	"bytes"
+	"errors"
 	"net"
 	"time"
 )
@@ -173,7 +174,7 @@ func (p *TSocket) Close() error {
 	// Close the socket
 	if p.conn != nil {
 		err := p.conn.Close()
-		if err != nil {
+		if err != nil && !errors.Is(err, net.ErrClosed) {
 			LOGGER.Print("Could not close socket. ", err.Error())
 			return err
 		}
@@ -204,6 +205,23 @@ func (p *TSocket) Write(buf []byte) (int, error) {
 	return len(buf), nil
 }
 
+/**
+ * Sends whatever Write() has buffered followed by bufs with one vectored
+ * write on the connection.
+ */
+func (p *TSocket) WriteBuffers(bufs *net.Buffers) (int64, error) {
+	if !p.IsOpen() {
+		return 0, NewTTransportException(NOT_OPEN, "Connection not open")
+	}
+	p.pushDeadline(false, true)
+	if p.writeBuffer.Len() > 0 {
+		*bufs = append(net.Buffers{p.writeBuffer.Bytes()}, *bufs...)
+	}
+	n, err := bufs.WriteTo(p.conn)
+	p.writeBuffer.Reset()
+	return n, NewTTransportExceptionFromOsError(err)
+}
+
 func (p *TSocket) Peek() bool {
 	return p.IsOpen()
 }
@@ -220,6 +238,7 @@ func (p *TSocket) Interrupt() error {
 	if !p.IsOpen() {
 		return nil
 	}
-	// TODO(pomack) fix Interrupt as this is probably wrong
+	// Leaves p.conn in place, since a Read() or Write() blocked in another
+	// goroutine is still using it; Close() releases the socket afterwards.
 	return p.conn.Close()
 }
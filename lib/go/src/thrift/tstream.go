@@ -0,0 +1,122 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"io"
+)
+
+/**
+ * Implemented by protocols that can write a binary value from an io.Reader
+ * and read one into an io.Writer, passing it through a small buffer rather
+ * than holding all of it in memory at once.
+ */
+type TBinaryStreamer interface {
+	WriteBinaryFromReader(reader io.Reader, size int) TProtocolException
+	ReadBinaryToWriter(writer io.Writer) (int64, TProtocolException)
+}
+
+/**
+ * Writes size bytes read from reader to prot as a binary value, streaming
+ * them if prot is a TBinaryStreamer and reading them into memory first
+ * otherwise.
+ */
+func WriteBinaryFromReader(prot TProtocol, reader io.Reader, size int) TProtocolException {
+	if streamer, ok := prot.(TBinaryStreamer); ok {
+		return streamer.WriteBinaryFromReader(reader, size)
+	}
+	value := make([]byte, size)
+	if _, err := io.ReadFull(reader, value); err != nil {
+		return NewTProtocolExceptionFromOsError(err)
+	}
+	return prot.WriteBinary(value)
+}
+
+/**
+ * Reads a binary value from prot into writer, streaming it if prot is a
+ * TBinaryStreamer and reading it into memory first otherwise.
+ */
+func ReadBinaryToWriter(prot TProtocol, writer io.Writer) (int64, TProtocolException) {
+	if streamer, ok := prot.(TBinaryStreamer); ok {
+		return streamer.ReadBinaryToWriter(writer)
+	}
+	value, err := prot.ReadBinary()
+	if err != nil {
+		return 0, err
+	}
+	n, e := writer.Write(value)
+	return int64(n), NewTProtocolExceptionFromOsError(e)
+}
+
+/**
+ * Attached to a binary field of a struct generated with
+ * "--gen go:binary_streams", so that Write() takes the field's value from
+ * Reader, which must yield Size bytes, and Read() copies it into Writer,
+ * instead of either holding it in the field.  A nil *TBinaryStream, or one
+ * without a Reader or Writer, leaves the field to be written or read as
+ * usual.  Streams only apply to Write() and Read() through a protocol, not
+ * to the Marshal and Unmarshal methods, which work in memory anyway.
+ */
+type TBinaryStream struct {
+	Reader io.Reader
+	Size   int
+	Writer io.Writer
+}
+
+/**
+ * Whether the field is to be written from the stream.
+ */
+func (p *TBinaryStream) IsSet() bool {
+	return p != nil && p.Reader != nil
+}
+
+/**
+ * Writes the field from Reader if the stream is set, and value otherwise.
+ */
+func (p *TBinaryStream) WriteBinary(oprot TProtocol, value []byte) TProtocolException {
+	if !p.IsSet() {
+		return oprot.WriteBinary(value)
+	}
+	return WriteBinaryFromReader(oprot, p.Reader, p.Size)
+}
+
+/**
+ * Reads the field into Writer, returning nil, if there is one, and returns
+ * it as iprot.ReadBinary() does otherwise.
+ */
+func (p *TBinaryStream) ReadBinary(iprot TProtocol) ([]byte, TProtocolException) {
+	if p == nil || p.Writer == nil {
+		return iprot.ReadBinary()
+	}
+	_, err := ReadBinaryToWriter(iprot, p.Writer)
+	return nil, err
+}
+
+/**
+ * As ReadBinary(), but borrowing the value when there is no Writer; see
+ * ReadBinaryBorrowed().
+ */
+func (p *TBinaryStream) ReadBinaryBorrowed(iprot TProtocol) ([]byte, TProtocolException) {
+	if p == nil || p.Writer == nil {
+		return ReadBinaryBorrowed(iprot)
+	}
+	_, err := ReadBinaryToWriter(iprot, p.Writer)
+	return nil, err
+}
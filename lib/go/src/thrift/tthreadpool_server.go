@@ -0,0 +1,315 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one
+ * or more contributor license agreements. See the NOTICE file
+ * distributed with this work for additional information
+ * regarding copyright ownership. The ASF licenses this file
+ * to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations
+ * under the License.
+ */
+
+package thrift
+
+import (
+	"sync"
+	"sync/atomic"
+)
+
+const (
+	DEFAULT_THREAD_POOL_WORKERS         = 64
+	DEFAULT_THREAD_POOL_QUEUE_SIZE      = 256
+	DEFAULT_THREAD_POOL_MAX_CONNECTIONS = 1024
+)
+
+/**
+ * A TServer whose handlers run on a fixed pool of worker goroutines fed by a
+ * bounded queue, so that the work the server takes on does not grow with the
+ * number of connections or calls made to it.
+ *
+ * A goroutine per connection reads its calls, at most maxConcurrentRequests
+ * of them outstanding at once, and queues each for the workers.  When the
+ * queue is full a call is refused at once with a TApplicationException of
+ * type INTERNAL_ERROR rather than left to wait, so that the calls the server
+ * does take are answered in a bounded time and the client may back off or go
+ * elsewhere.  A oneway call is refused silently, as its client reads no
+ * reply.  Once maxConnections are open a connection is closed as soon as it
+ * is accepted, so that a storm of connections costs the server no more
+ * goroutines than the limit.  QueueDepth(), Rejected() and
+ * RejectedConnections() report how loaded the server is.
+ *
+ * Only the TSplitProcessorFunctions of processors that look up their
+ * functions by name, as the generated ones do, run on the pool; any other
+ * processor is served on the connection's goroutine, as by
+ * TNonblockingServer.  The Set methods must be called before Serve().
+ */
+type TThreadPoolServer struct {
+	rejected            uint64
+	rejectedConnections uint64
+	processed           uint64
+
+	/** Flag for stopping the server */
+	stopped bool
+
+	processorFactory       TProcessorFactory
+	serverTransport        TServerTransport
+	inputTransportFactory  TTransportFactory
+	outputTransportFactory TTransportFactory
+	inputProtocolFactory   TProtocolFactory
+	outputProtocolFactory  TProtocolFactory
+
+	workers               int
+	maxConcurrentRequests int
+	queue                 chan func()
+	connectionSlots       chan struct{}
+	connections           sync.WaitGroup
+}
+
+func NewTThreadPoolServer2(processor TProcessor, serverTransport TServerTransport) *TThreadPoolServer {
+	return NewTThreadPoolServerFactory2(NewTProcessorFactory(processor), serverTransport)
+}
+
+func NewTThreadPoolServer4(processor TProcessor, serverTransport TServerTransport, transportFactory TTransportFactory, protocolFactory TProtocolFactory) *TThreadPoolServer {
+	return NewTThreadPoolServerFactory4(NewTProcessorFactory(processor),
+		serverTransport,
+		transportFactory,
+		protocolFactory,
+	)
+}
+
+func NewTThreadPoolServer6(processor TProcessor, serverTransport TServerTransport, inputTransportFactory TTransportFactory, outputTransportFactory TTransportFactory, inputProtocolFactory TProtocolFactory, outputProtocolFactory TProtocolFactory) *TThreadPoolServer {
+	return NewTThreadPoolServerFactory6(NewTProcessorFactory(processor),
+		serverTransport,
+		inputTransportFactory,
+		outputTransportFactory,
+		inputProtocolFactory,
+		outputProtocolFactory,
+	)
+}
+
+func NewTThreadPoolServerFactory2(processorFactory TProcessorFactory, serverTransport TServerTransport) *TThreadPoolServer {
+	return NewTThreadPoolServerFactory6(processorFactory,
+		serverTransport,
+		NewTTransportFactory(),
+		NewTTransportFactory(),
+		NewTBinaryProtocolFactoryDefault(),
+		NewTBinaryProtocolFactoryDefault(),
+	)
+}
+
+func NewTThreadPoolServerFactory4(processorFactory TProcessorFactory, serverTransport TServerTransport, transportFactory TTransportFactory, protocolFactory TProtocolFactory) *TThreadPoolServer {
+	return NewTThreadPoolServerFactory6(processorFactory,
+		serverTransport,
+		transportFactory,
+		transportFactory,
+		protocolFactory,
+		protocolFactory,
+	)
+}
+
+func NewTThreadPoolServerFactory6(processorFactory TProcessorFactory, serverTransport TServerTransport, inputTransportFactory TTransportFactory, outputTransportFactory TTransportFactory, inputProtocolFactory TProtocolFactory, outputProtocolFactory TProtocolFactory) *TThreadPoolServer {
+	return &TThreadPoolServer{processorFactory: processorFactory,
+		serverTransport:        serverTransport,
+		inputTransportFactory:  inputTransportFactory,
+		outputTransportFactory: outputTransportFactory,
+		inputProtocolFactory:   inputProtocolFactory,
+		outputProtocolFactory:  outputProtocolFactory,
+		workers:                DEFAULT_THREAD_POOL_WORKERS,
+		maxConcurrentRequests:  1,
+		queue:                  make(chan func(), DEFAULT_THREAD_POOL_QUEUE_SIZE),
+		connectionSlots:        make(chan struct{}, DEFAULT_THREAD_POOL_MAX_CONNECTIONS),
+	}
+}
+
+func (p *TThreadPoolServer) ProcessorFactory() TProcessorFactory {
+	return p.processorFactory
+}
+
+func (p *TThreadPoolServer) ServerTransport() TServerTransport {
+	return p.serverTransport
+}
+
+func (p *TThreadPoolServer) InputTransportFactory() TTransportFactory {
+	return p.inputTransportFactory
+}
+
+func (p *TThreadPoolServer) OutputTransportFactory() TTransportFactory {
+	return p.outputTransportFactory
+}
+
+func (p *TThreadPoolServer) InputProtocolFactory() TProtocolFactory {
+	return p.inputProtocolFactory
+}
+
+func (p *TThreadPoolServer) OutputProtocolFactory() TProtocolFactory {
+	return p.outputProtocolFactory
+}
+
+/**
+ * Sets the number of goroutines that run handlers.
+ */
+func (p *TThreadPoolServer) SetWorkers(n int) {
+	p.workers = n
+}
+
+/**
+ * Sets the number of calls that may wait for a worker before further calls
+ * are refused.  With a size of 0 a call is refused unless a worker is idle.
+ */
+func (p *TThreadPoolServer) SetQueueSize(n int) {
+	p.queue = make(chan func(), n)
+}
+
+/**
+ * Lets up to n calls from each connection be queued or running at once,
+ * replying to each as it finishes; see ProcessConcurrently().  The default
+ * of 1 serves the calls of a connection one at a time, in order.
+ */
+func (p *TThreadPoolServer) SetMaxConcurrentRequests(n int) {
+	p.maxConcurrentRequests = n
+}
+
+/**
+ * Sets the number of connections that may be open at once before further
+ * connections are closed as they are accepted.
+ */
+func (p *TThreadPoolServer) SetMaxConnections(n int) {
+	p.connectionSlots = make(chan struct{}, n)
+}
+
+/**
+ * The number of calls waiting for a worker.
+ */
+func (p *TThreadPoolServer) QueueDepth() int {
+	return len(p.queue)
+}
+
+/**
+ * The number of calls refused because the queue was full.
+ */
+func (p *TThreadPoolServer) Rejected() uint64 {
+	return atomic.LoadUint64(&p.rejected)
+}
+
+/**
+ * The number of connections closed because maxConnections were open.
+ */
+func (p *TThreadPoolServer) RejectedConnections() uint64 {
+	return atomic.LoadUint64(&p.rejectedConnections)
+}
+
+/**
+ * The number of calls the workers have run.
+ */
+func (p *TThreadPoolServer) Processed() uint64 {
+	return atomic.LoadUint64(&p.processed)
+}
+
+/**
+ * Accepts connections until stopped.  The workers stop once every
+ * connection accepted has closed.
+ */
+func (p *TThreadPoolServer) Serve() error {
+	p.stopped = false
+	err := p.serverTransport.Listen()
+	if err != nil {
+		return err
+	}
+	done := make(chan struct{})
+	for i := 0; i < p.workers; i++ {
+		go p.work(done)
+	}
+	defer func() {
+		go func() {
+			p.connections.Wait()
+			close(done)
+		}()
+	}()
+	for !p.stopped {
+		client, err := p.serverTransport.Accept()
+		if err != nil {
+			return err
+		}
+		if client == nil {
+			continue
+		}
+		select {
+		case p.connectionSlots <- struct{}{}:
+			p.connections.Add(1)
+			go p.processRequest(client)
+		default:
+			atomic.AddUint64(&p.rejectedConnections, 1)
+			client.Close()
+		}
+	}
+	return nil
+}
+
+func (p *TThreadPoolServer) Stop() error {
+	p.stopped = true
+	p.serverTransport.Interrupt()
+	return nil
+}
+
+func (p *TThreadPoolServer) IsStopped() bool {
+	return p.stopped
+}
+
+func (p *TThreadPoolServer) work(done chan struct{}) {
+	for {
+		select {
+		case handle := <-p.queue:
+			handle()
+			atomic.AddUint64(&p.processed, 1)
+		case <-done:
+			return
+		}
+	}
+}
+
+/**
+ * Queues handle for a worker unless the queue is full.
+ */
+func (p *TThreadPoolServer) dispatch(handle func()) bool {
+	select {
+	case p.queue <- handle:
+		return true
+	default:
+		atomic.AddUint64(&p.rejected, 1)
+		return false
+	}
+}
+
+func (p *TThreadPoolServer) processRequest(client TTransport) {
+	defer p.connections.Done()
+	defer func() { <-p.connectionSlots }()
+	processor := p.processorFactory.GetProcessor(client)
+	inputTransport := p.inputTransportFactory.GetTransport(client)
+	outputTransport := p.outputTransportFactory.GetTransport(client)
+	inputProtocol := p.inputProtocolFactory.GetProtocol(inputTransport)
+	outputProtocol := p.outputProtocolFactory.GetProtocol(outputTransport)
+	if inputTransport != nil {
+		defer inputTransport.Close()
+	}
+	if outputTransport != nil {
+		defer outputTransport.Close()
+	}
+	if functions, ok := processor.(TProcessorFunctionMap); ok {
+		processDispatched(functions, inputProtocol, outputProtocol, p.outputProtocolFactory, p.maxConcurrentRequests, p.dispatch)
+		return
+	}
+	for {
+		ok, e := processor.Process(inputProtocol, outputProtocol)
+		if e != nil || !ok {
+			break
+		}
+	}
+}
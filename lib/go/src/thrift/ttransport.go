@@ -173,6 +173,25 @@ func ReadAllTransport(p TTransport, buf []byte) (n int, err error) {
 	return n, err
 }
 
+/**
+ * Implemented by transports that can break out of a read or write blocked in
+ * another goroutine, as closing a socket does.  Like
+ * TServerTransport.Interrupt(), it MUST be thread safe.
+ */
+type TInterruptible interface {
+	Interrupt() error
+}
+
+/**
+ * Interrupts trans if it is TInterruptible and closes it otherwise.
+ */
+func InterruptTransport(trans TTransport) error {
+	if i, ok := trans.(TInterruptible); ok {
+		return i.Interrupt()
+	}
+	return trans.Close()
+}
+
 var (
 	LOGGER *log.Logger
 )
@@ -22,9 +22,15 @@ package thrift
 import (
 	"bytes"
 	"container/list"
+	"errors"
 	"strconv"
 )
 
+/**
+ * Returned from a ForEach() callback to stop iterating early.
+ */
+var errStopIteration = errors.New("stop iteration")
+
 /**
  * Type constants in the Thrift protocol.
  */
@@ -412,14 +418,16 @@ func (p TType) Compare(i, j interface{}) (int, bool) {
 		if cmp, ok := si.TStructFields().CompareTo(sj.TStructFields()); !ok || cmp != 0 {
 			return cmp, ok
 		}
-		for field := range si.TStructFields().Iter() {
+		cmp, ok := 0, true
+		si.TStructFields().ForEach(func(field TField) error {
 			a := si.AttributeFromFieldId(field.Id())
 			b := sj.AttributeFromFieldId(field.Id())
-			if cmp, ok := field.TypeId().Compare(a, b); !ok || cmp != 0 {
-				return cmp, ok
+			if cmp, ok = field.TypeId().Compare(a, b); !ok || cmp != 0 {
+				return errStopIteration
 			}
-		}
-		return 0, true
+			return nil
+		})
+		return cmp, ok
 	case MAP:
 		mi, iok := ci.(TMap)
 		mj, jok := cj.(TMap)
@@ -480,7 +488,7 @@ func (p TType) Compare(i, j interface{}) (int, bool) {
 		if size != lj.Len() {
 			return CompareInt(size, lj.Len()), true
 		}
-		return ei.CompareValueArrays(li.Values(), lj.Values())
+		return ei.CompareValueArrays(orderedSetValues(li), orderedSetValues(lj))
 	default:
 		panic("Invalid thrift type to coerce")
 	}
@@ -832,6 +840,9 @@ func (p TType) CoerceData(data interface{}) (interface{}, bool) {
 		if b, ok := data.(int32); ok {
 			return b, true
 		}
+		if b, ok := data.(Enumer); ok {
+			return int32(b.Value()), true
+		}
 		if b, ok := data.(int); ok {
 			return int32(b), true
 		}
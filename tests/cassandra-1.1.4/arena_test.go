@@ -0,0 +1,108 @@
+package cassandra
+
+import (
+	"fmt"
+	"reflect"
+	"testing"
+	"thrift"
+)
+
+// These tests are compiled against the output of
+// "--gen go:native_containers,arena", alongside native_containers_test.go,
+// whose BenchmarkGetRangeSlicesRead reads the same result without an arena.
+
+func newArenaGetRangeSlicesResult(rows int) *GetRangeSlicesResult {
+	slices := make([]*KeySlice, 0, rows)
+
+	for row := 0; row < rows; row++ {
+		column := NewColumn()
+		column.Name = []byte("column")
+		column.Value = []byte(fmt.Sprintf("value-%d", row))
+		column.Timestamp = int64(row)
+		columnOrSuperColumn := NewColumnOrSuperColumn()
+		columnOrSuperColumn.Column = column
+		slice := NewKeySlice()
+		slice.Key = []byte(fmt.Sprintf("row-%d", row))
+		slice.Columns = []*ColumnOrSuperColumn{columnOrSuperColumn}
+		slices = append(slices, slice)
+	}
+
+	result := NewGetRangeSlicesResult()
+	result.Success = slices
+	return result
+}
+
+func TestArenaRoundTrip(t *testing.T) {
+	in := newArenaGetRangeSlicesResult(100)
+	wire := in.MarshalBinaryThrift(nil)
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	arena := thrift.NewTArena()
+	thrift.SetArena(protocol, arena)
+	buffer.Write(wire)
+	out := NewGetRangeSlicesResult()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read result due to '%q'.", err)
+	}
+
+	if !reflect.DeepEqual(in.Success, out.Success) {
+		t.Errorf("in.Success (%v) != out.Success (%v).", in.Success, out.Success)
+	}
+
+	first, key := out.Success[0], out.Success[0].Key
+	arena.Reset()
+	buffer.Write(wire)
+	again := NewGetRangeSlicesResult()
+
+	if err := again.Read(protocol); err != nil {
+		t.Fatalf("Could not read result due to '%q'.", err)
+	}
+
+	if again.Success[0] != first || &again.Success[0].Key[0] != &key[0] {
+		t.Errorf("A read after arena.Reset() did not reuse the arena's structs and bytes.")
+	}
+
+	if !reflect.DeepEqual(in.Success, again.Success) {
+		t.Errorf("in.Success (%v) != again.Success (%v).", in.Success, again.Success)
+	}
+}
+
+func TestArenaNotSet(t *testing.T) {
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	buffer.Write(newArenaGetRangeSlicesResult(2).MarshalBinaryThrift(nil))
+	out := NewGetRangeSlicesResult()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read result due to '%q'.", err)
+	}
+
+	if out.Success[0] == out.Success[1] || len(out.Success[0].Key) == 0 {
+		t.Errorf("A read without an arena did not allocate its structs afresh.")
+	}
+}
+
+// Reads the result of BenchmarkGetRangeSlicesRead into an arena that is reset
+// for each read, as a client would once done with each reply.
+func BenchmarkGetRangeSlicesReadArena(b *testing.B) {
+	b.StopTimer()
+	wire := newArenaGetRangeSlicesResult(10000).MarshalBinaryThrift(nil)
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	arena := thrift.NewTArena()
+	thrift.SetArena(protocol, arena)
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+		arena.Reset()
+
+		if err := NewGetRangeSlicesResult().Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
@@ -0,0 +1,63 @@
+package cassandra
+
+import (
+	"bytes"
+	"testing"
+	"thrift"
+)
+
+// Compiled against the output of "--gen go:binary_streams", under which
+// every binary field Foo has a FooStream.
+
+func TestBinaryStreamsRoundTrip(t *testing.T) {
+	value := bytes.Repeat([]byte("streamed value "), 100000)
+	in := NewColumn()
+	in.Name = []byte("column")
+	in.ValueStream = &thrift.TBinaryStream{Reader: bytes.NewReader(value), Size: len(value)}
+	in.Timestamp = 7
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolTransport(thrift.NewTChunkedTransport(buffer, 4096))
+
+	if !in.IsSetValue() {
+		t.Errorf("in.IsSetValue() is false for a streamed value.")
+	}
+
+	if err := in.Write(protocol); err != nil {
+		t.Fatalf("Could not write column due to '%q'.", err)
+	}
+
+	protocol.Flush()
+	received := new(bytes.Buffer)
+	out := NewColumn()
+	out.ValueStream = &thrift.TBinaryStream{Writer: received}
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read column due to '%q'.", err)
+	}
+
+	if !bytes.Equal(received.Bytes(), value) || out.Value != nil {
+		t.Errorf("out.ValueStream received %d bytes and out.Value holds %d, rather than %d and none.", received.Len(), len(out.Value), len(value))
+	}
+
+	if string(out.Name) != "column" || out.Timestamp != 7 {
+		t.Errorf("out.Name (%q) != \"column\" or out.Timestamp (%d) != 7.", out.Name, out.Timestamp)
+	}
+}
+
+func TestBinaryStreamsUnsetRoundTrip(t *testing.T) {
+	in := NewColumn()
+	in.Name = []byte("column")
+	in.Value = []byte("value")
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolTransport(buffer)
+	in.Write(protocol)
+	out := NewColumn()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read column due to '%q'.", err)
+	}
+
+	if string(out.Name) != "column" || string(out.Value) != "value" {
+		t.Errorf("out.Name (%q) != \"column\" or out.Value (%q) != \"value\".", out.Name, out.Value)
+	}
+}
@@ -0,0 +1,135 @@
+package cassandra
+
+import (
+	"fmt"
+	"testing"
+	"thrift"
+)
+
+// The thrift.TMap/thrift.TList counterparts of the benchmarks in
+// native_containers_test.go, compiled against the default generator output.
+
+const (
+	benchmarkRows               = 100
+	benchmarkMutationsPerFamily = 10
+)
+
+var benchmarkColumnFamilies = []string{"Standard1", "Standard2"}
+
+func newBenchmarkMutation(i int) *Mutation {
+	column := NewColumn()
+	column.Name = []byte(fmt.Sprintf("column-%d", i))
+	column.Value = []byte("value")
+	column.Timestamp = int64(i)
+	columnOrSuperColumn := NewColumnOrSuperColumn()
+	columnOrSuperColumn.Column = column
+	mutation := NewMutation()
+	mutation.ColumnOrSupercolumn = columnOrSuperColumn
+	return mutation
+}
+
+func newBenchmarkBatchMutateArgs() *BatchMutateArgs {
+	mutationMap := thrift.NewTMap(thrift.BINARY, thrift.MAP, benchmarkRows)
+
+	for row := 0; row < benchmarkRows; row++ {
+		byColumnFamily := thrift.NewTMap(thrift.STRING, thrift.LIST, len(benchmarkColumnFamilies))
+
+		for _, columnFamily := range benchmarkColumnFamilies {
+			mutations := thrift.NewTList(thrift.STRUCT, benchmarkMutationsPerFamily)
+
+			for i := 0; i < benchmarkMutationsPerFamily; i++ {
+				mutations.Push(newBenchmarkMutation(i))
+			}
+
+			byColumnFamily.Set(columnFamily, mutations)
+		}
+
+		mutationMap.Set([]byte(fmt.Sprintf("row-%d", row)), byColumnFamily)
+	}
+
+	args := NewBatchMutateArgs()
+	args.MutationMap = mutationMap
+	args.ConsistencyLevel = ConsistencyLevel_QUORUM
+	return args
+}
+
+// Boxed containers only hold generated structs as long as they satisfy
+// thrift.TStruct; otherwise thrift.TList.Push() swaps in an empty one.
+var _ thrift.TStruct = (*Mutation)(nil)
+
+func TestBoxedContainersRoundTrip(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := in.Write(protocol); err != nil {
+		t.Fatalf("Could not write request due to '%q'.", err)
+	}
+
+	out := NewBatchMutateArgs()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read request due to '%q'.", err)
+	}
+
+	if out.MutationMap == nil || out.MutationMap.Len() != benchmarkRows {
+		t.Fatalf("out.MutationMap (%v) does not hold %d rows.", out.MutationMap, benchmarkRows)
+	}
+
+	row, ok := out.MutationMap.Get([]byte("row-7"))
+
+	if !ok {
+		t.Fatalf("out.MutationMap has no row-7.")
+	}
+
+	mutations, ok := row.(thrift.TMap).Get("Standard2")
+
+	if !ok || mutations.(thrift.TList).Len() != benchmarkMutationsPerFamily {
+		t.Fatalf("row-7 (%v) does not hold %d Standard2 mutations.", row, benchmarkMutationsPerFamily)
+	}
+
+	mutation, ok := mutations.(thrift.TList).At(3).(*Mutation)
+
+	if !ok || !mutation.EqualsT(newBenchmarkMutation(3)) {
+		t.Errorf("out.MutationMap[row-7][Standard2][3] (%v) != %v.", mutations.(thrift.TList).At(3), newBenchmarkMutation(3))
+	}
+}
+
+func BenchmarkBatchMutateWrite(b *testing.B) {
+	b.StopTimer()
+	args := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+
+		if err := args.Write(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkBatchMutateRead(b *testing.B) {
+	b.StopTimer()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := newBenchmarkBatchMutateArgs().Write(protocol); err != nil {
+		b.Fatal(err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+
+		if err := NewBatchMutateArgs().Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
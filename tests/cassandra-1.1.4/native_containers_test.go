@@ -0,0 +1,347 @@
+package cassandra
+
+import (
+	"fmt"
+	"reflect"
+	"testing"
+	"thrift"
+)
+
+// These benchmarks are compiled against the output of
+// "--gen go:native_containers", and of "--gen go:native_containers,zero_copy",
+// under which the reads from a thrift.TMemoryBuffer borrow their strings and
+// binary values from it; boxed_containers_test.go holds their counterparts
+// for the default thrift.TMap/thrift.TList output.  All use the same shape of
+// batch_mutate() request so their results may be compared directly.
+
+const (
+	benchmarkRows               = 100
+	benchmarkMutationsPerFamily = 10
+)
+
+var benchmarkColumnFamilies = []string{"Standard1", "Standard2"}
+
+func newBenchmarkMutation(i int) *Mutation {
+	column := NewColumn()
+	column.Name = []byte(fmt.Sprintf("column-%d", i))
+	column.Value = []byte("value")
+	column.Timestamp = int64(i)
+	columnOrSuperColumn := NewColumnOrSuperColumn()
+	columnOrSuperColumn.Column = column
+	mutation := NewMutation()
+	mutation.ColumnOrSupercolumn = columnOrSuperColumn
+	return mutation
+}
+
+func newBenchmarkBatchMutateArgs() *BatchMutateArgs {
+	mutationMap := make(map[string]map[string][]*Mutation, benchmarkRows)
+
+	for row := 0; row < benchmarkRows; row++ {
+		byColumnFamily := make(map[string][]*Mutation, len(benchmarkColumnFamilies))
+
+		for _, columnFamily := range benchmarkColumnFamilies {
+			mutations := make([]*Mutation, 0, benchmarkMutationsPerFamily)
+
+			for i := 0; i < benchmarkMutationsPerFamily; i++ {
+				mutations = append(mutations, newBenchmarkMutation(i))
+			}
+
+			byColumnFamily[columnFamily] = mutations
+		}
+
+		mutationMap[fmt.Sprintf("row-%d", row)] = byColumnFamily
+	}
+
+	args := NewBatchMutateArgs()
+	args.MutationMap = mutationMap
+	args.ConsistencyLevel = ConsistencyLevel_QUORUM
+	return args
+}
+
+func TestNativeContainersRoundTrip(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := in.Write(protocol); err != nil {
+		t.Fatalf("Could not write request due to '%q'.", err)
+	}
+
+	out := NewBatchMutateArgs()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read request due to '%q'.", err)
+	}
+
+	if !reflect.DeepEqual(in.MutationMap, out.MutationMap) {
+		t.Errorf("in.MutationMap (%v) != out.MutationMap (%v).", in.MutationMap, out.MutationMap)
+	}
+
+	if in.ConsistencyLevel != out.ConsistencyLevel {
+		t.Errorf("in.ConsistencyLevel (%q) != out.ConsistencyLevel (%q).", in.ConsistencyLevel, out.ConsistencyLevel)
+	}
+}
+
+func TestNativeContainersSize(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+
+	if wire := in.MarshalBinaryThrift(nil); in.BinarySize() != len(wire) {
+		t.Errorf("in.BinarySize() (%d) != len(in.MarshalBinaryThrift()) (%d).", in.BinarySize(), len(wire))
+	}
+
+	if wire := in.MarshalCompactThrift(nil); in.CompactSize() != len(wire) {
+		t.Errorf("in.CompactSize() (%d) != len(in.MarshalCompactThrift()) (%d).", in.CompactSize(), len(wire))
+	}
+}
+
+func TestNativeContainersReset(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	in.Write(protocol)
+	wire := append([]byte(nil), buffer.Bytes()...)
+	out := NewBatchMutateArgs()
+	out.Read(protocol)
+	storage := reflect.ValueOf(out.MutationMap).Pointer()
+	out.ConsistencyLevel = ConsistencyLevel_ALL
+	out.Reset()
+
+	if out.MutationMap != nil {
+		t.Errorf("out.MutationMap (%v) was not reset to nil.", out.MutationMap)
+	}
+
+	if out.ConsistencyLevel != NewBatchMutateArgs().ConsistencyLevel {
+		t.Errorf("out.ConsistencyLevel (%q) was not reset to its default.", out.ConsistencyLevel)
+	}
+
+	buffer.Write(wire)
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read request due to '%q'.", err)
+	}
+
+	if !reflect.DeepEqual(in.MutationMap, out.MutationMap) || reflect.ValueOf(out.MutationMap).Pointer() != storage {
+		t.Errorf("out.MutationMap was not read back into its own storage.")
+	}
+}
+
+// Only a read that follows Reset() reuses storage; a plain read into a
+// struct read before leaves what that read returned untouched.
+func TestNativeContainersReadWithoutReset(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	in.Write(protocol)
+	wire := append([]byte(nil), buffer.Bytes()...)
+	out := NewBatchMutateArgs()
+	out.Read(protocol)
+	first := out.MutationMap
+	buffer.Write(wire)
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read request due to '%q'.", err)
+	}
+
+	if reflect.ValueOf(out.MutationMap).Pointer() == reflect.ValueOf(first).Pointer() {
+		t.Errorf("out.MutationMap was read into the storage of the read before.")
+	}
+
+	if !reflect.DeepEqual(in.MutationMap, first) {
+		t.Errorf("The MutationMap of the first read (%d rows) was overwritten by the second.", len(first))
+	}
+}
+
+func TestNativeContainersEquality(t *testing.T) {
+	in := newBenchmarkBatchMutateArgs()
+	out := NewBatchMutateArgs()
+
+	if err := out.UnmarshalBinaryThrift(in.MarshalBinaryThrift(nil)); err != nil {
+		t.Fatalf("Could not read request due to '%q'.", err)
+	}
+
+	if !in.EqualsT(out) || in.Hash64() != out.Hash64() {
+		t.Errorf("A request read back gave EqualsT() => %v, Hash64() => %x and %x.", in.EqualsT(out), in.Hash64(), out.Hash64())
+	}
+
+	if c, ok := in.CompareTo(out); c != 0 || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want 0, true.", c, ok)
+	}
+
+	if allocs := testing.AllocsPerRun(10, func() {
+		in.EqualsT(out)
+		in.Hash64()
+	}); allocs != 0 {
+		t.Errorf("EqualsT() and Hash64() made %v allocations, want none.", allocs)
+	}
+
+	out.MutationMap["row-7"]["Standard2"][3].ColumnOrSupercolumn.Column.Timestamp++
+
+	if in.EqualsT(out) || in.Hash64() == out.Hash64() {
+		t.Errorf("A request differing in one timestamp was taken as equal.")
+	}
+
+	if c, _ := in.CompareTo(out); c == 0 {
+		t.Errorf("in.CompareTo(out) => 0 for requests that differ.")
+	}
+}
+
+func BenchmarkBatchMutateEquals(b *testing.B) {
+	b.StopTimer()
+	in, out := newBenchmarkBatchMutateArgs(), newBenchmarkBatchMutateArgs()
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		if !in.EqualsT(out) {
+			b.Fatal("in != out")
+		}
+	}
+}
+
+func BenchmarkBatchMutateHash(b *testing.B) {
+	b.StopTimer()
+	args := newBenchmarkBatchMutateArgs()
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		args.Hash64()
+	}
+}
+
+func BenchmarkBatchMutateWrite(b *testing.B) {
+	b.StopTimer()
+	args := newBenchmarkBatchMutateArgs()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+
+		if err := args.Write(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkBatchMutateRead(b *testing.B) {
+	b.StopTimer()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := newBenchmarkBatchMutateArgs().Write(protocol); err != nil {
+		b.Fatal(err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+
+		if err := NewBatchMutateArgs().Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+// Reads into the same struct each time, as a pooling processor would.
+func BenchmarkBatchMutateReadReset(b *testing.B) {
+	b.StopTimer()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := newBenchmarkBatchMutateArgs().Write(protocol); err != nil {
+		b.Fatal(err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+	args := NewBatchMutateArgs()
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+		args.Reset()
+
+		if err := args.Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+// Writes into a fresh buffer each time, as a client sending one request per
+// connection would, with and without presizing it from BinarySize().
+func benchmarkBatchMutateWriteFresh(b *testing.B, presize bool) {
+	b.StopTimer()
+	args := newBenchmarkBatchMutateArgs()
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		protocol := thrift.NewTBinaryProtocolTransport(thrift.NewTMemoryBuffer())
+
+		if presize {
+			thrift.GrowForWrite(protocol, args)
+		}
+
+		if err := args.Write(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func BenchmarkBatchMutateWriteFresh(b *testing.B) {
+	benchmarkBatchMutateWriteFresh(b, false)
+}
+
+func BenchmarkBatchMutateWritePresized(b *testing.B) {
+	benchmarkBatchMutateWriteFresh(b, true)
+}
+
+// The []*KeySlice counterpart of the benchmark in value_lists_test.go.
+func BenchmarkGetRangeSlicesRead(b *testing.B) {
+	b.StopTimer()
+	slices := make([]*KeySlice, 0, 10000)
+
+	for row := 0; row < cap(slices); row++ {
+		column := NewColumn()
+		column.Name = []byte("column")
+		column.Value = []byte(fmt.Sprintf("value-%d", row))
+		column.Timestamp = int64(row)
+		columnOrSuperColumn := NewColumnOrSuperColumn()
+		columnOrSuperColumn.Column = column
+		slice := NewKeySlice()
+		slice.Key = []byte(fmt.Sprintf("row-%d", row))
+		slice.Columns = []*ColumnOrSuperColumn{columnOrSuperColumn}
+		slices = append(slices, slice)
+	}
+
+	result := NewGetRangeSlicesResult()
+	result.Success = slices
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := result.Write(protocol); err != nil {
+		b.Fatal(err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+
+		if err := NewGetRangeSlicesResult().Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
@@ -0,0 +1,111 @@
+package cassandra
+
+import (
+	"fmt"
+	"reflect"
+	"testing"
+	"thrift"
+)
+
+// These tests are compiled against the output of
+// "--gen go:native_containers,value_lists", under which a list<KeySlice> is
+// a []KeySlice.  BenchmarkGetRangeSlicesRead has a counterpart in
+// native_containers_test.go for the []*KeySlice of "--gen
+// go:native_containers".
+
+const benchmarkRangeSliceRows = 10000
+
+func newBenchmarkGetRangeSlicesResult(rows int) *GetRangeSlicesResult {
+	slices := make([]KeySlice, 0, rows)
+
+	for row := 0; row < rows; row++ {
+		column := NewColumn()
+		column.Name = []byte("column")
+		column.Value = []byte(fmt.Sprintf("value-%d", row))
+		column.Timestamp = int64(row)
+		columnOrSuperColumn := NewColumnOrSuperColumn()
+		columnOrSuperColumn.Column = column
+		slice := NewKeySlice()
+		slice.Key = []byte(fmt.Sprintf("row-%d", row))
+		slice.Columns = []ColumnOrSuperColumn{*columnOrSuperColumn}
+		slices = append(slices, *slice)
+	}
+
+	result := NewGetRangeSlicesResult()
+	result.Success = slices
+	return result
+}
+
+func TestValueListsRoundTrip(t *testing.T) {
+	in := newBenchmarkGetRangeSlicesResult(100)
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := in.Write(protocol); err != nil {
+		t.Fatalf("Could not write result due to '%q'.", err)
+	}
+
+	if wire := in.MarshalBinaryThrift(nil); in.BinarySize() != len(wire) || !reflect.DeepEqual(wire, buffer.Bytes()) {
+		t.Errorf("in.MarshalBinaryThrift() does not match in.Write().")
+	}
+
+	out := NewGetRangeSlicesResult()
+
+	if err := out.Read(protocol); err != nil {
+		t.Fatalf("Could not read result due to '%q'.", err)
+	}
+
+	if !reflect.DeepEqual(in.Success, out.Success) {
+		t.Errorf("in.Success (%v) != out.Success (%v).", in.Success, out.Success)
+	}
+
+	decoded := NewGetRangeSlicesResult()
+
+	if err := decoded.UnmarshalCompactThrift(in.MarshalCompactThrift(nil)); err != nil {
+		t.Fatalf("Could not decode result due to '%q'.", err)
+	}
+
+	if !reflect.DeepEqual(in.Success, decoded.Success) {
+		t.Errorf("in.Success (%v) != decoded.Success (%v).", in.Success, decoded.Success)
+	}
+}
+
+func TestValueListsReadInPlace(t *testing.T) {
+	wire := newBenchmarkGetRangeSlicesResult(100).MarshalBinaryThrift(nil)
+	out := NewGetRangeSlicesResult()
+	out.UnmarshalBinaryThrift(wire)
+	first := &out.Success[0]
+	out.Reset()
+
+	if err := out.UnmarshalBinaryThrift(wire); err != nil {
+		t.Fatalf("Could not decode result due to '%q'.", err)
+	}
+
+	if len(out.Success) != 100 || &out.Success[0] != first {
+		t.Errorf("out.Success was not read back into its own backing array.")
+	}
+}
+
+func BenchmarkGetRangeSlicesRead(b *testing.B) {
+	b.StopTimer()
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolFactoryDefault().GetProtocol(buffer)
+
+	if err := newBenchmarkGetRangeSlicesResult(benchmarkRangeSliceRows).Write(protocol); err != nil {
+		b.Fatal(err)
+	}
+
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.ReportAllocs()
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+
+		if err := NewGetRangeSlicesResult().Read(protocol); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
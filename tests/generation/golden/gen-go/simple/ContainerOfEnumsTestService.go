@@ -25,7 +25,12 @@ type IContainerOfEnumsTestService interface {
 	 * Parameters:
 	 *  - Message
 	 */
-	Echo(message *ContainerOfEnums) (retval18 *ContainerOfEnums, err error)
+	Echo(message *ContainerOfEnums) (retval130 *ContainerOfEnums, err error)
+	/**
+	 * Parameters:
+	 *  - Message
+	 */
+	Notify(message *ContainerOfEnums) (err error)
 }
 
 type ContainerOfEnumsTestServiceClient struct {
@@ -58,7 +63,7 @@ func NewContainerOfEnumsTestServiceClientProtocol(t thrift.TTransport, iprot thr
  * Parameters:
  *  - Message
  */
-func (p *ContainerOfEnumsTestServiceClient) Echo(message *ContainerOfEnums) (retval19 *ContainerOfEnums, err error) {
+func (p *ContainerOfEnumsTestServiceClient) Echo(message *ContainerOfEnums) (retval132 *ContainerOfEnums, err error) {
 	err = p.SendEcho(message)
 	if err != nil {
 		return
@@ -74,9 +79,10 @@ func (p *ContainerOfEnumsTestServiceClient) SendEcho(message *ContainerOfEnums)
 	}
 	p.SeqId++
 	oprot.WriteMessageBegin("echo", thrift.CALL, p.SeqId)
-	args20 := NewEchoArgs()
-	args20.Message = message
-	err = args20.Write(oprot)
+	args133 := NewEchoArgs()
+	args133.Message = message
+	thrift.GrowForWrite(oprot, args133)
+	err = args133.Write(oprot)
 	oprot.WriteMessageEnd()
 	oprot.Transport().Flush()
 	return
@@ -93,32 +99,133 @@ func (p *ContainerOfEnumsTestServiceClient) RecvEcho() (value *ContainerOfEnums,
 		return
 	}
 	if mTypeId == thrift.EXCEPTION {
-		error22 := thrift.NewTApplicationExceptionDefault()
-		var error23 error
-		error23, err = error22.Read(iprot)
+		error135 := thrift.NewTApplicationExceptionDefault()
+		var error136 error
+		error136, err = error135.Read(iprot)
+		if err != nil {
+			return
+		}
+		if err = iprot.ReadMessageEnd(); err != nil {
+			return
+		}
+		err = error136
+		return
+	}
+	if p.SeqId != seqId {
+		err = thrift.NewTApplicationException(thrift.BAD_SEQUENCE_ID, "ping failed: out of sequence response")
+		return
+	}
+	result134 := NewEchoResult()
+	err = result134.Read(iprot)
+	iprot.ReadMessageEnd()
+	value = result134.Success
+	return
+}
+
+/**
+ * Parameters:
+ *  - Message
+ */
+func (p *ContainerOfEnumsTestServiceClient) Notify(message *ContainerOfEnums) (err error) {
+	err = p.SendNotify(message)
+	if err != nil {
+		return
+	}
+	return
+}
+
+func (p *ContainerOfEnumsTestServiceClient) SendNotify(message *ContainerOfEnums) (err error) {
+	oprot := p.OutputProtocol
+	if oprot != nil {
+		oprot = p.ProtocolFactory.GetProtocol(p.Transport)
+		p.OutputProtocol = oprot
+	}
+	p.SeqId++
+	oprot.WriteMessageBegin("notify", thrift.CALL, p.SeqId)
+	args138 := NewNotifyArgs()
+	args138.Message = message
+	thrift.GrowForWrite(oprot, args138)
+	err = args138.Write(oprot)
+	oprot.WriteMessageEnd()
+	oprot.Transport().Flush()
+	return
+}
+
+func (p *ContainerOfEnumsTestServiceClient) RecvNotify() (err error) {
+	iprot := p.InputProtocol
+	if iprot == nil {
+		iprot = p.ProtocolFactory.GetProtocol(p.Transport)
+		p.InputProtocol = iprot
+	}
+	_, mTypeId, seqId, err := iprot.ReadMessageBegin()
+	if err != nil {
+		return
+	}
+	if mTypeId == thrift.EXCEPTION {
+		error140 := thrift.NewTApplicationExceptionDefault()
+		var error141 error
+		error141, err = error140.Read(iprot)
 		if err != nil {
 			return
 		}
 		if err = iprot.ReadMessageEnd(); err != nil {
 			return
 		}
-		err = error23
+		err = error141
 		return
 	}
 	if p.SeqId != seqId {
 		err = thrift.NewTApplicationException(thrift.BAD_SEQUENCE_ID, "ping failed: out of sequence response")
 		return
 	}
-	result21 := NewEchoResult()
-	err = result21.Read(iprot)
+	result139 := NewNotifyResult()
+	err = result139.Read(iprot)
 	iprot.ReadMessageEnd()
-	value = result21.Success
+	return
+}
+
+/**
+ * Shares one transport between any number of goroutines, which may each
+ * have a call to ContainerOfEnumsTestService outstanding at once.  maxInFlight, if
+ * greater than zero, bounds how many.
+ */
+type ContainerOfEnumsTestServiceConcurrentClient struct {
+	*thrift.TConcurrentClient
+}
+
+func NewContainerOfEnumsTestServiceConcurrentClient(t thrift.TTransport, f thrift.TProtocolFactory, maxInFlight int) *ContainerOfEnumsTestServiceConcurrentClient {
+	return &ContainerOfEnumsTestServiceConcurrentClient{thrift.NewTConcurrentClient(t, f, maxInFlight)}
+}
+
+/**
+ * Parameters:
+ *  - Message
+ */
+func (p *ContainerOfEnumsTestServiceConcurrentClient) Echo(message *ContainerOfEnums) (retval144 *ContainerOfEnums, err error) {
+	args142 := NewEchoArgs()
+	args142.Message = message
+	result143 := NewEchoResult()
+	if err = p.Call("echo", args142, result143); err != nil {
+		return
+	}
+	return result143.Success, nil
+}
+
+/**
+ * Parameters:
+ *  - Message
+ */
+func (p *ContainerOfEnumsTestServiceConcurrentClient) Notify(message *ContainerOfEnums) (err error) {
+	args145 := NewNotifyArgs()
+	args145.Message = message
+	err = p.Call("notify", args145, nil)
 	return
 }
 
 type ContainerOfEnumsTestServiceProcessor struct {
 	handler      IContainerOfEnumsTestService
 	processorMap map[string]thrift.TProcessorFunction
+	functions    [2]thrift.TProcessorFunction
 }
 
 func (p *ContainerOfEnumsTestServiceProcessor) Handler() IContainerOfEnumsTestService {
@@ -127,6 +234,9 @@ func (p *ContainerOfEnumsTestServiceProcessor) Handler() IContainerOfEnumsTestSe
 
 func (p *ContainerOfEnumsTestServiceProcessor) AddToProcessorMap(key string, processor thrift.TProcessorFunction) {
 	p.processorMap[key] = processor
+	if i := p.functionIndex(key); i >= 0 {
+		p.functions[i] = processor
+	}
 }
 
 func (p *ContainerOfEnumsTestServiceProcessor) GetProcessorFunction(key string) (processor thrift.TProcessorFunction, exists bool) {
@@ -138,40 +248,59 @@ func (p *ContainerOfEnumsTestServiceProcessor) ProcessorMap() map[string]thrift.
 	return p.processorMap
 }
 
+func (p *ContainerOfEnumsTestServiceProcessor) functionIndex(name string) int {
+	switch name {
+	case "echo":
+		return 0
+	case "notify":
+		return 1
+	}
+	return -1
+}
+
 func NewContainerOfEnumsTestServiceProcessor(handler IContainerOfEnumsTestService) *ContainerOfEnumsTestServiceProcessor {
 
-	self24 := &ContainerOfEnumsTestServiceProcessor{handler: handler, processorMap: make(map[string]thrift.TProcessorFunction)}
-	self24.processorMap["echo"] = &containerOfEnumsTestServiceProcessorEcho{handler: handler}
-	return self24
+	self148 := &ContainerOfEnumsTestServiceProcessor{handler: handler, processorMap: make(map[string]thrift.TProcessorFunction)}
+	pool149 := thrift.PoolsArgs(handler)
+	self148.AddToProcessorMap("echo", &containerOfEnumsTestServiceProcessorEcho{handler: handler, pool: pool149})
+	self148.AddToProcessorMap("notify", &containerOfEnumsTestServiceProcessorNotify{handler: handler, pool: pool149})
+	return self148
 }
 
 func (p *ContainerOfEnumsTestServiceProcessor) Process(iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {
-	name, _, seqId, err := iprot.ReadMessageBegin()
+	name150, _, seqId, err := thrift.ReadMessageBeginBytes(iprot)
 	if err != nil {
 		return
 	}
-	process, nameFound := p.GetProcessorFunction(name)
+	if i := p.functionIndex(string(name150)); i >= 0 && p.functions[i] != nil {
+		return p.functions[i].Process(seqId, iprot, oprot)
+	}
+	process, nameFound := p.processorMap[string(name150)]
 	if !nameFound || process == nil {
+		name := string(name150)
 		iprot.Skip(thrift.STRUCT)
 		iprot.ReadMessageEnd()
-		x25 := thrift.NewTApplicationException(thrift.UNKNOWN_METHOD, "Unknown function "+name)
+		x151 := thrift.NewTApplicationException(thrift.UNKNOWN_METHOD, "Unknown function "+name)
 		oprot.WriteMessageBegin(name, thrift.EXCEPTION, seqId)
-		x25.Write(oprot)
+		x151.Write(oprot)
 		oprot.WriteMessageEnd()
 		oprot.Transport().Flush()
-		return false, x25
+		return false, x151
 	}
 	return process.Process(seqId, iprot, oprot)
 }
 
+var echoArgsPool = thrift.NewTStructPool(func() interface{} { return NewEchoArgs() })
+var echoResultPool = thrift.NewTStructPool(func() interface{} { return NewEchoResult() })
+
 type containerOfEnumsTestServiceProcessorEcho struct {
 	handler IContainerOfEnumsTestService
+	pool    bool
 }
 
 func (p *containerOfEnumsTestServiceProcessorEcho) Process(seqId int32, iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {
-	args := NewEchoArgs()
-	if err = args.Read(iprot); err != nil {
-		iprot.ReadMessageEnd()
+	args, err := p.ReadArgs(iprot)
+	if err != nil {
 		x := thrift.NewTApplicationException(thrift.PROTOCOL_ERROR, err.Error())
 		oprot.WriteMessageBegin("echo", thrift.EXCEPTION, seqId)
 		x.Write(oprot)
@@ -179,8 +308,42 @@ func (p *containerOfEnumsTestServiceProcessorEcho) Process(seqId int32, iprot, o
 		oprot.Transport().Flush()
 		return
 	}
+	return p.ProcessArgs(seqId, args, oprot)
+}
+
+func (p *containerOfEnumsTestServiceProcessorEcho) IsOneway() bool {
+	return false
+}
+
+func (p *containerOfEnumsTestServiceProcessorEcho) ReadArgs(iprot thrift.TProtocol) (interface{}, thrift.TProtocolException) {
+	var args *EchoArgs
+	if p.pool {
+		args = echoArgsPool.Get().(*EchoArgs)
+	} else {
+		args = NewEchoArgs()
+	}
+	if err := args.Read(iprot); err != nil {
+		iprot.ReadMessageEnd()
+		return nil, err
+	}
 	iprot.ReadMessageEnd()
-	result := NewEchoResult()
+	return args, nil
+}
+
+func (p *containerOfEnumsTestServiceProcessorEcho) ProcessArgs(seqId int32, a interface{}, oprot thrift.TProtocol) (success bool, err thrift.TException) {
+	args := a.(*EchoArgs)
+	var result *EchoResult
+	if p.pool {
+		result = echoResultPool.Get().(*EchoResult)
+		defer func() {
+			args.Reset()
+			echoArgsPool.Put(args)
+			*result = EchoResult{TStruct: echoResultTStruct}
+			echoResultPool.Put(result)
+		}()
+	} else {
+		result = NewEchoResult()
+	}
 	if result.Success, err = p.handler.Echo(args.Message); err != nil {
 		x := thrift.NewTApplicationException(thrift.INTERNAL_ERROR, "Internal error processing echo: "+err.Error())
 		oprot.WriteMessageBegin("echo", thrift.EXCEPTION, seqId)
@@ -192,6 +355,7 @@ func (p *containerOfEnumsTestServiceProcessorEcho) Process(seqId int32, iprot, o
 	if err2 := oprot.WriteMessageBegin("echo", thrift.REPLY, seqId); err2 != nil {
 		err = err2
 	}
+	thrift.GrowForWrite(oprot, result)
 	if err2 := result.Write(oprot); err == nil && err2 != nil {
 		err = err2
 	}
@@ -207,6 +371,59 @@ func (p *containerOfEnumsTestServiceProcessorEcho) Process(seqId int32, iprot, o
 	return true, err
 }
 
+var notifyArgsPool = thrift.NewTStructPool(func() interface{} { return NewNotifyArgs() })
+
+type containerOfEnumsTestServiceProcessorNotify struct {
+	handler IContainerOfEnumsTestService
+	pool    bool
+}
+
+func (p *containerOfEnumsTestServiceProcessorNotify) Process(seqId int32, iprot, oprot thrift.TProtocol) (success bool, err thrift.TException) {
+	args, err := p.ReadArgs(iprot)
+	if err != nil {
+		x := thrift.NewTApplicationException(thrift.PROTOCOL_ERROR, err.Error())
+		oprot.WriteMessageBegin("notify", thrift.EXCEPTION, seqId)
+		x.Write(oprot)
+		oprot.WriteMessageEnd()
+		oprot.Transport().Flush()
+		return
+	}
+	return p.ProcessArgs(seqId, args, oprot)
+}
+
+func (p *containerOfEnumsTestServiceProcessorNotify) IsOneway() bool {
+	return true
+}
+
+func (p *containerOfEnumsTestServiceProcessorNotify) ReadArgs(iprot thrift.TProtocol) (interface{}, thrift.TProtocolException) {
+	var args *NotifyArgs
+	if p.pool {
+		args = notifyArgsPool.Get().(*NotifyArgs)
+	} else {
+		args = NewNotifyArgs()
+	}
+	if err := args.Read(iprot); err != nil {
+		iprot.ReadMessageEnd()
+		return nil, err
+	}
+	iprot.ReadMessageEnd()
+	return args, nil
+}
+
+func (p *containerOfEnumsTestServiceProcessorNotify) ProcessArgs(seqId int32, a interface{}, oprot thrift.TProtocol) (success bool, err thrift.TException) {
+	args := a.(*NotifyArgs)
+	if p.pool {
+		defer func() {
+			args.Reset()
+			notifyArgsPool.Put(args)
+		}()
+	}
+	if err = p.handler.Notify(args.Message); err != nil {
+		return
+	}
+	return true, nil
+}
+
 // HELPER FUNCTIONS AND STRUCTURES
 
 /**
@@ -218,17 +435,23 @@ type EchoArgs struct {
 	Message *ContainerOfEnums "message" // 1
 }
 
+var echoArgsTStruct = thrift.NewTStruct("echo_args", []thrift.TField{
+	thrift.NewTField("message", thrift.STRUCT, 1),
+})
+
 func NewEchoArgs() *EchoArgs {
 	output := &EchoArgs{
-		TStruct: thrift.NewTStruct("echo_args", []thrift.TField{
-			thrift.NewTField("message", thrift.STRUCT, 1),
-		}),
+		TStruct: echoArgsTStruct,
 	}
 	{
 	}
 	return output
 }
 
+func (p *EchoArgs) Reset() {
+	*p = EchoArgs{TStruct: echoArgsTStruct}
+}
+
 func (p *EchoArgs) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
 	_, err = iprot.ReadStructBegin()
 	if err != nil {
@@ -238,8 +461,6 @@ func (p *EchoArgs) Read(iprot thrift.TProtocol) (err thrift.TProtocolException)
 		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
 		if fieldId < 0 {
 			fieldId = int16(p.FieldIdFromFieldName(fieldName))
-		} else if fieldName == "" {
-			fieldName = p.FieldNameFromFieldId(int(fieldId))
 		}
 		if fieldTypeId == thrift.GENERIC {
 			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
@@ -250,24 +471,17 @@ func (p *EchoArgs) Read(iprot thrift.TProtocol) (err thrift.TProtocolException)
 		if fieldTypeId == thrift.STOP {
 			break
 		}
-		if fieldId == 1 || fieldName == "message" {
-			if fieldTypeId == thrift.STRUCT {
-				err = p.ReadField1(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+		switch fieldId {
+		case 1:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField1(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
 			err = iprot.Skip(fieldTypeId)
 			if err != nil {
 				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
@@ -287,9 +501,9 @@ func (p *EchoArgs) Read(iprot thrift.TProtocol) (err thrift.TProtocolException)
 
 func (p *EchoArgs) ReadField1(iprot thrift.TProtocol) (err thrift.TProtocolException) {
 	p.Message = NewContainerOfEnums()
-	err28 := p.Message.Read(iprot)
-	if err28 != nil {
-		return thrift.NewTProtocolExceptionReadStruct("p.MessageContainerOfEnums", err28)
+	err154 := p.Message.Read(iprot)
+	if err154 != nil {
+		return thrift.NewTProtocolExceptionReadStruct("p.MessageContainerOfEnums", err154)
 	}
 	return err
 }
@@ -340,6 +554,99 @@ func (p *EchoArgs) WriteFieldMessage(oprot thrift.TProtocol) thrift.TProtocolExc
 	return p.WriteField1(oprot)
 }
 
+func (p *EchoArgs) BinarySize() int {
+	n := 0
+	if p.Message != nil {
+		n += 3
+		n += p.Message.BinarySize()
+	}
+	return n + 1
+}
+
+func (p *EchoArgs) MarshalBinaryThrift(buf []byte) []byte {
+	if p.Message != nil {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.STRUCT, 1)
+		buf = p.Message.MarshalBinaryThrift(buf)
+	}
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *EchoArgs) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *EchoArgs) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.STRUCT:
+			p.Message = NewContainerOfEnums()
+			if err := p.Message.DecodeBinaryThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *EchoArgs) CompactSize() int {
+	n := 0
+	if p.Message != nil {
+		n += 1
+		n += p.Message.CompactSize()
+	}
+	return n + 1
+}
+
+func (p *EchoArgs) MarshalCompactThrift(buf []byte) []byte {
+	if p.Message != nil {
+		buf = append(buf, 0x1c)
+		buf = p.Message.MarshalCompactThrift(buf)
+	}
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *EchoArgs) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *EchoArgs) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.STRUCT:
+			p.Message = NewContainerOfEnums()
+			if err := p.Message.DecodeCompactThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
 func (p *EchoArgs) TStructName() string {
 	return "EchoArgs"
 }
@@ -355,6 +662,21 @@ func (p *EchoArgs) String() string {
 	return fmt.Sprintf("EchoArgs(%+v)", *p)
 }
 
+func (p *EchoArgs) Equals(other interface{}) bool {
+	data, ok := other.(*EchoArgs)
+	return ok && p.EqualsT(data)
+}
+
+func (p *EchoArgs) EqualsT(other *EchoArgs) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if !p.Message.EqualsT(other.Message) {
+		return false
+	}
+	return true
+}
+
 func (p *EchoArgs) CompareTo(other interface{}) (int, bool) {
 	if other == nil {
 		return 1, true
@@ -363,7 +685,28 @@ func (p *EchoArgs) CompareTo(other interface{}) (int, bool) {
 	if !ok {
 		return 0, false
 	}
-	return thrift.TType(thrift.STRUCT).Compare(p, data)
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if c, ok := p.Message.CompareTo(data.Message); c != 0 || !ok {
+		return c, ok
+	}
+	return 0, true
+}
+
+func (p *EchoArgs) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	h = thrift.HashUint64(h, p.Message.Hash64())
+	return h
 }
 
 func (p *EchoArgs) AttributeByFieldId(id int) interface{} {
@@ -377,9 +720,7 @@ func (p *EchoArgs) AttributeByFieldId(id int) interface{} {
 }
 
 func (p *EchoArgs) TStructFields() thrift.TFieldContainer {
-	return thrift.NewTFieldContainer([]thrift.TField{
-		thrift.NewTField("message", thrift.STRUCT, 1),
-	})
+	return echoArgsTStruct.TStructFields()
 }
 
 /**
@@ -391,17 +732,23 @@ type EchoResult struct {
 	Success *ContainerOfEnums "success" // 0
 }
 
+var echoResultTStruct = thrift.NewTStruct("echo_result", []thrift.TField{
+	thrift.NewTField("success", thrift.STRUCT, 0),
+})
+
 func NewEchoResult() *EchoResult {
 	output := &EchoResult{
-		TStruct: thrift.NewTStruct("echo_result", []thrift.TField{
-			thrift.NewTField("success", thrift.STRUCT, 0),
-		}),
+		TStruct: echoResultTStruct,
 	}
 	{
 	}
 	return output
 }
 
+func (p *EchoResult) Reset() {
+	*p = EchoResult{TStruct: echoResultTStruct}
+}
+
 func (p *EchoResult) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
 	_, err = iprot.ReadStructBegin()
 	if err != nil {
@@ -411,8 +758,6 @@ func (p *EchoResult) Read(iprot thrift.TProtocol) (err thrift.TProtocolException
 		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
 		if fieldId < 0 {
 			fieldId = int16(p.FieldIdFromFieldName(fieldName))
-		} else if fieldName == "" {
-			fieldName = p.FieldNameFromFieldId(int(fieldId))
 		}
 		if fieldTypeId == thrift.GENERIC {
 			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
@@ -423,24 +768,17 @@ func (p *EchoResult) Read(iprot thrift.TProtocol) (err thrift.TProtocolException
 		if fieldTypeId == thrift.STOP {
 			break
 		}
-		if fieldId == 0 || fieldName == "success" {
-			if fieldTypeId == thrift.STRUCT {
-				err = p.ReadField0(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+		switch fieldId {
+		case 0:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField0(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(0, "success", p.ThriftName(), err)
+			}
+		default:
 			err = iprot.Skip(fieldTypeId)
 			if err != nil {
 				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
@@ -460,9 +798,9 @@ func (p *EchoResult) Read(iprot thrift.TProtocol) (err thrift.TProtocolException
 
 func (p *EchoResult) ReadField0(iprot thrift.TProtocol) (err thrift.TProtocolException) {
 	p.Success = NewContainerOfEnums()
-	err31 := p.Success.Read(iprot)
-	if err31 != nil {
-		return thrift.NewTProtocolExceptionReadStruct("p.SuccessContainerOfEnums", err31)
+	err157 := p.Success.Read(iprot)
+	if err157 != nil {
+		return thrift.NewTProtocolExceptionReadStruct("p.SuccessContainerOfEnums", err157)
 	}
 	return err
 }
@@ -515,6 +853,111 @@ func (p *EchoResult) WriteFieldSuccess(oprot thrift.TProtocol) thrift.TProtocolE
 	return p.WriteField0(oprot)
 }
 
+func (p *EchoResult) BinarySize() int {
+	n := 0
+	switch {
+	default:
+		if p.Success != nil {
+			n += 3
+			n += p.Success.BinarySize()
+		}
+	}
+	return n + 1
+}
+
+func (p *EchoResult) MarshalBinaryThrift(buf []byte) []byte {
+	switch {
+	default:
+		if p.Success != nil {
+			buf = thrift.AppendBinaryFieldBegin(buf, thrift.STRUCT, 0)
+			buf = p.Success.MarshalBinaryThrift(buf)
+		}
+	}
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *EchoResult) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *EchoResult) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 0 && fieldTypeId == thrift.STRUCT:
+			p.Success = NewContainerOfEnums()
+			if err := p.Success.DecodeBinaryThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(0, "success", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *EchoResult) CompactSize() int {
+	n := 0
+	switch {
+	default:
+		if p.Success != nil {
+			n += 2
+			n += p.Success.CompactSize()
+		}
+	}
+	return n + 1
+}
+
+func (p *EchoResult) MarshalCompactThrift(buf []byte) []byte {
+	switch {
+	default:
+		if p.Success != nil {
+			buf = append(buf, 0x0c, 0x00)
+			buf = p.Success.MarshalCompactThrift(buf)
+		}
+	}
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *EchoResult) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *EchoResult) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 0 && fieldTypeId == thrift.STRUCT:
+			p.Success = NewContainerOfEnums()
+			if err := p.Success.DecodeCompactThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(0, "success", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
 func (p *EchoResult) TStructName() string {
 	return "EchoResult"
 }
@@ -530,6 +973,21 @@ func (p *EchoResult) String() string {
 	return fmt.Sprintf("EchoResult(%+v)", *p)
 }
 
+func (p *EchoResult) Equals(other interface{}) bool {
+	data, ok := other.(*EchoResult)
+	return ok && p.EqualsT(data)
+}
+
+func (p *EchoResult) EqualsT(other *EchoResult) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if !p.Success.EqualsT(other.Success) {
+		return false
+	}
+	return true
+}
+
 func (p *EchoResult) CompareTo(other interface{}) (int, bool) {
 	if other == nil {
 		return 1, true
@@ -538,10 +996,31 @@ func (p *EchoResult) CompareTo(other interface{}) (int, bool) {
 	if !ok {
 		return 0, false
 	}
-	return thrift.TType(thrift.STRUCT).Compare(p, data)
-}
-
-func (p *EchoResult) AttributeByFieldId(id int) interface{} {
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if c, ok := p.Success.CompareTo(data.Success); c != 0 || !ok {
+		return c, ok
+	}
+	return 0, true
+}
+
+func (p *EchoResult) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	h = thrift.HashUint64(h, p.Success.Hash64())
+	return h
+}
+
+func (p *EchoResult) AttributeByFieldId(id int) interface{} {
 	switch id {
 	default:
 		return nil
@@ -552,7 +1031,509 @@ func (p *EchoResult) AttributeByFieldId(id int) interface{} {
 }
 
 func (p *EchoResult) TStructFields() thrift.TFieldContainer {
-	return thrift.NewTFieldContainer([]thrift.TField{
-		thrift.NewTField("success", thrift.STRUCT, 0),
-	})
+	return echoResultTStruct.TStructFields()
+}
+
+/**
+ * Attributes:
+ *  - Message
+ */
+type NotifyArgs struct {
+	thrift.TStruct
+	Message *ContainerOfEnums "message" // 1
+}
+
+var notifyArgsTStruct = thrift.NewTStruct("notify_args", []thrift.TField{
+	thrift.NewTField("message", thrift.STRUCT, 1),
+})
+
+func NewNotifyArgs() *NotifyArgs {
+	output := &NotifyArgs{
+		TStruct: notifyArgsTStruct,
+	}
+	{
+	}
+	return output
+}
+
+func (p *NotifyArgs) Reset() {
+	*p = NotifyArgs{TStruct: notifyArgsTStruct}
+}
+
+func (p *NotifyArgs) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_, err = iprot.ReadStructBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	for {
+		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
+		if fieldId < 0 {
+			fieldId = int16(p.FieldIdFromFieldName(fieldName))
+		}
+		if fieldTypeId == thrift.GENERIC {
+			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
+		}
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch fieldId {
+		case 1:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField1(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
+			err = iprot.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+			}
+		}
+		err = iprot.ReadFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+	}
+	err = iprot.ReadStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *NotifyArgs) ReadField1(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	p.Message = NewContainerOfEnums()
+	err160 := p.Message.Read(iprot)
+	if err160 != nil {
+		return thrift.NewTProtocolExceptionReadStruct("p.MessageContainerOfEnums", err160)
+	}
+	return err
+}
+
+func (p *NotifyArgs) ReadFieldMessage(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField1(iprot)
+}
+
+func (p *NotifyArgs) Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteStructBegin("notify_args")
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	err = p.WriteField1(oprot)
+	if err != nil {
+		return err
+	}
+	err = oprot.WriteFieldStop()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(-1, "STOP", p.ThriftName(), err)
+	}
+	err = oprot.WriteStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *NotifyArgs) WriteField1(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	if p.Message != nil {
+		err = oprot.WriteFieldBegin("message", thrift.STRUCT, 1)
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(1, "message", p.ThriftName(), err)
+		}
+		err = p.Message.Write(oprot)
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteStruct("ContainerOfEnums", err)
+		}
+		err = oprot.WriteFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(1, "message", p.ThriftName(), err)
+		}
+	}
+	return err
+}
+
+func (p *NotifyArgs) WriteFieldMessage(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField1(oprot)
+}
+
+func (p *NotifyArgs) BinarySize() int {
+	n := 0
+	if p.Message != nil {
+		n += 3
+		n += p.Message.BinarySize()
+	}
+	return n + 1
+}
+
+func (p *NotifyArgs) MarshalBinaryThrift(buf []byte) []byte {
+	if p.Message != nil {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.STRUCT, 1)
+		buf = p.Message.MarshalBinaryThrift(buf)
+	}
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *NotifyArgs) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *NotifyArgs) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.STRUCT:
+			p.Message = NewContainerOfEnums()
+			if err := p.Message.DecodeBinaryThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *NotifyArgs) CompactSize() int {
+	n := 0
+	if p.Message != nil {
+		n += 1
+		n += p.Message.CompactSize()
+	}
+	return n + 1
+}
+
+func (p *NotifyArgs) MarshalCompactThrift(buf []byte) []byte {
+	if p.Message != nil {
+		buf = append(buf, 0x1c)
+		buf = p.Message.MarshalCompactThrift(buf)
+	}
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *NotifyArgs) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *NotifyArgs) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.STRUCT:
+			p.Message = NewContainerOfEnums()
+			if err := p.Message.DecodeCompactThrift(d); err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "message", p.ThriftName(), err)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *NotifyArgs) TStructName() string {
+	return "NotifyArgs"
+}
+
+func (p *NotifyArgs) ThriftName() string {
+	return "notify_args"
+}
+
+func (p *NotifyArgs) String() string {
+	if p == nil {
+		return "<nil>"
+	}
+	return fmt.Sprintf("NotifyArgs(%+v)", *p)
+}
+
+func (p *NotifyArgs) Equals(other interface{}) bool {
+	data, ok := other.(*NotifyArgs)
+	return ok && p.EqualsT(data)
+}
+
+func (p *NotifyArgs) EqualsT(other *NotifyArgs) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if !p.Message.EqualsT(other.Message) {
+		return false
+	}
+	return true
+}
+
+func (p *NotifyArgs) CompareTo(other interface{}) (int, bool) {
+	if other == nil {
+		return 1, true
+	}
+	data, ok := other.(*NotifyArgs)
+	if !ok {
+		return 0, false
+	}
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if c, ok := p.Message.CompareTo(data.Message); c != 0 || !ok {
+		return c, ok
+	}
+	return 0, true
+}
+
+func (p *NotifyArgs) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	h = thrift.HashUint64(h, p.Message.Hash64())
+	return h
+}
+
+func (p *NotifyArgs) AttributeByFieldId(id int) interface{} {
+	switch id {
+	default:
+		return nil
+	case 1:
+		return p.Message
+	}
+	return nil
+}
+
+func (p *NotifyArgs) TStructFields() thrift.TFieldContainer {
+	return notifyArgsTStruct.TStructFields()
+}
+
+type NotifyResult struct {
+	thrift.TStruct
+}
+
+var notifyResultTStruct = thrift.NewTStruct("notify_result", []thrift.TField{})
+
+func NewNotifyResult() *NotifyResult {
+	output := &NotifyResult{
+		TStruct: notifyResultTStruct,
+	}
+	{
+	}
+	return output
+}
+
+func (p *NotifyResult) Reset() {
+	*p = NotifyResult{TStruct: notifyResultTStruct}
+}
+
+func (p *NotifyResult) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_, err = iprot.ReadStructBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	for {
+		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
+		if fieldId < 0 {
+			fieldId = int16(p.FieldIdFromFieldName(fieldName))
+		}
+		if fieldTypeId == thrift.GENERIC {
+			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
+		}
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch fieldId {
+		default:
+			err = iprot.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+			}
+		}
+		err = iprot.ReadFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+	}
+	err = iprot.ReadStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *NotifyResult) Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteStructBegin("notify_result")
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldStop()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(-1, "STOP", p.ThriftName(), err)
+	}
+	err = oprot.WriteStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *NotifyResult) BinarySize() int {
+	n := 0
+	return n + 1
+}
+
+func (p *NotifyResult) MarshalBinaryThrift(buf []byte) []byte {
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *NotifyResult) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *NotifyResult) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *NotifyResult) CompactSize() int {
+	n := 0
+	return n + 1
+}
+
+func (p *NotifyResult) MarshalCompactThrift(buf []byte) []byte {
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *NotifyResult) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *NotifyResult) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *NotifyResult) TStructName() string {
+	return "NotifyResult"
+}
+
+func (p *NotifyResult) ThriftName() string {
+	return "notify_result"
+}
+
+func (p *NotifyResult) String() string {
+	if p == nil {
+		return "<nil>"
+	}
+	return fmt.Sprintf("NotifyResult(%+v)", *p)
+}
+
+func (p *NotifyResult) Equals(other interface{}) bool {
+	data, ok := other.(*NotifyResult)
+	return ok && p.EqualsT(data)
+}
+
+func (p *NotifyResult) EqualsT(other *NotifyResult) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	return true
+}
+
+func (p *NotifyResult) CompareTo(other interface{}) (int, bool) {
+	if other == nil {
+		return 1, true
+	}
+	data, ok := other.(*NotifyResult)
+	if !ok {
+		return 0, false
+	}
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	return 0, true
+}
+
+func (p *NotifyResult) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	return h
+}
+
+func (p *NotifyResult) AttributeByFieldId(id int) interface{} {
+	switch id {
+	default:
+		return nil
+	}
+	return nil
+}
+
+func (p *NotifyResult) TStructFields() thrift.TFieldContainer {
+	return notifyResultTStruct.TStructFields()
 }
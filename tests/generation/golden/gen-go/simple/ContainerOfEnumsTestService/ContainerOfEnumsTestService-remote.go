@@ -20,7 +20,8 @@ func Usage() {
 	fmt.Fprint(os.Stderr, "Usage of ", os.Args[0], " [-h host:port] [-u url] [-f[ramed]] function [arg1 [arg2...]]:\n")
 	flag.PrintDefaults()
 	fmt.Fprint(os.Stderr, "Functions:\n")
-	fmt.Fprint(os.Stderr, "  echo(message *ContainerOfEnums) (retval32 *ContainerOfEnums, err error)\n")
+	fmt.Fprint(os.Stderr, "  echo(message *ContainerOfEnums) (retval161 *ContainerOfEnums, err error)\n")
+	fmt.Fprint(os.Stderr, "  notify(message *ContainerOfEnums) (err error)\n")
 	fmt.Fprint(os.Stderr, "\n")
 	os.Exit(0)
 }
@@ -32,6 +33,7 @@ func main() {
 	var protocol string
 	var urlString string
 	var framed bool
+	var buffered bool
 	var useHttp bool
 	var help bool
 	var parsedUrl url.URL
@@ -42,6 +44,7 @@ func main() {
 	flag.StringVar(&protocol, "P", "binary", "Specify the protocol (binary, compact, simplejson, json)")
 	flag.StringVar(&urlString, "u", "", "Specify the url")
 	flag.BoolVar(&framed, "framed", false, "Use framed transport")
+	flag.BoolVar(&buffered, "buffered", true, "Buffer reads and writes to the socket")
 	flag.BoolVar(&useHttp, "http", false, "Use http")
 	flag.BoolVar(&help, "help", false, "See usage string")
 	flag.Parse()
@@ -76,6 +79,9 @@ func main() {
 			os.Exit(1)
 		}
 		trans, err = thrift.NewTNonblockingSocketAddr(addr)
+		if buffered {
+			trans = thrift.NewTBufferedTransport(trans, 0, 0)
+		}
 		if framed {
 			trans = thrift.NewTFramedTransport(trans)
 		}
@@ -116,19 +122,19 @@ func main() {
 			fmt.Fprint(os.Stderr, "Echo requires 1 args\n")
 			flag.Usage()
 		}
-		arg33 := flag.Arg(1)
-		mbTrans34 := thrift.NewTMemoryBufferLen(len(arg33))
-		defer mbTrans34.Close()
-		_, err35 := mbTrans34.WriteString(arg33)
-		if err35 != nil {
+		arg163 := flag.Arg(1)
+		mbTrans164 := thrift.NewTMemoryBufferLen(len(arg163))
+		defer mbTrans164.Close()
+		_, err165 := mbTrans164.WriteString(arg163)
+		if err165 != nil {
 			Usage()
 			return
 		}
-		factory36 := thrift.NewTSimpleJSONProtocolFactory()
-		jsProt37 := factory36.GetProtocol(mbTrans34)
+		factory166 := thrift.NewTSimpleJSONProtocolFactory()
+		jsProt167 := factory166.GetProtocol(mbTrans164)
 		argvalue0 := simple.NewContainerOfEnums()
-		err38 := argvalue0.Read(jsProt37)
-		if err38 != nil {
+		err168 := argvalue0.Read(jsProt167)
+		if err168 != nil {
 			Usage()
 			return
 		}
@@ -136,6 +142,31 @@ func main() {
 		fmt.Print(client.Echo(value0))
 		fmt.Print("\n")
 		break
+	case "notify":
+		if flag.NArg()-1 != 1 {
+			fmt.Fprint(os.Stderr, "Notify requires 1 args\n")
+			flag.Usage()
+		}
+		arg169 := flag.Arg(1)
+		mbTrans170 := thrift.NewTMemoryBufferLen(len(arg169))
+		defer mbTrans170.Close()
+		_, err171 := mbTrans170.WriteString(arg169)
+		if err171 != nil {
+			Usage()
+			return
+		}
+		factory172 := thrift.NewTSimpleJSONProtocolFactory()
+		jsProt173 := factory172.GetProtocol(mbTrans170)
+		argvalue0 := simple.NewContainerOfEnums()
+		err174 := argvalue0.Read(jsProt173)
+		if err174 != nil {
+			Usage()
+			return
+		}
+		value0 := argvalue0
+		fmt.Print(client.Notify(value0))
+		fmt.Print("\n")
+		break
 	case "":
 		Usage()
 		break
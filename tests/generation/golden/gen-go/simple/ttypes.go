@@ -170,19 +170,21 @@ type ContainerOfEnums struct {
 	DefaultNineth  HeterogeneousValues "default_nineth"  // 9
 }
 
+var containerOfEnumsTStruct = thrift.NewTStruct("ContainerOfEnums", []thrift.TField{
+	thrift.NewTField("first", thrift.I32, 1),
+	thrift.NewTField("second", thrift.I32, 2),
+	thrift.NewTField("third", thrift.I32, 3),
+	thrift.NewTField("optional_fourth", thrift.I32, 4),
+	thrift.NewTField("optional_fifth", thrift.I32, 5),
+	thrift.NewTField("optional_sixth", thrift.I32, 6),
+	thrift.NewTField("default_seventh", thrift.I32, 7),
+	thrift.NewTField("default_eighth", thrift.I32, 8),
+	thrift.NewTField("default_nineth", thrift.I32, 9),
+})
+
 func NewContainerOfEnums() *ContainerOfEnums {
 	output := &ContainerOfEnums{
-		TStruct: thrift.NewTStruct("ContainerOfEnums", []thrift.TField{
-			thrift.NewTField("first", thrift.I32, 1),
-			thrift.NewTField("second", thrift.I32, 2),
-			thrift.NewTField("third", thrift.I32, 3),
-			thrift.NewTField("optional_fourth", thrift.I32, 4),
-			thrift.NewTField("optional_fifth", thrift.I32, 5),
-			thrift.NewTField("optional_sixth", thrift.I32, 6),
-			thrift.NewTField("default_seventh", thrift.I32, 7),
-			thrift.NewTField("default_eighth", thrift.I32, 8),
-			thrift.NewTField("default_nineth", thrift.I32, 9),
-		}),
+		TStruct: containerOfEnumsTStruct,
 	}
 	{
 		output.First = math.MinInt32 - 1
@@ -198,6 +200,19 @@ func NewContainerOfEnums() *ContainerOfEnums {
 	return output
 }
 
+func (p *ContainerOfEnums) Reset() {
+	*p = ContainerOfEnums{TStruct: containerOfEnumsTStruct}
+	p.First = math.MinInt32 - 1
+	p.Second = math.MinInt32 - 1
+	p.Third = math.MinInt32 - 1
+	p.OptionalFourth = math.MinInt32 - 1
+	p.OptionalFifth = math.MinInt32 - 1
+	p.OptionalSixth = math.MinInt32 - 1
+	p.DefaultSeventh = 0
+	p.DefaultEighth = 1
+	p.DefaultNineth = 0
+}
+
 func (p *ContainerOfEnums) IsSetFirst() bool {
 	return int64(p.First) != math.MinInt32-1
 }
@@ -243,8 +258,6 @@ func (p *ContainerOfEnums) Read(iprot thrift.TProtocol) (err thrift.TProtocolExc
 		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
 		if fieldId < 0 {
 			fieldId = int16(p.FieldIdFromFieldName(fieldName))
-		} else if fieldName == "" {
-			fieldName = p.FieldNameFromFieldId(int(fieldId))
 		}
 		if fieldTypeId == thrift.GENERIC {
 			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
@@ -255,160 +268,89 @@ func (p *ContainerOfEnums) Read(iprot thrift.TProtocol) (err thrift.TProtocolExc
 		if fieldTypeId == thrift.STOP {
 			break
 		}
-		if fieldId == 1 || fieldName == "first" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField1(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+		switch fieldId {
+		case 1:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField1(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 2 || fieldName == "second" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField2(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "first", p.ThriftName(), err)
+			}
+		case 2:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField2(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 3 || fieldName == "third" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField3(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "second", p.ThriftName(), err)
+			}
+		case 3:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField3(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 4 || fieldName == "optional_fourth" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField4(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(3, "third", p.ThriftName(), err)
+			}
+		case 4:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField4(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 5 || fieldName == "optional_fifth" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField5(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(4, "optional_fourth", p.ThriftName(), err)
+			}
+		case 5:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField5(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 6 || fieldName == "optional_sixth" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField6(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "optional_fifth", p.ThriftName(), err)
+			}
+		case 6:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField6(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 7 || fieldName == "default_seventh" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField7(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(6, "optional_sixth", p.ThriftName(), err)
+			}
+		case 7:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField7(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 8 || fieldName == "default_eighth" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField8(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(7, "default_seventh", p.ThriftName(), err)
+			}
+		case 8:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField8(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else if fieldId == 9 || fieldName == "default_nineth" {
-			if fieldTypeId == thrift.I32 {
-				err = p.ReadField9(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
-			} else if fieldTypeId == thrift.VOID {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(8, "default_eighth", p.ThriftName(), err)
+			}
+		case 9:
+			if fieldTypeId == thrift.VOID {
 				err = iprot.Skip(fieldTypeId)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			} else {
 				err = p.ReadField9(iprot)
-				if err != nil {
-					return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
-				}
 			}
-		} else {
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "default_nineth", p.ThriftName(), err)
+			}
+		default:
 			err = iprot.Skip(fieldTypeId)
 			if err != nil {
 				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
@@ -793,6 +735,343 @@ func (p *ContainerOfEnums) WriteFieldDefaultNineth(oprot thrift.TProtocol) thrif
 	return p.WriteField9(oprot)
 }
 
+func (p *ContainerOfEnums) BinarySize() int {
+	n := 0
+	if p.IsSetFirst() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetSecond() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetThird() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetOptionalFourth() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetOptionalFifth() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetOptionalSixth() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetDefaultSeventh() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetDefaultEighth() {
+		n += 3
+		n += 4
+	}
+	if p.IsSetDefaultNineth() {
+		n += 3
+		n += 4
+	}
+	return n + 1
+}
+
+func (p *ContainerOfEnums) MarshalBinaryThrift(buf []byte) []byte {
+	if p.IsSetFirst() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 1)
+		buf = thrift.AppendBinaryI32(buf, int32(p.First))
+	}
+	if p.IsSetSecond() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 2)
+		buf = thrift.AppendBinaryI32(buf, int32(p.Second))
+	}
+	if p.IsSetThird() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 3)
+		buf = thrift.AppendBinaryI32(buf, int32(p.Third))
+	}
+	if p.IsSetOptionalFourth() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 4)
+		buf = thrift.AppendBinaryI32(buf, int32(p.OptionalFourth))
+	}
+	if p.IsSetOptionalFifth() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 5)
+		buf = thrift.AppendBinaryI32(buf, int32(p.OptionalFifth))
+	}
+	if p.IsSetOptionalSixth() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 6)
+		buf = thrift.AppendBinaryI32(buf, int32(p.OptionalSixth))
+	}
+	if p.IsSetDefaultSeventh() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 7)
+		buf = thrift.AppendBinaryI32(buf, int32(p.DefaultSeventh))
+	}
+	if p.IsSetDefaultEighth() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 8)
+		buf = thrift.AppendBinaryI32(buf, int32(p.DefaultEighth))
+	}
+	if p.IsSetDefaultNineth() {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 9)
+		buf = thrift.AppendBinaryI32(buf, int32(p.DefaultNineth))
+	}
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *ContainerOfEnums) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *ContainerOfEnums) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.I32:
+			v18, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "first", p.ThriftName(), err)
+			}
+			p.First = UndefinedValues(v18)
+		case fieldId == 2 && fieldTypeId == thrift.I32:
+			v19, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "second", p.ThriftName(), err)
+			}
+			p.Second = DefinedValues(v19)
+		case fieldId == 3 && fieldTypeId == thrift.I32:
+			v20, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(3, "third", p.ThriftName(), err)
+			}
+			p.Third = HeterogeneousValues(v20)
+		case fieldId == 4 && fieldTypeId == thrift.I32:
+			v21, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(4, "optional_fourth", p.ThriftName(), err)
+			}
+			p.OptionalFourth = UndefinedValues(v21)
+		case fieldId == 5 && fieldTypeId == thrift.I32:
+			v22, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "optional_fifth", p.ThriftName(), err)
+			}
+			p.OptionalFifth = DefinedValues(v22)
+		case fieldId == 6 && fieldTypeId == thrift.I32:
+			v23, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(6, "optional_sixth", p.ThriftName(), err)
+			}
+			p.OptionalSixth = HeterogeneousValues(v23)
+		case fieldId == 7 && fieldTypeId == thrift.I32:
+			v24, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(7, "default_seventh", p.ThriftName(), err)
+			}
+			p.DefaultSeventh = UndefinedValues(v24)
+		case fieldId == 8 && fieldTypeId == thrift.I32:
+			v25, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(8, "default_eighth", p.ThriftName(), err)
+			}
+			p.DefaultEighth = DefinedValues(v25)
+		case fieldId == 9 && fieldTypeId == thrift.I32:
+			v26, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "default_nineth", p.ThriftName(), err)
+			}
+			p.DefaultNineth = HeterogeneousValues(v26)
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *ContainerOfEnums) CompactSize() int {
+	n := 0
+	var lastFieldId int16
+	if p.IsSetFirst() {
+		n += 1
+		n += thrift.CompactI32Size(int32(p.First))
+		lastFieldId = 1
+	}
+	if p.IsSetSecond() {
+		n += thrift.CompactFieldBeginSize(2, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.Second))
+		lastFieldId = 2
+	}
+	if p.IsSetThird() {
+		n += thrift.CompactFieldBeginSize(3, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.Third))
+		lastFieldId = 3
+	}
+	if p.IsSetOptionalFourth() {
+		n += thrift.CompactFieldBeginSize(4, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.OptionalFourth))
+		lastFieldId = 4
+	}
+	if p.IsSetOptionalFifth() {
+		n += thrift.CompactFieldBeginSize(5, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.OptionalFifth))
+		lastFieldId = 5
+	}
+	if p.IsSetOptionalSixth() {
+		n += thrift.CompactFieldBeginSize(6, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.OptionalSixth))
+		lastFieldId = 6
+	}
+	if p.IsSetDefaultSeventh() {
+		n += thrift.CompactFieldBeginSize(7, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.DefaultSeventh))
+		lastFieldId = 7
+	}
+	if p.IsSetDefaultEighth() {
+		n += thrift.CompactFieldBeginSize(8, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.DefaultEighth))
+		lastFieldId = 8
+	}
+	if p.IsSetDefaultNineth() {
+		n += thrift.CompactFieldBeginSize(9, lastFieldId)
+		n += thrift.CompactI32Size(int32(p.DefaultNineth))
+	}
+	return n + 1
+}
+
+func (p *ContainerOfEnums) MarshalCompactThrift(buf []byte) []byte {
+	var lastFieldId int16
+	if p.IsSetFirst() {
+		buf = append(buf, 0x15)
+		buf = thrift.AppendCompactI32(buf, int32(p.First))
+		lastFieldId = 1
+	}
+	if p.IsSetSecond() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 2, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.Second))
+		lastFieldId = 2
+	}
+	if p.IsSetThird() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 3, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.Third))
+		lastFieldId = 3
+	}
+	if p.IsSetOptionalFourth() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 4, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.OptionalFourth))
+		lastFieldId = 4
+	}
+	if p.IsSetOptionalFifth() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 5, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.OptionalFifth))
+		lastFieldId = 5
+	}
+	if p.IsSetOptionalSixth() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 6, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.OptionalSixth))
+		lastFieldId = 6
+	}
+	if p.IsSetDefaultSeventh() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 7, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.DefaultSeventh))
+		lastFieldId = 7
+	}
+	if p.IsSetDefaultEighth() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 8, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.DefaultEighth))
+		lastFieldId = 8
+	}
+	if p.IsSetDefaultNineth() {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.I32, 9, lastFieldId)
+		buf = thrift.AppendCompactI32(buf, int32(p.DefaultNineth))
+	}
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *ContainerOfEnums) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *ContainerOfEnums) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.I32:
+			v27, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "first", p.ThriftName(), err)
+			}
+			p.First = UndefinedValues(v27)
+		case fieldId == 2 && fieldTypeId == thrift.I32:
+			v28, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "second", p.ThriftName(), err)
+			}
+			p.Second = DefinedValues(v28)
+		case fieldId == 3 && fieldTypeId == thrift.I32:
+			v29, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(3, "third", p.ThriftName(), err)
+			}
+			p.Third = HeterogeneousValues(v29)
+		case fieldId == 4 && fieldTypeId == thrift.I32:
+			v30, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(4, "optional_fourth", p.ThriftName(), err)
+			}
+			p.OptionalFourth = UndefinedValues(v30)
+		case fieldId == 5 && fieldTypeId == thrift.I32:
+			v31, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "optional_fifth", p.ThriftName(), err)
+			}
+			p.OptionalFifth = DefinedValues(v31)
+		case fieldId == 6 && fieldTypeId == thrift.I32:
+			v32, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(6, "optional_sixth", p.ThriftName(), err)
+			}
+			p.OptionalSixth = HeterogeneousValues(v32)
+		case fieldId == 7 && fieldTypeId == thrift.I32:
+			v33, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(7, "default_seventh", p.ThriftName(), err)
+			}
+			p.DefaultSeventh = UndefinedValues(v33)
+		case fieldId == 8 && fieldTypeId == thrift.I32:
+			v34, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(8, "default_eighth", p.ThriftName(), err)
+			}
+			p.DefaultEighth = DefinedValues(v34)
+		case fieldId == 9 && fieldTypeId == thrift.I32:
+			v35, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "default_nineth", p.ThriftName(), err)
+			}
+			p.DefaultNineth = HeterogeneousValues(v35)
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
 func (p *ContainerOfEnums) TStructName() string {
 	return "ContainerOfEnums"
 }
@@ -808,6 +1087,45 @@ func (p *ContainerOfEnums) String() string {
 	return fmt.Sprintf("ContainerOfEnums(%+v)", *p)
 }
 
+func (p *ContainerOfEnums) Equals(other interface{}) bool {
+	data, ok := other.(*ContainerOfEnums)
+	return ok && p.EqualsT(data)
+}
+
+func (p *ContainerOfEnums) EqualsT(other *ContainerOfEnums) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if p.First != other.First {
+		return false
+	}
+	if p.Second != other.Second {
+		return false
+	}
+	if p.Third != other.Third {
+		return false
+	}
+	if p.OptionalFourth != other.OptionalFourth {
+		return false
+	}
+	if p.OptionalFifth != other.OptionalFifth {
+		return false
+	}
+	if p.OptionalSixth != other.OptionalSixth {
+		return false
+	}
+	if p.DefaultSeventh != other.DefaultSeventh {
+		return false
+	}
+	if p.DefaultEighth != other.DefaultEighth {
+		return false
+	}
+	if p.DefaultNineth != other.DefaultNineth {
+		return false
+	}
+	return true
+}
+
 func (p *ContainerOfEnums) CompareTo(other interface{}) (int, bool) {
 	if other == nil {
 		return 1, true
@@ -816,18 +1134,98 @@ func (p *ContainerOfEnums) CompareTo(other interface{}) (int, bool) {
 	if !ok {
 		return 0, false
 	}
-	return thrift.TType(thrift.STRUCT).Compare(p, data)
-}
-
-func (p *ContainerOfEnums) AttributeByFieldId(id int) interface{} {
-	switch id {
-	default:
-		return nil
-	case 1:
-		return p.First
-	case 2:
-		return p.Second
-	case 3:
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.First != data.First {
+		if p.First < data.First {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Second != data.Second {
+		if p.Second < data.Second {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Third != data.Third {
+		if p.Third < data.Third {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.OptionalFourth != data.OptionalFourth {
+		if p.OptionalFourth < data.OptionalFourth {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.OptionalFifth != data.OptionalFifth {
+		if p.OptionalFifth < data.OptionalFifth {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.OptionalSixth != data.OptionalSixth {
+		if p.OptionalSixth < data.OptionalSixth {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.DefaultSeventh != data.DefaultSeventh {
+		if p.DefaultSeventh < data.DefaultSeventh {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.DefaultEighth != data.DefaultEighth {
+		if p.DefaultEighth < data.DefaultEighth {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.DefaultNineth != data.DefaultNineth {
+		if p.DefaultNineth < data.DefaultNineth {
+			return -1, true
+		}
+		return 1, true
+	}
+	return 0, true
+}
+
+func (p *ContainerOfEnums) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	h = thrift.HashInt64(h, int64(p.First))
+	h = thrift.HashInt64(h, int64(p.Second))
+	h = thrift.HashInt64(h, int64(p.Third))
+	h = thrift.HashInt64(h, int64(p.OptionalFourth))
+	h = thrift.HashInt64(h, int64(p.OptionalFifth))
+	h = thrift.HashInt64(h, int64(p.OptionalSixth))
+	h = thrift.HashInt64(h, int64(p.DefaultSeventh))
+	h = thrift.HashInt64(h, int64(p.DefaultEighth))
+	h = thrift.HashInt64(h, int64(p.DefaultNineth))
+	return h
+}
+
+func (p *ContainerOfEnums) AttributeByFieldId(id int) interface{} {
+	switch id {
+	default:
+		return nil
+	case 1:
+		return p.First
+	case 2:
+		return p.Second
+	case 3:
 		return p.Third
 	case 4:
 		return p.OptionalFourth
@@ -846,17 +1244,1240 @@ func (p *ContainerOfEnums) AttributeByFieldId(id int) interface{} {
 }
 
 func (p *ContainerOfEnums) TStructFields() thrift.TFieldContainer {
-	return thrift.NewTFieldContainer([]thrift.TField{
-		thrift.NewTField("first", thrift.I32, 1),
-		thrift.NewTField("second", thrift.I32, 2),
-		thrift.NewTField("third", thrift.I32, 3),
-		thrift.NewTField("optional_fourth", thrift.I32, 4),
-		thrift.NewTField("optional_fifth", thrift.I32, 5),
-		thrift.NewTField("optional_sixth", thrift.I32, 6),
-		thrift.NewTField("default_seventh", thrift.I32, 7),
-		thrift.NewTField("default_eighth", thrift.I32, 8),
-		thrift.NewTField("default_nineth", thrift.I32, 9),
-	})
+	return containerOfEnumsTStruct.TStructFields()
+}
+
+/**
+ * Attributes:
+ *  - Enabled
+ *  - Id
+ *  - Flags
+ *  - Name
+ *  - Port
+ *  - Weight
+ */
+type SparseFields struct {
+	thrift.TStruct
+	Enabled bool   "enabled" // 1
+	Id      int64  "id"      // 5
+	Flags   byte   "flags"   // 9
+	Name    string "name"    // 40
+	Port    int16  "port"    // 41
+	Weight  int32  "weight"  // 300
+}
+
+var sparseFieldsTStruct = thrift.NewTStruct("SparseFields", []thrift.TField{
+	thrift.NewTField("enabled", thrift.BOOL, 1),
+	thrift.NewTField("id", thrift.I64, 5),
+	thrift.NewTField("flags", thrift.BYTE, 9),
+	thrift.NewTField("name", thrift.STRING, 40),
+	thrift.NewTField("port", thrift.I16, 41),
+	thrift.NewTField("weight", thrift.I32, 300),
+})
+
+func NewSparseFields() *SparseFields {
+	output := &SparseFields{
+		TStruct: sparseFieldsTStruct,
+	}
+	{
+	}
+	return output
+}
+
+func (p *SparseFields) Reset() {
+	*p = SparseFields{TStruct: sparseFieldsTStruct}
+}
+
+func (p *SparseFields) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_, err = iprot.ReadStructBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	for {
+		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
+		if fieldId < 0 {
+			fieldId = int16(p.FieldIdFromFieldName(fieldName))
+		}
+		if fieldTypeId == thrift.GENERIC {
+			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
+		}
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch fieldId {
+		case 1:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField1(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "enabled", p.ThriftName(), err)
+			}
+		case 5:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField5(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "id", p.ThriftName(), err)
+			}
+		case 9:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField9(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "flags", p.ThriftName(), err)
+			}
+		case 40:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField40(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(40, "name", p.ThriftName(), err)
+			}
+		case 41:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField41(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(41, "port", p.ThriftName(), err)
+			}
+		case 300:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField300(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(300, "weight", p.ThriftName(), err)
+			}
+		default:
+			err = iprot.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+			}
+		}
+		err = iprot.ReadFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+	}
+	err = iprot.ReadStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) ReadField1(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v36, err37 := iprot.ReadBool()
+	if err37 != nil {
+		return thrift.NewTProtocolExceptionReadField(1, "enabled", p.ThriftName(), err37)
+	}
+	p.Enabled = v36
+	return err
+}
+
+func (p *SparseFields) ReadFieldEnabled(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField1(iprot)
+}
+
+func (p *SparseFields) ReadField5(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v38, err39 := iprot.ReadI64()
+	if err39 != nil {
+		return thrift.NewTProtocolExceptionReadField(5, "id", p.ThriftName(), err39)
+	}
+	p.Id = v38
+	return err
+}
+
+func (p *SparseFields) ReadFieldId(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField5(iprot)
+}
+
+func (p *SparseFields) ReadField9(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v40, err41 := iprot.ReadByte()
+	if err41 != nil {
+		return thrift.NewTProtocolExceptionReadField(9, "flags", p.ThriftName(), err41)
+	}
+	p.Flags = v40
+	return err
+}
+
+func (p *SparseFields) ReadFieldFlags(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField9(iprot)
+}
+
+func (p *SparseFields) ReadField40(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v42, err43 := iprot.ReadString()
+	if err43 != nil {
+		return thrift.NewTProtocolExceptionReadField(40, "name", p.ThriftName(), err43)
+	}
+	p.Name = v42
+	return err
+}
+
+func (p *SparseFields) ReadFieldName(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField40(iprot)
+}
+
+func (p *SparseFields) ReadField41(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v44, err45 := iprot.ReadI16()
+	if err45 != nil {
+		return thrift.NewTProtocolExceptionReadField(41, "port", p.ThriftName(), err45)
+	}
+	p.Port = v44
+	return err
+}
+
+func (p *SparseFields) ReadFieldPort(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField41(iprot)
+}
+
+func (p *SparseFields) ReadField300(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	v46, err47 := iprot.ReadI32()
+	if err47 != nil {
+		return thrift.NewTProtocolExceptionReadField(300, "weight", p.ThriftName(), err47)
+	}
+	p.Weight = v46
+	return err
+}
+
+func (p *SparseFields) ReadFieldWeight(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField300(iprot)
+}
+
+func (p *SparseFields) Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteStructBegin("SparseFields")
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	err = p.WriteField1(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField5(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField9(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField40(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField41(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField300(oprot)
+	if err != nil {
+		return err
+	}
+	err = oprot.WriteFieldStop()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(-1, "STOP", p.ThriftName(), err)
+	}
+	err = oprot.WriteStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteField1(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("enabled", thrift.BOOL, 1)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(1, "enabled", p.ThriftName(), err)
+	}
+	err = oprot.WriteBool(bool(p.Enabled))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(1, "enabled", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(1, "enabled", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldEnabled(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField1(oprot)
+}
+
+func (p *SparseFields) WriteField5(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("id", thrift.I64, 5)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(5, "id", p.ThriftName(), err)
+	}
+	err = oprot.WriteI64(int64(p.Id))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(5, "id", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(5, "id", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldId(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField5(oprot)
+}
+
+func (p *SparseFields) WriteField9(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("flags", thrift.BYTE, 9)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(9, "flags", p.ThriftName(), err)
+	}
+	err = oprot.WriteByte(byte(p.Flags))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(9, "flags", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(9, "flags", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldFlags(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField9(oprot)
+}
+
+func (p *SparseFields) WriteField40(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("name", thrift.STRING, 40)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(40, "name", p.ThriftName(), err)
+	}
+	err = oprot.WriteString(string(p.Name))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(40, "name", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(40, "name", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldName(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField40(oprot)
+}
+
+func (p *SparseFields) WriteField41(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("port", thrift.I16, 41)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(41, "port", p.ThriftName(), err)
+	}
+	err = oprot.WriteI16(int16(p.Port))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(41, "port", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(41, "port", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldPort(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField41(oprot)
+}
+
+func (p *SparseFields) WriteField300(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteFieldBegin("weight", thrift.I32, 300)
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(300, "weight", p.ThriftName(), err)
+	}
+	err = oprot.WriteI32(int32(p.Weight))
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(300, "weight", p.ThriftName(), err)
+	}
+	err = oprot.WriteFieldEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(300, "weight", p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *SparseFields) WriteFieldWeight(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField300(oprot)
+}
+
+func (p *SparseFields) BinarySize() int {
+	n := 0
+	n += 3
+	n += 1
+	n += 3
+	n += 8
+	n += 3
+	n += 1
+	n += 3
+	n += 4 + len(p.Name)
+	n += 3
+	n += 2
+	n += 3
+	n += 4
+	return n + 1
+}
+
+func (p *SparseFields) MarshalBinaryThrift(buf []byte) []byte {
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.BOOL, 1)
+	buf = thrift.AppendBinaryBool(buf, bool(p.Enabled))
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.I64, 5)
+	buf = thrift.AppendBinaryI64(buf, int64(p.Id))
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.BYTE, 9)
+	buf = thrift.AppendBinaryByte(buf, byte(p.Flags))
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.STRING, 40)
+	buf = thrift.AppendBinaryString(buf, string(p.Name))
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.I16, 41)
+	buf = thrift.AppendBinaryI16(buf, int16(p.Port))
+	buf = thrift.AppendBinaryFieldBegin(buf, thrift.I32, 300)
+	buf = thrift.AppendBinaryI32(buf, int32(p.Weight))
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *SparseFields) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *SparseFields) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.BOOL:
+			v48, err := d.ReadBool()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "enabled", p.ThriftName(), err)
+			}
+			p.Enabled = v48
+		case fieldId == 5 && fieldTypeId == thrift.I64:
+			v49, err := d.ReadI64()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "id", p.ThriftName(), err)
+			}
+			p.Id = v49
+		case fieldId == 9 && fieldTypeId == thrift.BYTE:
+			v50, err := d.ReadByte()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "flags", p.ThriftName(), err)
+			}
+			p.Flags = v50
+		case fieldId == 40 && fieldTypeId == thrift.STRING:
+			v51, err := d.ReadString()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(40, "name", p.ThriftName(), err)
+			}
+			p.Name = v51
+		case fieldId == 41 && fieldTypeId == thrift.I16:
+			v52, err := d.ReadI16()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(41, "port", p.ThriftName(), err)
+			}
+			p.Port = v52
+		case fieldId == 300 && fieldTypeId == thrift.I32:
+			v53, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(300, "weight", p.ThriftName(), err)
+			}
+			p.Weight = v53
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *SparseFields) CompactSize() int {
+	n := 0
+	n += 1
+	n += 1
+	n += thrift.CompactI64Size(int64(p.Id))
+	n += 1
+	n += 1
+	n += 2
+	n += thrift.CompactStringSize(len(p.Name))
+	n += 1
+	n += thrift.CompactI32Size(int32(p.Port))
+	n += 3
+	n += thrift.CompactI32Size(int32(p.Weight))
+	return n + 1
+}
+
+func (p *SparseFields) MarshalCompactThrift(buf []byte) []byte {
+	if p.Enabled {
+		buf = append(buf, 0x11)
+	} else {
+		buf = append(buf, 0x12)
+	}
+	buf = append(buf, 0x46)
+	buf = thrift.AppendCompactI64(buf, int64(p.Id))
+	buf = append(buf, 0x43)
+	buf = thrift.AppendCompactByte(buf, byte(p.Flags))
+	buf = append(buf, 0x08, 0x50)
+	buf = thrift.AppendCompactString(buf, string(p.Name))
+	buf = append(buf, 0x14)
+	buf = thrift.AppendCompactI16(buf, int16(p.Port))
+	buf = append(buf, 0x05, 0xd8, 0x04)
+	buf = thrift.AppendCompactI32(buf, int32(p.Weight))
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *SparseFields) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *SparseFields) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.BOOL:
+			v54, err := d.ReadBool()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "enabled", p.ThriftName(), err)
+			}
+			p.Enabled = v54
+		case fieldId == 5 && fieldTypeId == thrift.I64:
+			v55, err := d.ReadI64()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(5, "id", p.ThriftName(), err)
+			}
+			p.Id = v55
+		case fieldId == 9 && fieldTypeId == thrift.BYTE:
+			v56, err := d.ReadByte()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(9, "flags", p.ThriftName(), err)
+			}
+			p.Flags = v56
+		case fieldId == 40 && fieldTypeId == thrift.STRING:
+			v57, err := d.ReadString()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(40, "name", p.ThriftName(), err)
+			}
+			p.Name = v57
+		case fieldId == 41 && fieldTypeId == thrift.I16:
+			v58, err := d.ReadI16()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(41, "port", p.ThriftName(), err)
+			}
+			p.Port = v58
+		case fieldId == 300 && fieldTypeId == thrift.I32:
+			v59, err := d.ReadI32()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(300, "weight", p.ThriftName(), err)
+			}
+			p.Weight = v59
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *SparseFields) TStructName() string {
+	return "SparseFields"
+}
+
+func (p *SparseFields) ThriftName() string {
+	return "SparseFields"
+}
+
+func (p *SparseFields) String() string {
+	if p == nil {
+		return "<nil>"
+	}
+	return fmt.Sprintf("SparseFields(%+v)", *p)
+}
+
+func (p *SparseFields) Equals(other interface{}) bool {
+	data, ok := other.(*SparseFields)
+	return ok && p.EqualsT(data)
+}
+
+func (p *SparseFields) EqualsT(other *SparseFields) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if p.Enabled != other.Enabled {
+		return false
+	}
+	if p.Id != other.Id {
+		return false
+	}
+	if p.Flags != other.Flags {
+		return false
+	}
+	if p.Name != other.Name {
+		return false
+	}
+	if p.Port != other.Port {
+		return false
+	}
+	if p.Weight != other.Weight {
+		return false
+	}
+	return true
+}
+
+func (p *SparseFields) CompareTo(other interface{}) (int, bool) {
+	if other == nil {
+		return 1, true
+	}
+	data, ok := other.(*SparseFields)
+	if !ok {
+		return 0, false
+	}
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Enabled != data.Enabled {
+		if data.Enabled {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Id != data.Id {
+		if p.Id < data.Id {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Flags != data.Flags {
+		if p.Flags < data.Flags {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Name != data.Name {
+		if p.Name < data.Name {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Port != data.Port {
+		if p.Port < data.Port {
+			return -1, true
+		}
+		return 1, true
+	}
+	if p.Weight != data.Weight {
+		if p.Weight < data.Weight {
+			return -1, true
+		}
+		return 1, true
+	}
+	return 0, true
+}
+
+func (p *SparseFields) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	h = thrift.HashBool(h, p.Enabled)
+	h = thrift.HashInt64(h, int64(p.Id))
+	h = thrift.HashInt64(h, int64(p.Flags))
+	h = thrift.HashString(h, p.Name)
+	h = thrift.HashInt64(h, int64(p.Port))
+	h = thrift.HashInt64(h, int64(p.Weight))
+	return h
+}
+
+func (p *SparseFields) AttributeByFieldId(id int) interface{} {
+	switch id {
+	default:
+		return nil
+	case 1:
+		return p.Enabled
+	case 5:
+		return p.Id
+	case 9:
+		return p.Flags
+	case 40:
+		return p.Name
+	case 41:
+		return p.Port
+	case 300:
+		return p.Weight
+	}
+	return nil
+}
+
+func (p *SparseFields) TStructFields() thrift.TFieldContainer {
+	return sparseFieldsTStruct.TStructFields()
+}
+
+/**
+ * Attributes:
+ *  - Ids
+ *  - Names
+ */
+type Directory struct {
+	thrift.TStruct
+	Ids   thrift.TSet "ids"   // 1
+	Names thrift.TMap "names" // 2
+}
+
+var directoryTStruct = thrift.NewTStruct("Directory", []thrift.TField{
+	thrift.NewTField("ids", thrift.SET, 1),
+	thrift.NewTField("names", thrift.MAP, 2),
+})
+
+func NewDirectory() *Directory {
+	output := &Directory{
+		TStruct: directoryTStruct,
+	}
+	{
+	}
+	return output
+}
+
+func (p *Directory) Reset() {
+	*p = Directory{TStruct: directoryTStruct}
+}
+
+func (p *Directory) Read(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_, err = iprot.ReadStructBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	for {
+		fieldName, fieldTypeId, fieldId, err := iprot.ReadFieldBegin()
+		if fieldId < 0 {
+			fieldId = int16(p.FieldIdFromFieldName(fieldName))
+		}
+		if fieldTypeId == thrift.GENERIC {
+			fieldTypeId = p.FieldFromFieldId(int(fieldId)).TypeId()
+		}
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch fieldId {
+		case 1:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField1(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "ids", p.ThriftName(), err)
+			}
+		case 2:
+			if fieldTypeId == thrift.VOID {
+				err = iprot.Skip(fieldTypeId)
+			} else {
+				err = p.ReadField2(iprot)
+			}
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+			}
+		default:
+			err = iprot.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+			}
+		}
+		err = iprot.ReadFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), fieldName, p.ThriftName(), err)
+		}
+	}
+	err = iprot.ReadStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *Directory) ReadField1(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_etype65, _size62, err := iprot.ReadSetBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadField(-1, "p.Ids", "", err)
+	}
+	p.Ids = thrift.NewTSet(_etype65, _size62)
+	for _i66 := 0; _i66 < _size62; _i66++ {
+		v68, err69 := iprot.ReadI64()
+		if err69 != nil {
+			return thrift.NewTProtocolExceptionReadField(0, "_elem67", "", err69)
+		}
+		_elem67 := v68
+		p.Ids.Add(_elem67)
+	}
+	err = iprot.ReadSetEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadField(-1, "", "set", err)
+	}
+	return err
+}
+
+func (p *Directory) ReadFieldIds(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField1(iprot)
+}
+
+func (p *Directory) ReadField2(iprot thrift.TProtocol) (err thrift.TProtocolException) {
+	_ktype73, _vtype74, _size72, err := iprot.ReadMapBegin()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadField(-1, "p.Names", "", err)
+	}
+	p.Names = thrift.NewTMap(_ktype73, _vtype74, _size72)
+	for _i76 := 0; _i76 < _size72; _i76++ {
+		v79, err80 := iprot.ReadI64()
+		if err80 != nil {
+			return thrift.NewTProtocolExceptionReadField(0, "_key77", "", err80)
+		}
+		_key77 := v79
+		v81, err82 := iprot.ReadString()
+		if err82 != nil {
+			return thrift.NewTProtocolExceptionReadField(0, "_val78", "", err82)
+		}
+		_val78 := v81
+		p.Names.Set(_key77, _val78)
+	}
+	err = iprot.ReadMapEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionReadField(-1, "", "map", err)
+	}
+	return err
+}
+
+func (p *Directory) ReadFieldNames(iprot thrift.TProtocol) thrift.TProtocolException {
+	return p.ReadField2(iprot)
+}
+
+func (p *Directory) Write(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	err = oprot.WriteStructBegin("Directory")
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	err = p.WriteField1(oprot)
+	if err != nil {
+		return err
+	}
+	err = p.WriteField2(oprot)
+	if err != nil {
+		return err
+	}
+	err = oprot.WriteFieldStop()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteField(-1, "STOP", p.ThriftName(), err)
+	}
+	err = oprot.WriteStructEnd()
+	if err != nil {
+		return thrift.NewTProtocolExceptionWriteStruct(p.ThriftName(), err)
+	}
+	return err
+}
+
+func (p *Directory) WriteField1(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	if p.Ids != nil {
+		err = oprot.WriteFieldBegin("ids", thrift.SET, 1)
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(1, "ids", p.ThriftName(), err)
+		}
+		err = oprot.WriteSetBegin(thrift.I64, p.Ids.Len())
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(-1, "", "set", err)
+		}
+		for Iter83 := p.Ids.Front(); Iter83 != nil; Iter83 = Iter83.Next() {
+			Iter84 := Iter83.Value.(int64)
+			err = oprot.WriteI64(int64(Iter84))
+			if err != nil {
+				return thrift.NewTProtocolExceptionWriteField(0, "Iter84", "", err)
+			}
+		}
+		err = oprot.WriteSetEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(-1, "", "set", err)
+		}
+		err = oprot.WriteFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(1, "ids", p.ThriftName(), err)
+		}
+	}
+	return err
+}
+
+func (p *Directory) WriteFieldIds(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField1(oprot)
+}
+
+func (p *Directory) WriteField2(oprot thrift.TProtocol) (err thrift.TProtocolException) {
+	if p.Names != nil {
+		err = oprot.WriteFieldBegin("names", thrift.MAP, 2)
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(2, "names", p.ThriftName(), err)
+		}
+		err = oprot.WriteMapBegin(thrift.I64, thrift.STRING, p.Names.Len())
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(-1, "", "map", err)
+		}
+		err = thrift.NewTProtocolExceptionFromOsError(p.Names.ForEach(func(Miter85, Miter86 interface{}) error {
+			Kiter87, Viter88 := Miter85.(int64), Miter86.(string)
+			err = oprot.WriteI64(int64(Kiter87))
+			if err != nil {
+				return thrift.NewTProtocolExceptionWriteField(0, "Kiter87", "", err)
+			}
+			err = oprot.WriteString(string(Viter88))
+			if err != nil {
+				return thrift.NewTProtocolExceptionWriteField(0, "Viter88", "", err)
+			}
+			return nil
+		}))
+		if err != nil {
+			return err
+		}
+		err = oprot.WriteMapEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(-1, "", "map", err)
+		}
+		err = oprot.WriteFieldEnd()
+		if err != nil {
+			return thrift.NewTProtocolExceptionWriteField(2, "names", p.ThriftName(), err)
+		}
+	}
+	return err
+}
+
+func (p *Directory) WriteFieldNames(oprot thrift.TProtocol) thrift.TProtocolException {
+	return p.WriteField2(oprot)
+}
+
+func (p *Directory) BinarySize() int {
+	n := 0
+	if p.Ids != nil {
+		n += 3
+		n += 5
+		n += p.Ids.Len() * 8
+	}
+	if p.Names != nil {
+		n += 3
+		n += 6
+		n += p.Names.Len() * 8
+		p.Names.ForEach(func(Miter90, Miter91 interface{}) error {
+			Viter89 := Miter91.(string)
+			n += 4 + len(Viter89)
+			return nil
+		})
+	}
+	return n + 1
+}
+
+func (p *Directory) MarshalBinaryThrift(buf []byte) []byte {
+	if p.Ids != nil {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.SET, 1)
+		buf = thrift.AppendBinarySetBegin(buf, thrift.I64, p.Ids.Len())
+		for Iter92 := p.Ids.Front(); Iter92 != nil; Iter92 = Iter92.Next() {
+			Iter93 := Iter92.Value.(int64)
+			buf = thrift.AppendBinaryI64(buf, int64(Iter93))
+		}
+	}
+	if p.Names != nil {
+		buf = thrift.AppendBinaryFieldBegin(buf, thrift.MAP, 2)
+		buf = thrift.AppendBinaryMapBegin(buf, thrift.I64, thrift.STRING, p.Names.Len())
+		p.Names.ForEach(func(Miter96, Miter97 interface{}) error {
+			Kiter94, Viter95 := Miter96.(int64), Miter97.(string)
+			buf = thrift.AppendBinaryI64(buf, int64(Kiter94))
+			buf = thrift.AppendBinaryString(buf, string(Viter95))
+			return nil
+		})
+	}
+	return thrift.AppendBinaryFieldStop(buf)
+}
+
+func (p *Directory) UnmarshalBinaryThrift(data []byte) error {
+	return p.DecodeBinaryThrift(thrift.NewTBinaryDecoder(data))
+}
+
+func (p *Directory) DecodeBinaryThrift(d *thrift.TBinaryDecoder) thrift.TProtocolException {
+	for {
+		fieldTypeId, fieldId, err := d.ReadFieldBegin()
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.SET:
+			_, _size98, err := d.ReadSetBegin()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "ids", p.ThriftName(), err)
+			}
+			p.Ids = thrift.NewTSet(thrift.I64, _size98)
+			for _i99 := 0; _i99 < _size98; _i99++ {
+				v101, err := d.ReadI64()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(1, "ids", p.ThriftName(), err)
+				}
+				_elem100 := v101
+				p.Ids.Add(_elem100)
+			}
+		case fieldId == 2 && fieldTypeId == thrift.MAP:
+			_, _, _size102, err := d.ReadMapBegin()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+			}
+			p.Names = thrift.NewTMap(thrift.I64, thrift.STRING, _size102)
+			for _i103 := 0; _i103 < _size102; _i103++ {
+				v106, err := d.ReadI64()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+				}
+				_key104 := v106
+				v107, err := d.ReadString()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+				}
+				_val105 := v107
+				p.Names.Set(_key104, _val105)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *Directory) CompactSize() int {
+	n := 0
+	var lastFieldId int16
+	if p.Ids != nil {
+		n += 1
+		n += thrift.CompactListBeginSize(p.Ids.Len())
+		for Iter108 := p.Ids.Front(); Iter108 != nil; Iter108 = Iter108.Next() {
+			Iter109 := Iter108.Value.(int64)
+			n += thrift.CompactI64Size(int64(Iter109))
+		}
+		lastFieldId = 1
+	}
+	if p.Names != nil {
+		n += thrift.CompactFieldBeginSize(2, lastFieldId)
+		n += thrift.CompactMapBeginSize(p.Names.Len())
+		p.Names.ForEach(func(Miter112, Miter113 interface{}) error {
+			Kiter110 := Miter112.(int64)
+			Viter111 := Miter113.(string)
+			n += thrift.CompactI64Size(int64(Kiter110))
+			n += thrift.CompactStringSize(len(Viter111))
+			return nil
+		})
+	}
+	return n + 1
+}
+
+func (p *Directory) MarshalCompactThrift(buf []byte) []byte {
+	var lastFieldId int16
+	if p.Ids != nil {
+		buf = append(buf, 0x1a)
+		buf = thrift.AppendCompactSetBegin(buf, thrift.I64, p.Ids.Len())
+		for Iter114 := p.Ids.Front(); Iter114 != nil; Iter114 = Iter114.Next() {
+			Iter115 := Iter114.Value.(int64)
+			buf = thrift.AppendCompactI64(buf, int64(Iter115))
+		}
+		lastFieldId = 1
+	}
+	if p.Names != nil {
+		buf = thrift.AppendCompactFieldBegin(buf, thrift.MAP, 2, lastFieldId)
+		buf = thrift.AppendCompactMapBegin(buf, thrift.I64, thrift.STRING, p.Names.Len())
+		p.Names.ForEach(func(Miter118, Miter119 interface{}) error {
+			Kiter116, Viter117 := Miter118.(int64), Miter119.(string)
+			buf = thrift.AppendCompactI64(buf, int64(Kiter116))
+			buf = thrift.AppendCompactString(buf, string(Viter117))
+			return nil
+		})
+	}
+	return thrift.AppendCompactFieldStop(buf)
+}
+
+func (p *Directory) UnmarshalCompactThrift(data []byte) error {
+	return p.DecodeCompactThrift(thrift.NewTCompactDecoder(data))
+}
+
+func (p *Directory) DecodeCompactThrift(d *thrift.TCompactDecoder) thrift.TProtocolException {
+	for fieldId := int16(0); ; {
+		fieldTypeId, id, err := d.ReadFieldBegin(fieldId)
+		if err != nil {
+			return thrift.NewTProtocolExceptionReadField(int(id), "", p.ThriftName(), err)
+		}
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+		fieldId = id
+		switch {
+		case fieldId == 1 && fieldTypeId == thrift.SET:
+			_, _size120, err := d.ReadSetBegin()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(1, "ids", p.ThriftName(), err)
+			}
+			p.Ids = thrift.NewTSet(thrift.I64, _size120)
+			for _i121 := 0; _i121 < _size120; _i121++ {
+				v123, err := d.ReadI64()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(1, "ids", p.ThriftName(), err)
+				}
+				_elem122 := v123
+				p.Ids.Add(_elem122)
+			}
+		case fieldId == 2 && fieldTypeId == thrift.MAP:
+			_, _, _size124, err := d.ReadMapBegin()
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+			}
+			p.Names = thrift.NewTMap(thrift.I64, thrift.STRING, _size124)
+			for _i125 := 0; _i125 < _size124; _i125++ {
+				v128, err := d.ReadI64()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+				}
+				_key126 := v128
+				v129, err := d.ReadString()
+				if err != nil {
+					return thrift.NewTProtocolExceptionReadField(2, "names", p.ThriftName(), err)
+				}
+				_val127 := v129
+				p.Names.Set(_key126, _val127)
+			}
+		default:
+			err = d.Skip(fieldTypeId)
+			if err != nil {
+				return thrift.NewTProtocolExceptionReadField(int(fieldId), "", p.ThriftName(), err)
+			}
+		}
+	}
+	return nil
+}
+
+func (p *Directory) TStructName() string {
+	return "Directory"
+}
+
+func (p *Directory) ThriftName() string {
+	return "Directory"
+}
+
+func (p *Directory) String() string {
+	if p == nil {
+		return "<nil>"
+	}
+	return fmt.Sprintf("Directory(%+v)", *p)
+}
+
+func (p *Directory) Equals(other interface{}) bool {
+	data, ok := other.(*Directory)
+	return ok && p.EqualsT(data)
+}
+
+func (p *Directory) EqualsT(other *Directory) bool {
+	if p == nil || other == nil {
+		return p == other
+	}
+	if c, ok := thrift.TType(thrift.SET).Compare(p.Ids, other.Ids); c != 0 || !ok {
+		return false
+	}
+	if c, ok := thrift.TType(thrift.MAP).Compare(p.Names, other.Names); c != 0 || !ok {
+		return false
+	}
+	return true
+}
+
+func (p *Directory) CompareTo(other interface{}) (int, bool) {
+	if other == nil {
+		return 1, true
+	}
+	data, ok := other.(*Directory)
+	if !ok {
+		return 0, false
+	}
+	if p == nil || data == nil {
+		if p == data {
+			return 0, true
+		}
+		if p == nil {
+			return -1, true
+		}
+		return 1, true
+	}
+	if c, ok := thrift.TType(thrift.SET).Compare(p.Ids, data.Ids); c != 0 || !ok {
+		return c, ok
+	}
+	if c, ok := thrift.TType(thrift.MAP).Compare(p.Names, data.Names); c != 0 || !ok {
+		return c, ok
+	}
+	return 0, true
+}
+
+func (p *Directory) Hash64() uint64 {
+	if p == nil {
+		return 0
+	}
+	h := thrift.HashSeed
+	if p.Ids != nil {
+		h = thrift.HashInt64(h, int64(p.Ids.Len()))
+	}
+	if p.Names != nil {
+		h = thrift.HashInt64(h, int64(p.Names.Len()))
+	}
+	return h
+}
+
+func (p *Directory) AttributeByFieldId(id int) interface{} {
+	switch id {
+	default:
+		return nil
+	case 1:
+		return p.Ids
+	case 2:
+		return p.Names
+	}
+	return nil
+}
+
+func (p *Directory) TStructFields() thrift.TFieldContainer {
+	return directoryTStruct.TStructFields()
 }
 
 func init() {
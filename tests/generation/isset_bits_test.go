@@ -0,0 +1,148 @@
+package simple
+
+import (
+	"testing"
+	"thrift"
+)
+
+// These tests are compiled against the output of "--gen go:isset_bits", under
+// which whether an enum field is set is kept in a bitset rather than in a
+// sentinel value, so that even the zero value of an enum can be sent.  The
+// other tests of this directory assign fields directly and so are compiled
+// only against the default output.
+
+func TestIssetBitsNew(t *testing.T) {
+	emission := NewContainerOfEnums()
+
+	var valueAndExpected = []struct {
+		value    bool
+		expected bool
+	}{
+		{emission.IsSetFirst(), false},
+		{emission.IsSetSecond(), false},
+		{emission.IsSetThird(), false},
+		{emission.IsSetOptionalFourth(), false},
+		{emission.IsSetOptionalFifth(), false},
+		{emission.IsSetOptionalSixth(), false},
+		{emission.IsSetDefaultSeventh(), true},
+		{emission.IsSetDefaultEighth(), true},
+		{emission.IsSetDefaultNineth(), true},
+	}
+
+	for i, definition := range valueAndExpected {
+		if definition.value != definition.expected {
+			t.Errorf("%d. IsSet() => %v, want %v", i, definition.value, definition.expected)
+		}
+	}
+
+	if emission.DefaultEighth != DefinedValues_One {
+		t.Errorf("emission.DefaultEighth = %v, want its default %v", emission.DefaultEighth, DefinedValues_One)
+	}
+}
+
+func TestIssetBitsSetAndUnset(t *testing.T) {
+	emission := NewContainerOfEnums()
+	emission.SetOptionalFourth(UndefinedValues_One)
+
+	if !emission.IsSetOptionalFourth() || emission.OptionalFourth != UndefinedValues_One {
+		t.Errorf("SetOptionalFourth(UndefinedValues_One) left IsSetOptionalFourth() => %v, OptionalFourth = %v", emission.IsSetOptionalFourth(), emission.OptionalFourth)
+	}
+
+	emission.UnsetDefaultSeventh()
+
+	if emission.IsSetDefaultSeventh() || !emission.IsSetOptionalFourth() || !emission.IsSetDefaultEighth() {
+		t.Errorf("UnsetDefaultSeventh() changed bits other than its own.")
+	}
+
+	emission.Reset()
+
+	if emission.IsSetOptionalFourth() || !emission.IsSetDefaultSeventh() {
+		t.Errorf("Reset() did not restore the bits New() leaves.")
+	}
+}
+
+// The value an unset field was left holding plays no part in equality.
+func TestIssetBitsEquality(t *testing.T) {
+	in, out := NewContainerOfEnums(), NewContainerOfEnums()
+	out.SetOptionalFourth(UndefinedValues_Three)
+
+	if in.EqualsT(out) || in.Hash64() == out.Hash64() {
+		t.Errorf("Setting out.OptionalFourth did not make it differ from in.")
+	}
+
+	out.UnsetOptionalFourth()
+
+	if !in.EqualsT(out) || in.Hash64() != out.Hash64() {
+		t.Errorf("Unsetting out.OptionalFourth did not make it equal in again.")
+	}
+
+	if c, ok := in.CompareTo(out); c != 0 || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want 0, true.", c, ok)
+	}
+}
+
+func TestIssetBitsWireFormat(t *testing.T) {
+	protocols := []func(thrift.TTransport) thrift.TProtocol{
+		func(transport thrift.TTransport) thrift.TProtocol {
+			return thrift.NewTBinaryProtocolTransport(transport)
+		},
+		func(transport thrift.TTransport) thrift.TProtocol { return thrift.NewTCompactProtocol(transport) },
+		func(transport thrift.TTransport) thrift.TProtocol { return thrift.NewTJSONProtocol(transport) },
+	}
+
+	for i, builder := range protocols {
+		transport := thrift.NewTMemoryBuffer()
+		protocol := builder(transport)
+		emission := NewContainerOfEnums()
+		emission.SetFirst(UndefinedValues_One)
+		emission.SetOptionalFourth(UndefinedValues_One)
+		emission.SetOptionalSixth(HeterogeneousValues_Four)
+		emission.UnsetDefaultEighth()
+
+		if err := emission.Write(protocol); err != nil {
+			t.Fatalf("%d: Could not write %v due to '%q'.", i, emission, err)
+		}
+
+		protocol.Flush()
+		incoming := NewContainerOfEnums()
+		incoming.UnsetDefaultSeventh()
+		incoming.UnsetDefaultEighth()
+		incoming.UnsetDefaultNineth()
+
+		if err := incoming.Read(protocol); err != nil {
+			t.Fatalf("%d: Could not read from buffer due to '%q'.", i, err)
+		}
+
+		if *incoming != *emission {
+			t.Errorf("%d: incoming (%v) != emission (%v)", i, incoming, emission)
+		}
+	}
+}
+
+func TestIssetBitsUnmarshal(t *testing.T) {
+	emission := NewContainerOfEnums()
+	emission.SetSecond(DefinedValues_Three)
+	emission.SetOptionalFifth(DefinedValues_One)
+
+	for _, proto := range []string{"Binary", "Compact"} {
+		incoming := NewContainerOfEnums()
+		incoming.UnsetDefaultSeventh()
+		incoming.UnsetDefaultEighth()
+		incoming.UnsetDefaultNineth()
+		var err error
+
+		if proto == "Binary" {
+			err = incoming.UnmarshalBinaryThrift(emission.MarshalBinaryThrift(nil))
+		} else {
+			err = incoming.UnmarshalCompactThrift(emission.MarshalCompactThrift(nil))
+		}
+
+		if err != nil {
+			t.Fatalf("%s: Could not unmarshal due to '%q'.", proto, err)
+		}
+
+		if *incoming != *emission {
+			t.Errorf("%s: incoming (%v) != emission (%v)", proto, incoming, emission)
+		}
+	}
+}
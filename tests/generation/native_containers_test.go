@@ -0,0 +1,185 @@
+package simple
+
+import (
+	"bytes"
+	"testing"
+	"thrift"
+)
+
+// These tests are compiled against the output of
+// "--gen go:native_containers", under which the sets and maps of Directory
+// are Go maps, which CompareTo() orders by their hashes.
+
+// Undoes the mixing thrift.HashInt64() applies to the element of a set, so
+// that a set may be built whose hash collides with another's.
+func unhashSetElement(e uint64) int64 {
+	inverse := func(x uint64) uint64 {
+		y := x
+
+		for i := 0; i < 5; i++ {
+			y *= 2 - x*y
+		}
+
+		return y
+	}
+
+	v := e*inverse(1099511628211) ^ thrift.HashSeed
+	v ^= v >> 33
+	v *= inverse(0xff51afd7ed558ccd)
+	v ^= v >> 33
+	return int64(v)
+}
+
+// Two sets, {1, 2} and {3, y}, whose elements hash to the same sum.
+func newCollidingDirectories(t *testing.T) (*Directory, *Directory, int64) {
+	hash := func(k int64) uint64 {
+		return thrift.HashInt64(thrift.HashSeed, k)
+	}
+
+	y := unhashSetElement(hash(1) + hash(2) - hash(3))
+
+	if hash(y) != hash(1)+hash(2)-hash(3) {
+		t.Fatalf("unhashSetElement() no longer inverts thrift.HashInt64().")
+	}
+
+	in, out := NewDirectory(), NewDirectory()
+	in.Ids = map[int64]struct{}{1: {}, 2: {}}
+	out.Ids = map[int64]struct{}{3: {}, y: {}}
+	return in, out, y
+}
+
+func TestNativeContainersCompareCollidingSets(t *testing.T) {
+	in, out, y := newCollidingDirectories(t)
+
+	if in.Hash64() != out.Hash64() {
+		t.Fatalf("in.Hash64() (%x) != out.Hash64() (%x), want a collision.", in.Hash64(), out.Hash64())
+	}
+
+	if in.EqualsT(out) {
+		t.Errorf("in (%v) and out (%v) were taken as equal.", in, out)
+	}
+
+	// The least element either holds decides, the set holding it coming after
+	want := 1
+
+	if y < 1 {
+		want = -1
+	}
+
+	if c, ok := in.CompareTo(out); c != want || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want %d, true.", c, ok, want)
+	}
+
+	if c, ok := out.CompareTo(in); c != -want || !ok {
+		t.Errorf("out.CompareTo(in) => %d, %v, want %d, true.", c, ok, -want)
+	}
+}
+
+func TestNativeContainersCompareCollidingMaps(t *testing.T) {
+	_, _, y := newCollidingDirectories(t)
+	in, out := NewDirectory(), NewDirectory()
+	in.Names = map[int64]string{1: "", 2: ""}
+	out.Names = map[int64]string{3: "", y: ""}
+
+	// An entry with an empty value hashes as its key does, times a constant
+	if in.Hash64() != out.Hash64() {
+		t.Fatalf("in.Hash64() (%x) != out.Hash64() (%x), want a collision.", in.Hash64(), out.Hash64())
+	}
+
+	if in.EqualsT(out) {
+		t.Errorf("in (%v) and out (%v) were taken as equal.", in, out)
+	}
+
+	want := 1
+
+	if y < 1 {
+		want = -1
+	}
+
+	if c, ok := in.CompareTo(out); c != want || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want %d, true.", c, ok, want)
+	}
+
+	if c, ok := out.CompareTo(in); c != -want || !ok {
+		t.Errorf("out.CompareTo(in) => %d, %v, want %d, true.", c, ok, -want)
+	}
+
+	out.Names = map[int64]string{1: "", 2: ""}
+
+	if c, ok := in.CompareTo(out); c != 0 || !ok || !in.EqualsT(out) {
+		t.Errorf("in.CompareTo(out) => %d, %v for equal maps, want 0, true.", c, ok)
+	}
+
+	out.Names[2] = "two"
+	c, _ := in.CompareTo(out)
+
+	if d, _ := out.CompareTo(in); c == 0 || c != -d {
+		t.Errorf("in.CompareTo(out) => %d and out.CompareTo(in) => %d for unequal maps.", c, d)
+	}
+}
+
+func TestNativeContainersResetWritesAsNew(t *testing.T) {
+	in, _, _ := newCollidingDirectories(t)
+	in.Names = map[int64]string{1: "one"}
+	out := NewDirectory()
+
+	if err := out.UnmarshalBinaryThrift(in.MarshalBinaryThrift(nil)); err != nil {
+		t.Fatalf("Could not read directory due to '%q'.", err)
+	}
+
+	out.Reset()
+
+	if wire, want := out.MarshalBinaryThrift(nil), NewDirectory().MarshalBinaryThrift(nil); !bytes.Equal(wire, want) {
+		t.Errorf("A Reset() directory wrote %x, want %x as New() writes.", wire, want)
+	}
+
+	// Read back into the storage Reset() kept, a field the read leaves out
+	// stays nil
+	if err := out.UnmarshalBinaryThrift(NewDirectory().MarshalBinaryThrift(nil)); err != nil {
+		t.Fatalf("Could not read directory due to '%q'.", err)
+	}
+
+	if out.Ids != nil || out.Names != nil {
+		t.Errorf("A directory read without ids or names got %v and %v, want nil.", out.Ids, out.Names)
+	}
+
+	out.Reset()
+
+	if err := out.UnmarshalBinaryThrift(in.MarshalBinaryThrift(nil)); err != nil {
+		t.Fatalf("Could not read directory due to '%q'.", err)
+	}
+
+	if !in.EqualsT(out) {
+		t.Errorf("in (%v) != out (%v) read after Reset().", in, out)
+	}
+}
+
+// A nil set or map is left out when written and an empty one is not, so
+// the two must not compare equal.
+func TestNativeContainersCompareNilBeforeEmpty(t *testing.T) {
+	in, out := NewDirectory(), NewDirectory()
+	out.Ids = map[int64]struct{}{}
+	out.Names = map[int64]string{}
+
+	if in.EqualsT(out) || in.Hash64() == out.Hash64() {
+		t.Errorf("A directory of nil containers was taken as equal to one of empty containers.")
+	}
+
+	if c, ok := in.CompareTo(out); c != -1 || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want -1, true.", c, ok)
+	}
+
+	if c, ok := out.CompareTo(in); c != 1 || !ok {
+		t.Errorf("out.CompareTo(in) => %d, %v, want 1, true.", c, ok)
+	}
+
+	read := NewDirectory()
+
+	if err := read.UnmarshalBinaryThrift(out.MarshalBinaryThrift(nil)); err != nil {
+		t.Fatalf("Could not read directory due to '%q'.", err)
+	}
+
+	if !read.EqualsT(out) || read.Hash64() != out.Hash64() {
+		t.Errorf("A directory of empty containers read back was taken as different.")
+	}
+}
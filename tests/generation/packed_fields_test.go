@@ -0,0 +1,56 @@
+package simple
+
+import (
+	"reflect"
+	"testing"
+	"thrift"
+	"unsafe"
+)
+
+// These tests are compiled against the output of "--gen go:pack_fields",
+// alongside simple_test.go and service_test.go, under which struct fields are
+// declared widest alignment first rather than in field id order; the round
+// trips of simple_test.go cover reading and writing them.
+
+func TestPackedSparseFieldsSize(t *testing.T) {
+	var fields SparseFields
+
+	if n := reflect.TypeOf(fields).NumField(); n != 7 {
+		t.Errorf("SparseFields has %d fields, want its 6 and thrift.TStruct.", n)
+	}
+
+	if unsafe.Sizeof(uintptr(0)) == 8 && unsafe.Sizeof(fields) != 48 {
+		t.Errorf("unsafe.Sizeof(SparseFields{}) => %d, want 48.", unsafe.Sizeof(fields))
+	}
+}
+
+// Packing reorders the declarations alone: fields are still sent in field id
+// order.
+func TestPackedSparseFieldsWireOrder(t *testing.T) {
+	in := NewSparseFields()
+	in.Name = "sparse"
+	protocol := thrift.NewTBinaryProtocolTransport(thrift.NewTMemoryBuffer())
+	in.Write(protocol)
+	protocol.ReadStructBegin()
+	var ids []int16
+
+	for {
+		_, fieldTypeId, fieldId, err := protocol.ReadFieldBegin()
+
+		if err != nil {
+			t.Fatalf("Could not read field header: %q", err)
+		}
+
+		if fieldTypeId == thrift.STOP {
+			break
+		}
+
+		ids = append(ids, fieldId)
+		protocol.Skip(fieldTypeId)
+		protocol.ReadFieldEnd()
+	}
+
+	if want := []int16{1, 5, 9, 40, 41, 300}; !reflect.DeepEqual(ids, want) {
+		t.Errorf("SparseFields was written with field ids %v, want %v", ids, want)
+	}
+}
@@ -0,0 +1,736 @@
+package simple
+
+import (
+	"errors"
+	"fmt"
+	"net"
+	"sort"
+	"sync"
+	"testing"
+	"thrift"
+	"time"
+)
+
+// Drops the oneway notify() calls made to the handlers below, which serve
+// echo().
+type ignoredNotify struct{}
+
+func (ignoredNotify) Notify(message *ContainerOfEnums) error {
+	return nil
+}
+
+type echoHandler struct {
+	ignoredNotify
+}
+
+func (echoHandler) Echo(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+	return message, nil
+}
+
+func newLoopbackListener(tb testing.TB) net.Listener {
+	l, err := net.Listen("tcp", "127.0.0.1:0")
+
+	if err != nil {
+		tb.Fatalf("Could not listen on loopback due to '%q'.", err)
+	}
+
+	return l
+}
+
+// Runs serve on a buffered binary protocol for each connection l accepts,
+// until l is closed.
+func acceptLoopback(l net.Listener, serve func(iprot, oprot thrift.TProtocol)) {
+	for {
+		conn, err := l.Accept()
+
+		if err != nil {
+			return
+		}
+
+		go func() {
+			socket, _ := thrift.NewTNonblockingSocketConn(conn)
+			transport := thrift.NewTBufferedTransport(socket, 0, 0)
+			defer transport.Close()
+			protocol := thrift.NewTBinaryProtocolTransport(transport)
+			serve(protocol, protocol)
+		}()
+	}
+}
+
+// Serves the generated processor, which answers each call before reading
+// the next.
+func serveEcho(tb testing.TB) net.Listener {
+	l := newLoopbackListener(tb)
+	processor := NewContainerOfEnumsTestServiceProcessor(echoHandler{})
+
+	go acceptLoopback(l, func(iprot, oprot thrift.TProtocol) {
+		for {
+			if ok, err := processor.Process(iprot, oprot); !ok || err != nil {
+				return
+			}
+		}
+	})
+
+	return l
+}
+
+// Answers each call after a delay that shrinks as the sequence ids grow, so
+// that the replies overtake one another.
+func serveEchoOutOfOrder(tb testing.TB) net.Listener {
+	l := newLoopbackListener(tb)
+
+	go acceptLoopback(l, func(iprot, oprot thrift.TProtocol) {
+		var lock sync.Mutex
+		var replies sync.WaitGroup
+		defer replies.Wait()
+
+		for {
+			_, _, seqId, err := iprot.ReadMessageBegin()
+
+			if err != nil {
+				return
+			}
+
+			args := NewEchoArgs()
+
+			if err := args.Read(iprot); err != nil {
+				return
+			}
+
+			iprot.ReadMessageEnd()
+			replies.Add(1)
+
+			go func() {
+				defer replies.Done()
+				time.Sleep(time.Duration(10-seqId%10) * time.Millisecond)
+				result := NewEchoResult()
+				result.Success = args.Message
+				lock.Lock()
+				defer lock.Unlock()
+				oprot.WriteMessageBegin("echo", thrift.REPLY, seqId)
+				result.Write(oprot)
+				oprot.WriteMessageEnd()
+				oprot.Flush()
+			}()
+		}
+	})
+
+	return l
+}
+
+// Serves the generated processor with up to 16 of each connection's calls
+// handled at once.
+func serveEchoConcurrently(tb testing.TB, handler IContainerOfEnumsTestService) net.Listener {
+	l := newLoopbackListener(tb)
+	processor := NewContainerOfEnumsTestServiceProcessor(handler)
+
+	go acceptLoopback(l, func(iprot, oprot thrift.TProtocol) {
+		thrift.ProcessConcurrently(processor, iprot, oprot, thrift.NewTBinaryProtocolFactoryDefault(), 16)
+	})
+
+	return l
+}
+
+func dialLoopback(tb testing.TB, l net.Listener) thrift.TTransport {
+	conn, err := net.Dial("tcp", l.Addr().String())
+
+	if err != nil {
+		tb.Fatalf("Could not connect over loopback due to '%q'.", err)
+	}
+
+	socket, _ := thrift.NewTNonblockingSocketConn(conn)
+	return thrift.NewTBufferedTransport(socket, 0, 0)
+}
+
+func newNumberedContainerOfEnums(i int) *ContainerOfEnums {
+	message := NewContainerOfEnums()
+	message.First = UndefinedValues(i)
+	return message
+}
+
+func TestConcurrentClientRoutesReplies(t *testing.T) {
+	for _, serve := range []func(testing.TB) net.Listener{serveEcho, serveEchoOutOfOrder} {
+		l := serve(t)
+		client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(t, l), thrift.NewTBinaryProtocolFactoryDefault(), 16)
+		var wait sync.WaitGroup
+
+		for i := 0; i < 100; i++ {
+			wait.Add(1)
+
+			go func(i int) {
+				defer wait.Done()
+				reply, err := client.Echo(newNumberedContainerOfEnums(i))
+
+				if err != nil {
+					t.Errorf("%d: Could not call echo due to '%q'.", i, err)
+				} else if reply.First != UndefinedValues(i) {
+					t.Errorf("%d: Got the reply to call %d.", i, reply.First)
+				}
+			}(i)
+		}
+
+		wait.Wait()
+		client.Close()
+
+		if _, err := client.Echo(newNumberedContainerOfEnums(0)); err == nil {
+			t.Errorf("A closed client made a call.")
+		}
+
+		l.Close()
+	}
+}
+
+func TestConcurrentClientFailsOutstandingCalls(t *testing.T) {
+	l := newLoopbackListener(t)
+	defer l.Close()
+	// Reads a call and hangs up without replying.
+	go acceptLoopback(l, func(iprot, oprot thrift.TProtocol) {
+		iprot.ReadMessageBegin()
+	})
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(t, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+
+	if _, err := client.Echo(NewContainerOfEnums()); err == nil {
+		t.Errorf("A call was answered by a server that hung up.")
+	}
+}
+
+// Counts the calls it hands on to the generated function.
+type countingProcessorFunction struct {
+	thrift.TProcessorFunction
+	calls int
+}
+
+func (p *countingProcessorFunction) Process(seqId int32, iprot, oprot thrift.TProtocol) (bool, thrift.TException) {
+	p.calls++
+	return p.TProcessorFunction.Process(seqId, iprot, oprot)
+}
+
+func writeEchoCall(protocol thrift.TProtocol, name string, message *ContainerOfEnums) {
+	protocol.WriteMessageBegin(name, thrift.CALL, 1)
+	args := NewEchoArgs()
+	args.Message = message
+	args.Write(protocol)
+	protocol.WriteMessageEnd()
+}
+
+func TestProcessorDispatchesToAddedFunctions(t *testing.T) {
+	processor := NewContainerOfEnumsTestServiceProcessor(echoHandler{})
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolTransport(buffer)
+	echo, _ := processor.GetProcessorFunction("echo")
+	counting := &countingProcessorFunction{TProcessorFunction: echo}
+	processor.AddToProcessorMap("echo", counting)
+	processor.AddToProcessorMap("echoAgain", counting)
+
+	for _, name := range []string{"echo", "echoAgain"} {
+		buffer.Reset()
+		writeEchoCall(protocol, name, NewContainerOfEnums())
+
+		if ok, err := processor.Process(protocol, protocol); !ok || err != nil {
+			t.Errorf("Could not process %s due to '%q'.", name, err)
+		}
+
+		if _, typeId, _, _ := protocol.ReadMessageBegin(); typeId != thrift.REPLY {
+			t.Errorf("%s was answered with a message of type %d.", name, typeId)
+		}
+	}
+
+	if counting.calls != 2 {
+		t.Errorf("counting.calls (%d) != 2.", counting.calls)
+	}
+
+	buffer.Reset()
+	writeEchoCall(protocol, "echoNever", NewContainerOfEnums())
+
+	if _, err := processor.Process(protocol, protocol); err == nil {
+		t.Errorf("An unknown function was processed.")
+	}
+}
+
+type retainingEchoHandler struct {
+	echoHandler
+}
+
+func (retainingEchoHandler) RetainsArgs() bool {
+	return true
+}
+
+func TestProcessorPoolsArgsUnlessRetained(t *testing.T) {
+	for _, handler := range []IContainerOfEnumsTestService{echoHandler{}, retainingEchoHandler{}} {
+		_, retains := handler.(thrift.TArgsRetainer)
+		processor := NewContainerOfEnumsTestServiceProcessor(handler)
+		buffer := thrift.NewTMemoryBuffer()
+		protocol := thrift.NewTBinaryProtocolTransport(buffer)
+		function, _ := processor.GetProcessorFunction("echo")
+		split := function.(thrift.TSplitProcessorFunction)
+		writeEchoCall(protocol, "echo", newNumberedContainerOfEnums(1))
+		protocol.ReadMessageBegin()
+		a, err := split.ReadArgs(protocol)
+
+		if err != nil {
+			t.Fatalf("Could not read echo arguments due to '%q'.", err)
+		}
+
+		if ok, err := split.ProcessArgs(1, a, protocol); !ok || err != nil {
+			t.Fatalf("Could not process echo due to '%q'.", err)
+		}
+
+		if args := a.(*EchoArgs); retains && args.Message == nil {
+			t.Errorf("The arguments of a retaining handler were reset.")
+		} else if !retains && args.Message != nil {
+			t.Errorf("The arguments of a pooling handler were not reset.")
+		}
+	}
+}
+
+// Processes echo calls from memory, so as to measure the processor alone.
+func BenchmarkProcessEcho(b *testing.B) {
+	processor := NewContainerOfEnumsTestServiceProcessor(echoHandler{})
+	buffer := thrift.NewTMemoryBuffer()
+	protocol := thrift.NewTBinaryProtocolTransport(buffer)
+	writeEchoCall(protocol, "echo", NewContainerOfEnums())
+	wire := append([]byte(nil), buffer.Bytes()...)
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		buffer.Reset()
+		buffer.Write(wire)
+
+		if ok, err := processor.Process(protocol, protocol); !ok || err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+// Holds the call numbered 1 until release is closed and fails the one
+// numbered 2.
+type blockingEchoHandler struct {
+	ignoredNotify
+	release chan struct{}
+}
+
+func (p blockingEchoHandler) Echo(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+	switch message.First {
+	case 1:
+		<-p.release
+	case 2:
+		return nil, errors.New("echo failed")
+	}
+
+	return message, nil
+}
+
+func TestProcessConcurrentlyAnswersAroundSlowCalls(t *testing.T) {
+	handler := blockingEchoHandler{release: make(chan struct{})}
+	l := serveEchoConcurrently(t, handler)
+	defer l.Close()
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(t, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+	slow := make(chan error, 1)
+
+	go func() {
+		_, err := client.Echo(newNumberedContainerOfEnums(1))
+		slow <- err
+	}()
+
+	if reply, err := client.Echo(newNumberedContainerOfEnums(3)); err != nil || reply.First != 3 {
+		t.Errorf("Could not call echo behind a slow call: %v, %q.", reply, err)
+	}
+
+	if _, err := client.Echo(newNumberedContainerOfEnums(2)); err == nil {
+		t.Errorf("A failing call was answered without an exception.")
+	}
+
+	if reply, err := client.Echo(newNumberedContainerOfEnums(4)); err != nil || reply.First != 4 {
+		t.Errorf("Could not call echo after a failing call: %v, %q.", reply, err)
+	}
+
+	select {
+	case err := <-slow:
+		t.Errorf("The slow call returned early with '%q'.", err)
+	default:
+	}
+
+	close(handler.release)
+
+	if err := <-slow; err != nil {
+		t.Errorf("Could not finish the slow call due to '%q'.", err)
+	}
+}
+
+// Reports the median and 99th percentile of latencies alongside the
+// benchmark's own results.
+func reportLatencies(b *testing.B, latencies []time.Duration) {
+	sort.Slice(latencies, func(i, j int) bool { return latencies[i] < latencies[j] })
+
+	if len(latencies) > 0 {
+		b.ReportMetric(float64(latencies[len(latencies)/2].Nanoseconds()), "p50-ns")
+		b.ReportMetric(float64(latencies[len(latencies)*99/100].Nanoseconds()), "p99-ns")
+	}
+}
+
+// Issues echo calls over one connection from 64 goroutines per CPU.
+func benchmarkEcho(b *testing.B, echo func(*ContainerOfEnums) (*ContainerOfEnums, error)) {
+	var lock sync.Mutex
+	var latencies []time.Duration
+	message := newSetContainerOfEnums()
+	b.SetParallelism(64)
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	b.RunParallel(func(pb *testing.PB) {
+		var mine []time.Duration
+
+		for pb.Next() {
+			start := time.Now()
+
+			if _, err := echo(message); err != nil {
+				b.Error(err)
+				return
+			}
+
+			mine = append(mine, time.Since(start))
+		}
+
+		lock.Lock()
+		latencies = append(latencies, mine...)
+		lock.Unlock()
+	})
+
+	b.StopTimer()
+	reportLatencies(b, latencies)
+}
+
+func BenchmarkEchoClient(b *testing.B) {
+	l := serveEcho(b)
+	defer l.Close()
+	transport := dialLoopback(b, l)
+	defer transport.Close()
+	client := NewContainerOfEnumsTestServiceClientFactory(transport, thrift.NewTBinaryProtocolFactoryDefault())
+	var lock sync.Mutex
+
+	benchmarkEcho(b, func(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+		lock.Lock()
+		defer lock.Unlock()
+		return client.Echo(message)
+	})
+}
+
+func BenchmarkEchoConcurrentClient(b *testing.B) {
+	l := serveEcho(b)
+	defer l.Close()
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(b, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+	benchmarkEcho(b, client.Echo)
+}
+
+// Stands in for a handler that waits on some backend for each call.
+type sleepingEchoHandler struct {
+	ignoredNotify
+}
+
+func (sleepingEchoHandler) Echo(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+	time.Sleep(100 * time.Microsecond)
+	return message, nil
+}
+
+func BenchmarkSleepingEchoSerialServer(b *testing.B) {
+	l := newLoopbackListener(b)
+	defer l.Close()
+	processor := NewContainerOfEnumsTestServiceProcessor(sleepingEchoHandler{})
+
+	go acceptLoopback(l, func(iprot, oprot thrift.TProtocol) {
+		thrift.ProcessConcurrently(processor, iprot, oprot, thrift.NewTBinaryProtocolFactoryDefault(), 1)
+	})
+
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(b, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+	benchmarkEcho(b, client.Echo)
+}
+
+func BenchmarkSleepingEchoConcurrentServer(b *testing.B) {
+	l := serveEchoConcurrently(b, sleepingEchoHandler{})
+	defer l.Close()
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(b, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+	benchmarkEcho(b, client.Echo)
+}
+
+// A server socket over an existing listener, so that clients may connect
+// before Serve() starts accepting.
+type listenerServerSocket struct {
+	*thrift.TNonblockingServerSocket
+}
+
+func (listenerServerSocket) Listen() error {
+	return nil
+}
+
+// Serves handler with a TThreadPoolServer configured by configure until l is
+// closed.
+func serveEchoThreadPool(tb testing.TB, handler IContainerOfEnumsTestService, configure func(*thrift.TThreadPoolServer)) (net.Listener, *thrift.TThreadPoolServer) {
+	l := newLoopbackListener(tb)
+	socket, _ := thrift.NewTNonblockingServerSocketListener(l)
+	server := thrift.NewTThreadPoolServer4(NewContainerOfEnumsTestServiceProcessor(handler),
+		listenerServerSocket{socket},
+		thrift.NewTBufferedTransportFactory(thrift.NewTTransportFactory(), 0, 0),
+		thrift.NewTBinaryProtocolFactoryDefault(),
+	)
+	configure(server)
+	go server.Serve()
+	return l, server
+}
+
+// Holds every call until release is closed, reporting on entered as each
+// call reaches it.
+type gatedEchoHandler struct {
+	ignoredNotify
+	entered chan struct{}
+	release chan struct{}
+}
+
+func (p gatedEchoHandler) Echo(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+	p.entered <- struct{}{}
+	<-p.release
+	return message, nil
+}
+
+func TestThreadPoolServerRejectsWhenQueueIsFull(t *testing.T) {
+	handler := gatedEchoHandler{entered: make(chan struct{}, 2), release: make(chan struct{})}
+	l, server := serveEchoThreadPool(t, handler, func(server *thrift.TThreadPoolServer) {
+		server.SetWorkers(1)
+		server.SetQueueSize(1)
+		server.SetMaxConcurrentRequests(4)
+	})
+	defer l.Close()
+	client := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(t, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer client.Close()
+	accepted := make(chan error, 2)
+
+	for i := 0; i < 2; i++ {
+		go func(i int) {
+			_, err := client.Echo(newNumberedContainerOfEnums(i))
+			accepted <- err
+		}(i)
+
+		if i == 0 {
+			// The only worker is now busy with the first call.
+			<-handler.entered
+		}
+	}
+
+	for server.QueueDepth() != 1 {
+		time.Sleep(time.Millisecond)
+	}
+
+	_, err := client.Echo(newNumberedContainerOfEnums(2))
+
+	if x, ok := err.(thrift.TApplicationException); !ok || x.TypeId() != thrift.INTERNAL_ERROR {
+		t.Errorf("A call to a full server was answered with '%q'.", err)
+	}
+
+	if server.Rejected() != 1 {
+		t.Errorf("server.Rejected() (%d) != 1.", server.Rejected())
+	}
+
+	close(handler.release)
+
+	for i := 0; i < 2; i++ {
+		if err := <-accepted; err != nil {
+			t.Errorf("Could not finish a queued call due to '%q'.", err)
+		}
+	}
+
+	if server.Processed() != 2 {
+		t.Errorf("server.Processed() (%d) != 2.", server.Processed())
+	}
+}
+
+// A oneway call gets no reply even when it is refused, so that the reply to
+// the call after it is the next thing its client reads.
+func TestThreadPoolServerDropsRefusedOnewayCalls(t *testing.T) {
+	handler := gatedEchoHandler{entered: make(chan struct{}, 2), release: make(chan struct{})}
+	l, server := serveEchoThreadPool(t, handler, func(server *thrift.TThreadPoolServer) {
+		server.SetWorkers(1)
+		server.SetQueueSize(1)
+		server.SetMaxConcurrentRequests(4)
+	})
+	defer l.Close()
+	busy := NewContainerOfEnumsTestServiceConcurrentClient(dialLoopback(t, l), thrift.NewTBinaryProtocolFactoryDefault(), 0)
+	defer busy.Close()
+	accepted := make(chan error, 2)
+
+	for i := 0; i < 2; i++ {
+		go func(i int) {
+			_, err := busy.Echo(newNumberedContainerOfEnums(i))
+			accepted <- err
+		}(i)
+
+		if i == 0 {
+			<-handler.entered
+		}
+	}
+
+	for server.QueueDepth() != 1 {
+		time.Sleep(time.Millisecond)
+	}
+
+	transport := dialLoopback(t, l)
+	defer transport.Close()
+	client := NewContainerOfEnumsTestServiceClientFactory(transport, thrift.NewTBinaryProtocolFactoryDefault())
+
+	if err := client.Notify(newNumberedContainerOfEnums(2)); err != nil {
+		t.Fatalf("Could not send a oneway call due to '%q'.", err)
+	}
+
+	_, err := client.Echo(newNumberedContainerOfEnums(3))
+
+	if x, ok := err.(thrift.TApplicationException); !ok || x.TypeId() != thrift.INTERNAL_ERROR {
+		t.Errorf("A call to a full server was answered with '%q'.", err)
+	}
+
+	if server.Rejected() != 2 {
+		t.Errorf("server.Rejected() (%d) != 2.", server.Rejected())
+	}
+
+	close(handler.release)
+
+	for i := 0; i < 2; i++ {
+		if err := <-accepted; err != nil {
+			t.Errorf("Could not finish a queued call due to '%q'.", err)
+		}
+	}
+
+	if out, err := client.Echo(newNumberedContainerOfEnums(4)); err != nil || out.First != 4 {
+		t.Errorf("The call after the refused ones was answered with %v, '%q'.", out, err)
+	}
+}
+
+// A connection past the limit is closed unanswered, and one may connect
+// again once an open connection has closed.
+func TestThreadPoolServerClosesConnectionsPastLimit(t *testing.T) {
+	l, server := serveEchoThreadPool(t, echoHandler{}, func(server *thrift.TThreadPoolServer) {
+		server.SetMaxConnections(1)
+	})
+	defer l.Close()
+	open := dialLoopback(t, l)
+	client := NewContainerOfEnumsTestServiceClientFactory(open, thrift.NewTBinaryProtocolFactoryDefault())
+
+	if _, err := client.Echo(newNumberedContainerOfEnums(0)); err != nil {
+		t.Fatalf("Could not make a call due to '%q'.", err)
+	}
+
+	transport := dialLoopback(t, l)
+	defer transport.Close()
+
+	if _, err := NewContainerOfEnumsTestServiceClientFactory(transport, thrift.NewTBinaryProtocolFactoryDefault()).Echo(newNumberedContainerOfEnums(1)); err == nil {
+		t.Errorf("A call on a connection past the limit was answered.")
+	}
+
+	if server.RejectedConnections() != 1 {
+		t.Errorf("server.RejectedConnections() (%d) != 1.", server.RejectedConnections())
+	}
+
+	open.Close()
+
+	for attempt := 0; ; attempt++ {
+		transport := dialLoopback(t, l)
+		_, err := NewContainerOfEnumsTestServiceClientFactory(transport, thrift.NewTBinaryProtocolFactoryDefault()).Echo(newNumberedContainerOfEnums(2))
+		transport.Close()
+
+		if err == nil {
+			break
+		}
+
+		if attempt == 100 {
+			t.Fatalf("Could not connect after the open connection closed due to '%q'.", err)
+		}
+
+		time.Sleep(10 * time.Millisecond)
+	}
+}
+
+// Stands in for a backend that can serve four calls at a time, each taking
+// a millisecond.
+type contendedEchoHandler struct {
+	ignoredNotify
+	backend chan struct{}
+}
+
+func newContendedEchoHandler() contendedEchoHandler {
+	return contendedEchoHandler{backend: make(chan struct{}, 4)}
+}
+
+func (p contendedEchoHandler) Echo(message *ContainerOfEnums) (*ContainerOfEnums, error) {
+	p.backend <- struct{}{}
+	time.Sleep(time.Millisecond)
+	<-p.backend
+	return message, nil
+}
+
+// Offers the server at l far more calls than it can handle, from 256
+// connections each making one call at a time and backing off for a
+// millisecond whenever a call is refused.  The latencies reported are those
+// of the calls answered.
+func benchmarkOverload(b *testing.B, l net.Listener) {
+	var lock sync.Mutex
+	var latencies []time.Duration
+	var rejected int
+	message := newSetContainerOfEnums()
+	b.SetParallelism(256)
+	b.ResetTimer()
+
+	b.RunParallel(func(pb *testing.PB) {
+		transport := dialLoopback(b, l)
+		defer transport.Close()
+		client := NewContainerOfEnumsTestServiceClientFactory(transport, thrift.NewTBinaryProtocolFactoryDefault())
+		var mine []time.Duration
+		var refused int
+
+		for pb.Next() {
+			start := time.Now()
+			_, err := client.Echo(message)
+
+			if _, ok := err.(thrift.TApplicationException); ok {
+				refused++
+				time.Sleep(time.Millisecond)
+				continue
+			} else if err != nil {
+				b.Error(err)
+				return
+			}
+
+			mine = append(mine, time.Since(start))
+		}
+
+		lock.Lock()
+		latencies = append(latencies, mine...)
+		rejected += refused
+		lock.Unlock()
+	})
+
+	b.StopTimer()
+	reportLatencies(b, latencies)
+	b.ReportMetric(float64(rejected)/float64(b.N), "rejected/op")
+}
+
+func BenchmarkOverloadConcurrentServer(b *testing.B) {
+	l := serveEchoConcurrently(b, newContendedEchoHandler())
+	defer l.Close()
+	benchmarkOverload(b, l)
+}
+
+func BenchmarkOverloadThreadPoolServer(b *testing.B) {
+	for _, queueSize := range []int{0, 16} {
+		b.Run(fmt.Sprintf("queue=%d", queueSize), func(b *testing.B) {
+			l, _ := serveEchoThreadPool(b, newContendedEchoHandler(), func(server *thrift.TThreadPoolServer) {
+				server.SetWorkers(4)
+				server.SetQueueSize(queueSize)
+			})
+			defer l.Close()
+			benchmarkOverload(b, l)
+		})
+	}
+}
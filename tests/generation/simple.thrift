@@ -31,6 +31,21 @@ struct ContainerOfEnums {
   9: optional HeterogeneousValues default_nineth = HeterogeneousValues.One,
 }
 
+struct SparseFields {
+  1: bool enabled,
+  5: i64 id,
+  9: byte flags,
+  40: string name,
+  41: i16 port,
+  300: i32 weight,
+}
+
+struct Directory {
+  1: set<i64> ids,
+  2: map<i64, string> names,
+}
+
 service ContainerOfEnumsTestService {
   ContainerOfEnums echo(1: ContainerOfEnums message);
+  oneway void notify(1: ContainerOfEnums message);
 }
@@ -1,8 +1,11 @@
 package simple
 
 import (
+	"bytes"
+	"reflect"
 	"testing"
 	"thrift"
+	"unsafe"
 )
 
 func TestUndefinedValuesString(t *testing.T) {
@@ -127,6 +130,23 @@ func TestContainerOfEnumsNew(t *testing.T) {
 	}
 }
 
+func TestContainerOfEnumsSharesFieldDescriptor(t *testing.T) {
+	first := NewContainerOfEnums()
+	second := NewContainerOfEnums()
+
+	if first.TStruct != second.TStruct {
+		t.Errorf("NewContainerOfEnums allocated a TStruct per instance.")
+	}
+
+	if allocs := testing.AllocsPerRun(100, func() { benchmarkContainerOfEnums = NewContainerOfEnums() }); allocs > 1 {
+		t.Errorf("NewContainerOfEnums made %v allocations, want 1.", allocs)
+	}
+
+	if fields := first.TStructFields(); fields.Len() != 9 {
+		t.Errorf("TStructFields().Len() => %d, want 9", fields.Len())
+	}
+}
+
 func TestContainerOfEnumsFieldsSet(t *testing.T) {
 	emission := NewContainerOfEnums()
 
@@ -554,3 +574,333 @@ func TestWireFormatWithSetPayload(t *testing.T) {
 		}
 	}
 }
+
+func newSetContainerOfEnums() *ContainerOfEnums {
+	emission := NewContainerOfEnums()
+	emission.OptionalFourth = UndefinedValues_Three
+	emission.OptionalFifth = DefinedValues_Three
+	emission.OptionalSixth = HeterogeneousValues_Three
+	return emission
+}
+
+// The generated byte slice codecs and the protocols whose bytes they must
+// reproduce.
+var codecs = []struct {
+	name      string
+	builder   func(thrift.TTransport) thrift.TProtocol
+	marshal   func(*ContainerOfEnums, []byte) []byte
+	unmarshal func(*ContainerOfEnums, []byte) error
+	size      func(*ContainerOfEnums) int
+}{
+	{
+		"Binary",
+		func(transport thrift.TTransport) thrift.TProtocol {
+			return thrift.NewTBinaryProtocolTransport(transport)
+		},
+		(*ContainerOfEnums).MarshalBinaryThrift,
+		(*ContainerOfEnums).UnmarshalBinaryThrift,
+		(*ContainerOfEnums).BinarySize,
+	},
+	{
+		"Compact",
+		func(transport thrift.TTransport) thrift.TProtocol {
+			return thrift.NewTCompactProtocol(transport)
+		},
+		(*ContainerOfEnums).MarshalCompactThrift,
+		(*ContainerOfEnums).UnmarshalCompactThrift,
+		(*ContainerOfEnums).CompactSize,
+	},
+}
+
+func TestCodecsMatchProtocols(t *testing.T) {
+	for _, codec := range codecs {
+		for i, emission := range []*ContainerOfEnums{NewContainerOfEnums(), newSetContainerOfEnums()} {
+			transport := thrift.NewTMemoryBuffer()
+			protocol := codec.builder(transport)
+
+			if err := emission.Write(protocol); err != nil {
+				t.Fatalf("%d (%s): Could not emit %q: %q", i, codec.name, emission, err)
+			}
+
+			wire := transport.Bytes()
+
+			if marshaled := codec.marshal(emission, nil); !bytes.Equal(marshaled, wire) {
+				t.Errorf("%d (%s): Marshal%sThrift() (%v) != Write() (%v)", i, codec.name, codec.name, marshaled, wire)
+			}
+
+			if size := codec.size(emission); size != len(wire) {
+				t.Errorf("%d (%s): %sSize() (%d) != len(Write()) (%d)", i, codec.name, codec.name, size, len(wire))
+			}
+
+			incoming := NewContainerOfEnums()
+
+			if err := codec.unmarshal(incoming, wire); err != nil {
+				t.Fatalf("%d (%s): Could not unmarshal %v: %q", i, codec.name, wire, err)
+			}
+
+			if incoming.OptionalFourth != emission.OptionalFourth || incoming.IsSetOptionalFourth() != emission.IsSetOptionalFourth() {
+				t.Errorf("%d (%s): emission.OptionalFourth (%q) != incoming.OptionalFourth (%q)", i, codec.name, emission.OptionalFourth, incoming.OptionalFourth)
+			}
+
+			if incoming.OptionalFifth != emission.OptionalFifth || incoming.IsSetOptionalFifth() != emission.IsSetOptionalFifth() {
+				t.Errorf("%d (%s): emission.OptionalFifth (%q) != incoming.OptionalFifth (%q)", i, codec.name, emission.OptionalFifth, incoming.OptionalFifth)
+			}
+
+			if incoming.OptionalSixth != emission.OptionalSixth || incoming.IsSetOptionalSixth() != emission.IsSetOptionalSixth() {
+				t.Errorf("%d (%s): emission.OptionalSixth (%q) != incoming.OptionalSixth (%q)", i, codec.name, emission.OptionalSixth, incoming.OptionalSixth)
+			}
+
+			if !bytes.Equal(codec.marshal(incoming, nil), wire) {
+				t.Errorf("%d (%s): %q did not survive a round trip", i, codec.name, incoming)
+			}
+
+			incoming = NewContainerOfEnums()
+
+			if err := incoming.Read(protocol); err != nil {
+				t.Fatalf("%d (%s): Could not read %v: %q", i, codec.name, wire, err)
+			}
+
+			if !bytes.Equal(codec.marshal(incoming, nil), wire) {
+				t.Errorf("%d (%s): %q read back differently", i, codec.name, incoming)
+			}
+		}
+	}
+}
+
+func TestCodecsRejectTruncatedInput(t *testing.T) {
+	for _, codec := range codecs {
+		wire := codec.marshal(newSetContainerOfEnums(), nil)
+
+		for n := 0; n < len(wire); n++ {
+			if err := codec.unmarshal(NewContainerOfEnums(), wire[:n]); err == nil {
+				t.Errorf("%s: Unmarshaling %d of %d bytes did not fail", codec.name, n, len(wire))
+			}
+		}
+	}
+}
+
+func newSparseFields() *SparseFields {
+	fields := NewSparseFields()
+	fields.Enabled = true
+	fields.Id = 1 << 40
+	fields.Flags = 7
+	fields.Name = "sparse"
+	fields.Port = 8080
+	fields.Weight = -3
+	return fields
+}
+
+// Each gap in the field ids of SparseFields once cost it an "_ interface{}"
+// placeholder, 294 of them in all; now it holds its own fields alone, which
+// in field id order take 64 bytes and with "--gen go:pack_fields" 48 (see
+// packed_fields_test.go).
+func TestSparseFieldsSize(t *testing.T) {
+	var fields SparseFields
+
+	if n := reflect.TypeOf(fields).NumField(); n != 7 {
+		t.Errorf("SparseFields has %d fields, want its 6 and thrift.TStruct.", n)
+	}
+
+	if unsafe.Sizeof(uintptr(0)) == 8 && unsafe.Sizeof(fields) > 64 {
+		t.Errorf("unsafe.Sizeof(SparseFields{}) => %d, want at most 64.", unsafe.Sizeof(fields))
+	}
+}
+
+func TestSparseFieldsRoundTrip(t *testing.T) {
+	in := newSparseFields()
+
+	for _, codec := range codecs {
+		transport := thrift.NewTMemoryBuffer()
+
+		if err := in.Write(codec.builder(transport)); err != nil {
+			t.Fatalf("%s: Could not write %v: %q", codec.name, in, err)
+		}
+
+		out := NewSparseFields()
+
+		if err := out.Read(codec.builder(transport)); err != nil {
+			t.Fatalf("%s: Could not read %v: %q", codec.name, in, err)
+		}
+
+		if *out != *in {
+			t.Errorf("%s: out (%v) != in (%v)", codec.name, out, in)
+		}
+	}
+}
+
+func benchmarkContainerOfEnumsRead(b *testing.B, builder func(thrift.TTransport) thrift.TProtocol) {
+	b.StopTimer()
+	transport := thrift.NewTMemoryBuffer()
+	protocol := builder(transport)
+	emission := newSetContainerOfEnums()
+
+	if err := emission.Write(protocol); err != nil {
+		b.Fatalf("Could not emit %q: %q", emission, err)
+	}
+
+	wire := append([]byte(nil), transport.Bytes()...)
+	b.SetBytes(int64(len(wire)))
+	b.StartTimer()
+
+	for i := 0; i < b.N; i++ {
+		transport.Reset()
+		transport.Write(wire)
+
+		if err := NewContainerOfEnums().Read(protocol); err != nil {
+			b.Fatalf("Could not read from buffer: %q", err)
+		}
+	}
+}
+
+func BenchmarkContainerOfEnumsReadBinary(b *testing.B) {
+	benchmarkContainerOfEnumsRead(b, func(transport thrift.TTransport) thrift.TProtocol {
+		return thrift.NewTBinaryProtocolTransport(transport)
+	})
+}
+
+func BenchmarkContainerOfEnumsReadCompact(b *testing.B) {
+	benchmarkContainerOfEnumsRead(b, func(transport thrift.TTransport) thrift.TProtocol {
+		return thrift.NewTCompactProtocol(transport)
+	})
+}
+
+func BenchmarkContainerOfEnumsReadJSON(b *testing.B) {
+	benchmarkContainerOfEnumsRead(b, func(transport thrift.TTransport) thrift.TProtocol {
+		return thrift.NewTJSONProtocol(transport)
+	})
+}
+
+var benchmarkContainerOfEnums *ContainerOfEnums
+
+func BenchmarkNewContainerOfEnums(b *testing.B) {
+	b.ReportAllocs()
+
+	for i := 0; i < b.N; i++ {
+		benchmarkContainerOfEnums = NewContainerOfEnums()
+	}
+}
+
+// The following compare Write() and Read() over a TBinaryProtocol or
+// TCompactProtocol with the generated codecs, which produce and consume the
+// same bytes.
+
+func benchmarkContainerOfEnumsWrite(b *testing.B, builder func(thrift.TTransport) thrift.TProtocol) {
+	b.ReportAllocs()
+	emission := newSetContainerOfEnums()
+	transport := thrift.NewTMemoryBuffer()
+	protocol := builder(transport)
+
+	for i := 0; i < b.N; i++ {
+		transport.Reset()
+
+		if err := emission.Write(protocol); err != nil {
+			b.Fatalf("Could not emit %q: %q", emission, err)
+		}
+	}
+}
+
+func benchmarkContainerOfEnumsMarshal(b *testing.B, marshal func(*ContainerOfEnums, []byte) []byte) {
+	b.ReportAllocs()
+	emission := newSetContainerOfEnums()
+	var buf []byte
+
+	for i := 0; i < b.N; i++ {
+		buf = marshal(emission, buf[:0])
+	}
+}
+
+func benchmarkContainerOfEnumsUnmarshal(b *testing.B, marshal func(*ContainerOfEnums, []byte) []byte, unmarshal func(*ContainerOfEnums, []byte) error) {
+	b.ReportAllocs()
+	wire := marshal(newSetContainerOfEnums(), nil)
+	b.SetBytes(int64(len(wire)))
+
+	for i := 0; i < b.N; i++ {
+		if err := unmarshal(NewContainerOfEnums(), wire); err != nil {
+			b.Fatalf("Could not unmarshal %v: %q", wire, err)
+		}
+	}
+}
+
+func BenchmarkContainerOfEnumsWriteBinary(b *testing.B) {
+	benchmarkContainerOfEnumsWrite(b, codecs[0].builder)
+}
+
+func BenchmarkContainerOfEnumsMarshalBinary(b *testing.B) {
+	benchmarkContainerOfEnumsMarshal(b, (*ContainerOfEnums).MarshalBinaryThrift)
+}
+
+func BenchmarkContainerOfEnumsUnmarshalBinary(b *testing.B) {
+	benchmarkContainerOfEnumsUnmarshal(b, (*ContainerOfEnums).MarshalBinaryThrift, (*ContainerOfEnums).UnmarshalBinaryThrift)
+}
+
+func BenchmarkContainerOfEnumsWriteCompact(b *testing.B) {
+	benchmarkContainerOfEnumsWrite(b, codecs[1].builder)
+}
+
+func BenchmarkContainerOfEnumsMarshalCompact(b *testing.B) {
+	benchmarkContainerOfEnumsMarshal(b, (*ContainerOfEnums).MarshalCompactThrift)
+}
+
+func BenchmarkContainerOfEnumsUnmarshalCompact(b *testing.B) {
+	benchmarkContainerOfEnumsUnmarshal(b, (*ContainerOfEnums).MarshalCompactThrift, (*ContainerOfEnums).UnmarshalCompactThrift)
+}
+
+// Generated structs must remain thrift.TStructs for thrift.TList and its
+// siblings to hold them.
+var (
+	_ thrift.TStruct = (*ContainerOfEnums)(nil)
+	_ thrift.TStruct = (*SparseFields)(nil)
+)
+
+func TestStructEquality(t *testing.T) {
+	in, out := newSparseFields(), newSparseFields()
+
+	if !in.EqualsT(out) || in.Hash64() != out.Hash64() {
+		t.Errorf("Equal %v and %v gave EqualsT() => %v, Hash64() => %x and %x.", in, out, in.EqualsT(out), in.Hash64(), out.Hash64())
+	}
+
+	if c, ok := in.CompareTo(out); c != 0 || !ok {
+		t.Errorf("in.CompareTo(out) => %d, %v, want 0, true.", c, ok)
+	}
+
+	out.Port++
+
+	if in.EqualsT(out) || in.Hash64() == out.Hash64() {
+		t.Errorf("%v and %v were taken as equal.", in, out)
+	}
+
+	if c, _ := in.CompareTo(out); c != -1 {
+		t.Errorf("in.CompareTo(out) => %d, want -1.", c)
+	}
+
+	if c, _ := out.CompareTo(in); c != 1 {
+		t.Errorf("out.CompareTo(in) => %d, want 1.", c)
+	}
+
+	// Unset enums come before set ones
+	if c, _ := NewContainerOfEnums().CompareTo(newSetContainerOfEnums()); c != -1 {
+		t.Errorf("NewContainerOfEnums().CompareTo(newSetContainerOfEnums()) => %d, want -1.", c)
+	}
+
+	if in.Equals(out) || !in.Equals(newSparseFields()) || in.Equals(*in) {
+		t.Errorf("Equals() should agree with EqualsT() for a *SparseFields and be false otherwise.")
+	}
+
+	var none *SparseFields
+
+	if !none.EqualsT(nil) || none.EqualsT(in) || in.EqualsT(none) || none.Hash64() != 0 {
+		t.Errorf("A nil *SparseFields should equal only another.")
+	}
+
+	if c, ok := in.CompareTo(none); c != 1 || !ok {
+		t.Errorf("in.CompareTo(none) => %d, %v, want 1, true.", c, ok)
+	}
+
+	if allocs := testing.AllocsPerRun(100, func() {
+		in.EqualsT(out)
+		in.CompareTo(out)
+		in.Hash64()
+	}); allocs != 0 {
+		t.Errorf("EqualsT(), CompareTo() and Hash64() made %v allocations, want none.", allocs)
+	}
+}
@@ -39,6 +39,7 @@ func main() {
 	var server bool
 	var protocol string
 	var framed bool
+	var buffered bool
 	var useHttp bool
 	var help bool
 
@@ -46,6 +47,7 @@ func main() {
 	flag.BoolVar(&server, "server", false, "Run server")
 	flag.StringVar(&protocol, "P", "binary", "Specify the protocol (binary, compact, simplejson)")
 	flag.BoolVar(&framed, "framed", false, "Use framed transport")
+	flag.BoolVar(&buffered, "buffered", false, "Use buffered transport")
 	flag.BoolVar(&useHttp, "http", false, "Use http")
 	flag.BoolVar(&help, "help", false, "See usage string")
 	flag.Parse()
@@ -69,6 +71,9 @@ func main() {
 		os.Exit(1)
 	}
 	transportFactory := thrift.NewTTransportFactory()
+	if buffered {
+		transportFactory = thrift.NewTBufferedTransportFactory(transportFactory, 0, 0)
+	}
 	if framed {
 		transportFactory = thrift.NewTFramedTransportFactory(transportFactory)
 	}